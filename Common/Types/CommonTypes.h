@@ -2,14 +2,18 @@
 
 #include <variant>
 #include <string>
+#include <string_view>
 #include <memory>
 #include <atomic>
 #include <vector>
 #include <chrono>
 #include <exception>
+#include <optional>
 
 // 기본 타입들 (AIEP_AIEP_.hpp에서 가져온 것들)
 #include "../../dds_message/AIEP_AIEP_.hpp"
+#include "../Utils/Clock.h"
+#include "../Utils/FixedString.h"
 
 namespace WeaponControl {
 
@@ -17,11 +21,16 @@ namespace WeaponControl {
 // Result 타입 - 일관된 에러 처리
 // =============================================================================
 
+// 오류 메시지 최대 길이 (초과분은 잘림). 메시지를 내부 배열에 보관하므로
+// 거부 응답(잘못된 상태 전이 등)을 만들 때 힙을 사용하지 않는다.
+constexpr size_t ERROR_MESSAGE_CAPACITY = 192;
+using ErrorMessage = FixedString<ERROR_MESSAGE_CAPACITY>;
+
 struct ErrorInfo {
-    std::string message;
+    ErrorMessage message;
     int code;
     
-    ErrorInfo(const std::string& msg = "", int c = -1) 
+    ErrorInfo(std::string_view msg = {}, int c = -1) 
         : message(msg), code(c) {}
 };
 
@@ -30,15 +39,20 @@ class Result {
 private:
     std::variant<T, ErrorInfo> m_data;
     
-    explicit Result(T&& value) : m_data(std::forward<T>(value)) {}
+    explicit Result(T&& value) : m_data(std::move(value)) {}
+    explicit Result(const T& value) : m_data(value) {}
     explicit Result(const ErrorInfo& error) : m_data(error) {}
     
 public:
     static Result<T> success(T&& value) { 
-        return Result(std::forward<T>(value)); 
+        return Result(std::move(value)); 
+    }
+    
+    static Result<T> success(const T& value) { 
+        return Result(value); 
     }
     
-    static Result<T> failure(const std::string& message, int code = -1) { 
+    static Result<T> failure(std::string_view message, int code = -1) { 
         return Result(ErrorInfo{message, code}); 
     }
     
@@ -61,12 +75,13 @@ private:
     std::optional<ErrorInfo> m_error;
     
     explicit Result(const ErrorInfo& error) : m_error(error) {}
-    Result() : m_error(std::nullopt) {}
     
 public:
+    Result() : m_error(std::nullopt) {}
+    
     static Result<void> success() { return Result(); }
     
-    static Result<void> failure(const std::string& message, int code = -1) { 
+    static Result<void> failure(std::string_view message, int code = -1) { 
         return Result(ErrorInfo{message, code}); 
     }
     
@@ -105,15 +120,16 @@ public:
         }
     }
     
-    // 지정된 시간 동안 대기하면서 취소 확인
+    // 지정된 시간 동안 대기하면서 취소 확인 (주입된 시각 사용)
     template<typename Rep, typename Period>
     bool waitFor(const std::chrono::duration<Rep, Period>& duration) const {
-        auto start = std::chrono::steady_clock::now();
-        while (std::chrono::steady_clock::now() - start < duration) {
+        auto& clock = ClockProvider::get();
+        auto start = clock.now();
+        while (clock.now() - start < duration) {
             if (isCancelled()) {
                 return false; // 취소됨
             }
-            std::this_thread::sleep_for(std::chrono::milliseconds(10));
+            clock.sleepFor(std::chrono::milliseconds(10));
         }
         return true; // 정상 완료
     }
@@ -183,6 +199,12 @@ struct LaunchTubeStatus {
 // 교전계획 결과
 // =============================================================================
 
+// DDS 교전계획 결과 메시지의 궤적 배열 크기 (궤적 버퍼 예약 기준)
+constexpr size_t MAX_TRAJECTORY_POINTS = 128;
+
+// DDS 교전계획 결과 메시지의 경로점 배열 크기 (경로점 입력 최대 개수)
+constexpr size_t MAX_PLAN_WAYPOINTS = 8;
+
 struct EngagementPlanResult {
     uint16_t tubeNumber;
     EN_WPN_KIND weaponKind;
@@ -221,8 +243,8 @@ struct SystemStatistics {
     SystemStatistics()
         : totalCommands(0), successfulCommands(0), failedCommands(0)
         , assignedTubes(0), readyTubes(0), launchedWeapons(0)
-        , systemStartTime(std::chrono::steady_clock::now())
-        , lastUpdateTime(std::chrono::steady_clock::now()) {}
+        , systemStartTime(ClockProvider::get().now())
+        , lastUpdateTime(systemStartTime) {}
 };
 
 // =============================================================================
@@ -250,30 +272,86 @@ struct WaypointUpdateRequest {
 // 유틸리티 함수들
 // =============================================================================
 
-inline std::string WeaponKindToString(EN_WPN_KIND kind) {
-    switch(kind) {
-        case EN_WPN_KIND::WPN_KIND_ALM: return "ALM";
-        case EN_WPN_KIND::WPN_KIND_ASM: return "ASM";
-        case EN_WPN_KIND::WPN_KIND_AAM: return "AAM";
-        case EN_WPN_KIND::WPN_KIND_WGT: return "WGT";
-        case EN_WPN_KIND::WPN_KIND_M_MINE: return "MINE";
-        default: return "NA";
+// 열거값-이름 표. 이름은 문자열 리터럴이므로 data() 는 널 종료 문자열이다.
+template <typename Enum>
+struct EnumName {
+    Enum value;
+    std::string_view name;
+};
+
+constexpr EnumName<EN_WPN_KIND> WEAPON_KIND_NAMES[] = {
+    { EN_WPN_KIND::WPN_KIND_NA, "NA" },
+    { EN_WPN_KIND::WPN_KIND_ALM, "ALM" },
+    { EN_WPN_KIND::WPN_KIND_ASM, "ASM" },
+    { EN_WPN_KIND::WPN_KIND_AAM, "AAM" },
+    { EN_WPN_KIND::WPN_KIND_WGT, "WGT" },
+    { EN_WPN_KIND::WPN_KIND_M_MINE, "MINE" }
+};
+
+// 상태 순서는 상태별 지표 배열 색인(WeaponCtrlStateIndex)과 같다
+constexpr EnumName<EN_WPN_CTRL_STATE> WEAPON_CTRL_STATE_NAMES[] = {
+    { EN_WPN_CTRL_STATE::WPN_CTRL_STATE_OFF, "OFF" },
+    { EN_WPN_CTRL_STATE::WPN_CTRL_STATE_POC, "POC" },
+    { EN_WPN_CTRL_STATE::WPN_CTRL_STATE_ON, "ON" },
+    { EN_WPN_CTRL_STATE::WPN_CTRL_STATE_RTL, "RTL" },
+    { EN_WPN_CTRL_STATE::WPN_CTRL_STATE_LAUNCH, "LAUNCH" },
+    { EN_WPN_CTRL_STATE::WPN_CTRL_STATE_POST_LAUNCH, "POST_LAUNCH" },
+    { EN_WPN_CTRL_STATE::WPN_CTRL_STATE_ABORT, "ABORT" }
+};
+
+template <typename Enum, size_t N>
+constexpr std::string_view LookupEnumName(const EnumName<Enum> (&table)[N], Enum value, std::string_view fallback) {
+    for (size_t i = 0; i < N; ++i) {
+        if (table[i].value == value) {
+            return table[i].name;
+        }
     }
+    return fallback;
+}
+
+constexpr std::string_view WeaponKindToString(EN_WPN_KIND kind) {
+    return LookupEnumName(WEAPON_KIND_NAMES, kind, "NA");
 }
 
-inline std::string StateToString(EN_WPN_CTRL_STATE state) {
-    switch(state) {
-        case EN_WPN_CTRL_STATE::WPN_CTRL_STATE_OFF: return "OFF";
-        case EN_WPN_CTRL_STATE::WPN_CTRL_STATE_POC: return "POC";
-        case EN_WPN_CTRL_STATE::WPN_CTRL_STATE_ON: return "ON";
-        case EN_WPN_CTRL_STATE::WPN_CTRL_STATE_RTL: return "RTL";
-        case EN_WPN_CTRL_STATE::WPN_CTRL_STATE_LAUNCH: return "LAUNCH";
-        case EN_WPN_CTRL_STATE::WPN_CTRL_STATE_POST_LAUNCH: return "POST_LAUNCH";
-        case EN_WPN_CTRL_STATE::WPN_CTRL_STATE_ABORT: return "ABORT";
-        default: return "UNKNOWN";
+constexpr std::string_view StateToString(EN_WPN_CTRL_STATE state) {
+    return LookupEnumName(WEAPON_CTRL_STATE_NAMES, state, "UNKNOWN");
+}
+
+// 전체 무장 통제 상태 목록 (상태별 지표 등록용)
+constexpr EN_WPN_CTRL_STATE ALL_WEAPON_CTRL_STATES[] = {
+    EN_WPN_CTRL_STATE::WPN_CTRL_STATE_OFF,
+    EN_WPN_CTRL_STATE::WPN_CTRL_STATE_POC,
+    EN_WPN_CTRL_STATE::WPN_CTRL_STATE_ON,
+    EN_WPN_CTRL_STATE::WPN_CTRL_STATE_RTL,
+    EN_WPN_CTRL_STATE::WPN_CTRL_STATE_LAUNCH,
+    EN_WPN_CTRL_STATE::WPN_CTRL_STATE_POST_LAUNCH,
+    EN_WPN_CTRL_STATE::WPN_CTRL_STATE_ABORT
+};
+constexpr size_t WEAPON_CTRL_STATE_COUNT = sizeof(ALL_WEAPON_CTRL_STATES) / sizeof(ALL_WEAPON_CTRL_STATES[0]);
+
+constexpr size_t WeaponCtrlStateIndex(EN_WPN_CTRL_STATE state) {
+    for (size_t i = 0; i < WEAPON_CTRL_STATE_COUNT; ++i) {
+        if (ALL_WEAPON_CTRL_STATES[i] == state) {
+            return i;
+        }
+    }
+    return WEAPON_CTRL_STATE_COUNT;
+}
+
+constexpr bool WeaponCtrlStateNamesMatchOrder() {
+    for (size_t i = 0; i < WEAPON_CTRL_STATE_COUNT; ++i) {
+        if (WEAPON_CTRL_STATE_NAMES[i].value != ALL_WEAPON_CTRL_STATES[i]) {
+            return false;
+        }
     }
+    return true;
 }
 
+static_assert(sizeof(WEAPON_CTRL_STATE_NAMES) / sizeof(WEAPON_CTRL_STATE_NAMES[0]) == WEAPON_CTRL_STATE_COUNT,
+              "Every weapon control state needs a name");
+static_assert(WeaponCtrlStateNamesMatchOrder(), "State name table must follow ALL_WEAPON_CTRL_STATES order");
+static_assert(StateToString(EN_WPN_CTRL_STATE::WPN_CTRL_STATE_POST_LAUNCH) == "POST_LAUNCH");
+
 // 스마트 포인터 타입 정의
 class IWeapon;
 class IEngagementManager;
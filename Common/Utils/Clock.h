@@ -0,0 +1,173 @@
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace WeaponControl {
+
+// =============================================================================
+// 시각/타이머 인터페이스 - 실시간 또는 가상 시각 주입
+// =============================================================================
+
+class IClock {
+public:
+    using TimePoint = std::chrono::steady_clock::time_point;
+    using Duration = std::chrono::steady_clock::duration;
+
+    virtual ~IClock() = default;
+
+    virtual TimePoint now() const = 0;
+    virtual void sleepFor(Duration duration) = 0;
+    virtual bool isVirtual() const = 0;
+};
+
+// =============================================================================
+// 실제 시각 (std::chrono::steady_clock)
+// =============================================================================
+
+class SteadyClock : public IClock {
+public:
+    TimePoint now() const override { return std::chrono::steady_clock::now(); }
+    void sleepFor(Duration duration) override { std::this_thread::sleep_for(duration); }
+    bool isVirtual() const override { return false; }
+};
+
+// =============================================================================
+// 가상 시각 - 시나리오/벤치마크 빨리감기 실행용
+//
+// autoAdvance 모드(기본)에서는 sleepFor 가 대기 없이 시각을 전진시키므로
+// 300초 부설 임무도 즉시, 결정적으로 진행된다. autoAdvance 를 끄면
+// sleepFor 는 다른 스레드가 advance() 로 시각을 진행시킬 때까지 대기한다.
+// =============================================================================
+
+class VirtualClock : public IClock {
+public:
+    explicit VirtualClock(bool autoAdvance = true)
+        : m_elapsedNs(0)
+        , m_autoAdvance(autoAdvance) {}
+
+    TimePoint now() const override {
+        return TimePoint(std::chrono::nanoseconds(m_elapsedNs.load(std::memory_order_acquire)));
+    }
+
+    void sleepFor(Duration duration) override {
+        if (duration <= Duration::zero()) {
+            return;
+        }
+
+        if (m_autoAdvance.load(std::memory_order_relaxed)) {
+            advance(duration);
+            return;
+        }
+
+        TimePoint wakeTime = now() + duration;
+        std::unique_lock<std::mutex> lock(m_waitMutex);
+        m_advanced.wait(lock, [&]() {
+            return now() >= wakeTime || m_autoAdvance.load(std::memory_order_relaxed);
+        });
+    }
+
+    bool isVirtual() const override { return true; }
+
+    // 가상 시각 진행
+    void advance(Duration duration) {
+        auto ns = std::chrono::duration_cast<std::chrono::nanoseconds>(duration).count();
+        {
+            std::lock_guard<std::mutex> lock(m_waitMutex);
+            m_elapsedNs.fetch_add(ns, std::memory_order_acq_rel);
+        }
+        m_advanced.notify_all();
+    }
+
+    void setAutoAdvance(bool autoAdvance) {
+        {
+            std::lock_guard<std::mutex> lock(m_waitMutex);
+            m_autoAdvance.store(autoAdvance, std::memory_order_relaxed);
+        }
+        m_advanced.notify_all();
+    }
+
+    Duration elapsed() const { return now().time_since_epoch(); }
+
+private:
+    std::atomic<int64_t> m_elapsedNs;
+    std::atomic<bool> m_autoAdvance;
+    std::mutex m_waitMutex;
+    std::condition_variable m_advanced;
+};
+
+// =============================================================================
+// 시각 제공자 - 프로세스 기본 시각 + 스레드 단위 재정의
+// =============================================================================
+
+class ClockProvider {
+public:
+    static IClock& get() {
+        if (IClock* local = threadOverride()) {
+            return *local;
+        }
+        return *defaultClock().load(std::memory_order_acquire);
+    }
+
+    // 프로세스 기본 시각 교체 (이전 시각 객체는 사용 중일 수 있으므로 유지)
+    static void setDefault(std::shared_ptr<IClock> clock) {
+        if (!clock) {
+            return;
+        }
+        std::lock_guard<std::mutex> lock(retainedMutex());
+        retainedClocks().push_back(clock);
+        defaultClock().store(clock.get(), std::memory_order_release);
+    }
+
+    static void resetDefault() {
+        defaultClock().store(&steadyClock(), std::memory_order_release);
+    }
+
+    // 현재 스레드에서만 지정 시각 사용 (다중 인스턴스 시뮬레이션용)
+    class ScopedOverride {
+    public:
+        explicit ScopedOverride(IClock& clock) : m_previous(threadOverride()) {
+            threadOverride() = &clock;
+        }
+        ~ScopedOverride() { threadOverride() = m_previous; }
+
+        ScopedOverride(const ScopedOverride&) = delete;
+        ScopedOverride& operator=(const ScopedOverride&) = delete;
+
+    private:
+        IClock* m_previous;
+    };
+
+private:
+    static SteadyClock& steadyClock() {
+        static SteadyClock clock;
+        return clock;
+    }
+
+    static std::atomic<IClock*>& defaultClock() {
+        static std::atomic<IClock*> clock{&steadyClock()};
+        return clock;
+    }
+
+    static IClock*& threadOverride() {
+        thread_local IClock* clock = nullptr;
+        return clock;
+    }
+
+    static std::mutex& retainedMutex() {
+        static std::mutex mutex;
+        return mutex;
+    }
+
+    static std::vector<std::shared_ptr<IClock>>& retainedClocks() {
+        static std::vector<std::shared_ptr<IClock>> clocks;
+        return clocks;
+    }
+};
+
+} // namespace WeaponControl
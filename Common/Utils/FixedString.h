@@ -0,0 +1,160 @@
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdio>
+#include <ostream>
+#include <string>
+#include <string_view>
+#include <type_traits>
+
+namespace WeaponControl {
+
+// =============================================================================
+// 고정 용량 문자열 - 할당 없는 진단 메시지 작성
+//
+// 내부 배열에 직접 기록하며 용량을 넘는 부분은 잘라낸다 (truncated() 로
+// 확인). 정수/실수 변환도 snprintf 로 배열에 기록하므로 힙을 사용하지
+// 않는다. 로그 출력은 std::ostream 에, 기존 std::string 연결식에는
+// operator+ 로 그대로 사용할 수 있다.
+// =============================================================================
+
+template <size_t Capacity>
+class FixedString {
+public:
+    static constexpr size_t capacity() { return Capacity; }
+
+    FixedString() = default;
+    FixedString(std::string_view text) { append(text); }
+    FixedString(const char* text) { append(std::string_view(text ? text : "")); }
+    FixedString(const std::string& text) { append(std::string_view(text)); }
+
+    FixedString& operator=(std::string_view text) {
+        clear();
+        return append(text);
+    }
+
+    void clear() {
+        m_size = 0;
+        m_truncated = false;
+        m_data[0] = '\0';
+    }
+
+    FixedString& append(std::string_view text) {
+        size_t count = std::min(text.size(), Capacity - m_size);
+        if (count < text.size()) {
+            m_truncated = true;
+        }
+        text.copy(m_data + m_size, count);
+        m_size += count;
+        m_data[m_size] = '\0';
+        return *this;
+    }
+
+    FixedString& append(char c) {
+        return append(std::string_view(&c, 1));
+    }
+
+    // 실수는 고정 소수점 precision 자리
+    FixedString& appendFixed(double value, int precision) {
+        char number[64];
+        int length = std::snprintf(number, sizeof(number), "%.*f", precision, value);
+        return appendFormatted(number, length);
+    }
+
+    FixedString& appendHex(unsigned long long value) {
+        char number[32];
+        int length = std::snprintf(number, sizeof(number), "%llx", value);
+        return appendFormatted(number, length);
+    }
+
+    template <typename T>
+    FixedString& operator<<(const T& value) {
+        if constexpr (std::is_same_v<T, bool>) {
+            return append(value ? std::string_view("true") : std::string_view("false"));
+        } else if constexpr (std::is_same_v<T, char>) {
+            return append(value);
+        } else if constexpr (std::is_enum_v<T>) {
+            return *this << static_cast<std::underlying_type_t<T>>(value);
+        } else if constexpr (std::is_integral_v<T> && std::is_signed_v<T>) {
+            char number[32];
+            int length = std::snprintf(number, sizeof(number), "%lld", static_cast<long long>(value));
+            return appendFormatted(number, length);
+        } else if constexpr (std::is_integral_v<T>) {
+            char number[32];
+            int length = std::snprintf(number, sizeof(number), "%llu", static_cast<unsigned long long>(value));
+            return appendFormatted(number, length);
+        } else if constexpr (std::is_floating_point_v<T>) {
+            char number[64];
+            int length = std::snprintf(number, sizeof(number), "%g", static_cast<double>(value));
+            return appendFormatted(number, length);
+        } else {
+            return append(std::string_view(value));
+        }
+    }
+
+    const char* c_str() const { return m_data; }
+    std::string_view view() const { return std::string_view(m_data, m_size); }
+    size_t size() const { return m_size; }
+    bool empty() const { return m_size == 0; }
+    bool truncated() const { return m_truncated; }
+
+    operator std::string_view() const { return view(); }
+    std::string str() const { return std::string(m_data, m_size); }
+
+private:
+    FixedString& appendFormatted(const char* text, int length) {
+        if (length <= 0) {
+            return *this;
+        }
+        return append(std::string_view(text, static_cast<size_t>(length)));
+    }
+
+    char m_data[Capacity + 1] = {};
+    size_t m_size = 0;
+    bool m_truncated = false;
+};
+
+// 인자를 차례로 기록한 고정 문자열 생성
+template <size_t Capacity, typename... Args>
+FixedString<Capacity> formatFixed(const Args&... args) {
+    FixedString<Capacity> text;
+    (text << ... << args);
+    return text;
+}
+
+template <size_t Capacity>
+std::ostream& operator<<(std::ostream& out, const FixedString<Capacity>& text) {
+    return out << text.view();
+}
+
+template <size_t Capacity>
+bool operator==(const FixedString<Capacity>& lhs, std::string_view rhs) {
+    return lhs.view() == rhs;
+}
+
+template <size_t Capacity>
+bool operator!=(const FixedString<Capacity>& lhs, std::string_view rhs) {
+    return lhs.view() != rhs;
+}
+
+// 기존 std::string 연결식 호환 (초기화/오류 경로용, 결과는 std::string)
+template <size_t Capacity>
+std::string operator+(std::string lhs, const FixedString<Capacity>& rhs) {
+    lhs.append(rhs.view());
+    return lhs;
+}
+
+template <size_t Capacity>
+std::string operator+(const char* lhs, const FixedString<Capacity>& rhs) {
+    return std::string(lhs) + rhs;
+}
+
+template <size_t Capacity>
+std::string operator+(const FixedString<Capacity>& lhs, std::string_view rhs) {
+    std::string text(lhs.view());
+    text.append(rhs);
+    return text;
+}
+
+} // namespace WeaponControl
@@ -1,10 +1,102 @@
 #include "IEngagementManager.h"
 #include "../../Infrastructure/Configuration/SystemConfig.h"
+#include "../../Infrastructure/Diagnostics/StageProfiler.h"
+#include "../../Infrastructure/Diagnostics/TraceRecorder.h"
 #include <cmath>
+#include <cstring>
 #include <iostream>
 
 namespace WeaponControl {
 
+// =============================================================================
+// 교전계획 내용 해시
+// =============================================================================
+
+namespace {
+
+class PlanHasher {
+public:
+    void mix(uint64_t word) {
+        m_hash = (m_hash ^ word) * 0x9E3779B97F4A7C15ull;
+        m_hash ^= m_hash >> 32;
+    }
+    
+    template<typename T>
+    void mixValue(const T& value) {
+        static_assert(sizeof(T) <= sizeof(uint64_t), "mixValue() requires a scalar");
+        uint64_t word = 0;
+        std::memcpy(&word, &value, sizeof(T));
+        mix(word);
+    }
+    
+    template<typename Point>
+    void mixPoint(const Point& point) {
+        mixValue(point.dLatitude());
+        mixValue(point.dLongitude());
+        mixValue(point.fDepth());
+    }
+    
+    uint64_t value() const { return m_hash; }
+    
+private:
+    uint64_t m_hash = 0xCBF29CE484222325ull;
+};
+
+} // namespace
+
+uint64_t HashEngagementPlanContent(const EngagementPlanResult& result) {
+    PlanHasher hasher;
+    hasher.mixValue(result.weaponKind);
+    hasher.mixValue(result.isValid);
+    hasher.mixValue(result.totalTime_sec);
+    hasher.mixValue(result.timeToTarget_sec);
+    hasher.mixValue(result.nextWaypointIndex);
+    hasher.mixValue(result.timeToNextWaypoint_sec);
+    hasher.mixPoint(result.launchPosition);
+    hasher.mixPoint(result.targetPosition);
+    
+    // 길이를 함께 섞어 궤적/경로점 경계가 바뀐 경우를 구분
+    hasher.mixValue(result.trajectory.size());
+    for (const auto& point : result.trajectory) {
+        hasher.mixPoint(point);
+    }
+    hasher.mixValue(result.waypoints.size());
+    for (const auto& waypoint : result.waypoints) {
+        hasher.mixPoint(waypoint);
+    }
+    
+    return hasher.value();
+}
+
+namespace {
+
+// System.EngagementPlanSummaryCompare 를 켠 경우의 변경 판정 값: 시간 요약,
+// 발사/표적 위치, 궤적 길이와 양 끝점, 경로점(최대 8개)만 섞는다 (궤적 중간점을
+// 훑지 않음). 경로점 외의 입력으로 중간점만 바뀌는 계산은 놓칠 수 있다.
+uint64_t FingerprintEngagementPlanSummary(const EngagementPlanResult& result) {
+    PlanHasher hasher;
+    hasher.mixValue(result.weaponKind);
+    hasher.mixValue(result.isValid);
+    hasher.mixValue(result.totalTime_sec);
+    hasher.mixValue(result.timeToTarget_sec);
+    hasher.mixValue(result.nextWaypointIndex);
+    hasher.mixValue(result.timeToNextWaypoint_sec);
+    hasher.mixPoint(result.launchPosition);
+    hasher.mixPoint(result.targetPosition);
+    hasher.mixValue(result.trajectory.size());
+    if (!result.trajectory.empty()) {
+        hasher.mixPoint(result.trajectory.front());
+        hasher.mixPoint(result.trajectory.back());
+    }
+    hasher.mixValue(result.waypoints.size());
+    for (const auto& waypoint : result.waypoints) {
+        hasher.mixPoint(waypoint);
+    }
+    return hasher.value();
+}
+
+} // namespace
+
 // =============================================================================
 // EngagementManagerBase 구현
 // =============================================================================
@@ -14,9 +106,23 @@ EngagementManagerBase::EngagementManagerBase(EN_WPN_KIND weaponKind)
     , m_weaponKind(weaponKind)
     , m_launched(false)
     , m_axisCenter{0.0, 0.0}
+    , m_planGeneration(0)
+    , m_planContentHash(0)
+    , m_planValid(false)
+    , m_planSummaryCompare(SystemConfig::getInstance().isEngagementPlanSummaryCompareEnabled())
+    , m_planFingerprint(0)
     , m_launchTime(0.0f)
-    , m_launchStartTime(std::chrono::steady_clock::now())
+    , m_launchStartTime(ClockProvider::get().now())
 {
+    // 궤적 재계산 시 재할당이 없도록 최대 크기로 예약
+    m_engagementResult.trajectory.reserve(MAX_TRAJECTORY_POINTS);
+    m_engagementResult.waypoints.reserve(MAX_PLAN_WAYPOINTS);
+    
+    // 초기 계획의 판정 값 (세대 0)
+    m_planFingerprint = m_planSummaryCompare
+        ? FingerprintEngagementPlanSummary(m_engagementResult)
+        : HashEngagementPlanContent(m_engagementResult);
+    m_planContentHash.store(m_planSummaryCompare ? 0 : m_planFingerprint, std::memory_order_relaxed);
     std::cout << "EngagementManagerBase created for " << WeaponKindToString(weaponKind) << std::endl;
 }
 
@@ -29,6 +135,7 @@ Result<void> EngagementManagerBase::initialize(uint16_t tubeNumber, EN_WPN_KIND
     m_engagementResult.tubeNumber = tubeNumber;
     m_engagementResult.weaponKind = weaponKind;
     m_engagementResult.isValid = false;
+    commitPlan();
     
     std::cout << "EngagementManager initialized for tube " << tubeNumber 
               << " with weapon " << WeaponKindToString(weaponKind) << std::endl;
@@ -39,7 +146,7 @@ Result<void> EngagementManagerBase::initialize(uint16_t tubeNumber, EN_WPN_KIND
 void EngagementManagerBase::reset() {
     m_launched = false;
     m_launchTime = 0.0f;
-    m_launchStartTime = std::chrono::steady_clock::now();
+    m_launchStartTime = ClockProvider::get().now();
     
     // 교전계획 결과 초기화
     m_engagementResult = EngagementPlanResult();
@@ -48,14 +155,69 @@ void EngagementManagerBase::reset() {
     
     // 경로점 및 위치 정보 초기화
     m_waypoints.clear();
+    m_engagementResult.waypoints.reserve(MAX_PLAN_WAYPOINTS);
+    commitPlan();
     
     std::cout << "EngagementManager reset for tube " << m_tubeNumber << std::endl;
 }
 
+void EngagementManagerBase::setLaunched(bool launched) {
+    if (launched && !m_launched) {
+        // 발사 시점부터 비행 시간 계산
+        m_launchStartTime = ClockProvider::get().now();
+    }
+    m_launched = launched;
+}
+
+void EngagementManagerBase::commitPlan() {
+    m_planValid.store(m_engagementResult.isValid, std::memory_order_relaxed);
+    
+    // 경로점은 입력 내용으로 비교한다. 같은 경로점을 다시 넣으면 판정 값도 같다.
+    // (예약 용량 안에서 복사하므로 할당 없음)
+    m_engagementResult.waypoints.assign(m_waypoints.begin(), m_waypoints.end());
+    
+    // 기본은 궤적 전체, 요약 판정을 켜면 양 끝점과 경로점만 비교한다.
+    uint64_t fingerprint = m_planSummaryCompare
+        ? FingerprintEngagementPlanSummary(m_engagementResult)
+        : HashEngagementPlanContent(m_engagementResult);
+    if (fingerprint == m_planFingerprint) {
+        return;
+    }
+    m_planFingerprint = fingerprint;
+    
+    // 세대는 계획을 고치는 스레드만 증가시킨다. 해시를 먼저 저장하고 세대를
+    // release 로 올려, acquire 로 새 세대를 본 스레드가 새 해시를 보게 한다.
+    if (!m_planSummaryCompare) {
+        m_planContentHash.store(fingerprint, std::memory_order_relaxed);
+    }
+    m_planGeneration.store(m_planGeneration.load(std::memory_order_relaxed) + 1, std::memory_order_release);
+}
+
+bool EngagementManagerBase::getTrackingProfile(TrackingProfile& profile) const {
+    TrackingInterpolation interpolation = trackingInterpolation();
+    if (!m_launched || interpolation == TrackingInterpolation::NONE) {
+        return false;
+    }
+    
+    profile.launchStartTime = m_launchStartTime;
+    profile.totalTime_sec = m_engagementResult.totalTime_sec;
+    profile.trajectory = &m_engagementResult.trajectory;
+    profile.interpolation = interpolation;
+    return true;
+}
+
+MemoryFootprint EngagementManagerBase::getMemoryFootprint() const {
+    MemoryFootprint footprint;
+    footprint.trajectoryBytes = ContainerCapacityBytes(m_engagementResult.trajectory);
+    footprint.waypointBytes = ContainerCapacityBytes(m_engagementResult.waypoints)
+                            + ContainerCapacityBytes(m_waypoints);
+    return footprint;
+}
+
 void EngagementManagerBase::update() {
     if (m_launched) {
         // 발사 후 위치 추적
-        auto now = std::chrono::steady_clock::now();
+        auto now = ClockProvider::get().now();
         float timeSinceLaunch = std::chrono::duration<float>(now - m_launchStartTime).count();
         m_engagementResult.currentPosition = interpolatePosition(timeSinceLaunch);
     }
@@ -142,7 +304,11 @@ Result<void> MineEngagementManagerBase::getDropPlan(ST_M_MINE_PLAN_INFO& planInf
 
 Result<void> MineEngagementManagerBase::calculateEngagementPlan() {
     // 자항기뢰 교전계획 계산
-    return calculateTrajectory();
+    ScopedStageTimer stageTimer(ProfileStage::TRAJECTORY);
+    ScopedTrace trace(TraceCategory::PLAN, "calculateTrajectory");
+    auto result = calculateTrajectory();
+    commitPlan();
+    return result;
 }
 
 Result<AIEP_M_MINE_EP_RESULT> MineEngagementManagerBase::getMineEngagementResult() const {
@@ -165,7 +331,7 @@ Result<AIEP_M_MINE_EP_RESULT> MineEngagementManagerBase::getMineEngagementResult
     
     // 궤적 정보
     result.unCntTrajectory() = m_engagementResult.trajectory.size();
-    for (size_t i = 0; i < m_engagementResult.trajectory.size() && i < 128; ++i) {
+    for (size_t i = 0; i < m_engagementResult.trajectory.size() && i < MAX_TRAJECTORY_POINTS; ++i) {
         result.stTrajectories()[i] = m_engagementResult.trajectory[i];
     }
     
@@ -250,11 +416,16 @@ bool MissileEngagementManagerBase::hasValidTarget() const {
 Result<void> MissileEngagementManagerBase::calculateEngagementPlan() {
     if (!m_hasValidTarget) {
         m_engagementResult.isValid = false;
+        commitPlan();
         return Result<void>::failure("No valid target set");
     }
     
     // 미사일 교전계획 계산
-    return calculateTrajectory();
+    ScopedStageTimer stageTimer(ProfileStage::TRAJECTORY);
+    ScopedTrace trace(TraceCategory::PLAN, "calculateTrajectory");
+    auto result = calculateTrajectory();
+    commitPlan();
+    return result;
 }
 
 Result<AIEP_ALM_ASM_EP_RESULT> MissileEngagementManagerBase::getMissileEngagementResult() const {
@@ -275,7 +446,7 @@ Result<AIEP_ALM_ASM_EP_RESULT> MissileEngagementManagerBase::getMissileEngagemen
     
     // 궤적 정보
     result.unCntTrajectory() = m_engagementResult.trajectory.size();
-    for (size_t i = 0; i < m_engagementResult.trajectory.size() && i < 128; ++i) {
+    for (size_t i = 0; i < m_engagementResult.trajectory.size() && i < MAX_TRAJECTORY_POINTS; ++i) {
         result.stTrajectories()[i] = m_engagementResult.trajectory[i];
     }
     
@@ -1,11 +1,42 @@
 #pragma once
 
 #include "../../Common/Types/CommonTypes.h"
+#include "../../Infrastructure/Diagnostics/MemoryAccounting.h"
+#include <atomic>
 #include <memory>
 #include <chrono>
+#include <vector>
 
 namespace WeaponControl {
 
+// =============================================================================
+// 발사 후 추적 일괄 처리용 정보 (PostLaunchTracker)
+// =============================================================================
+
+enum class TrackingInterpolation : uint8_t {
+    NONE = 0,       // 일괄 처리 불가 - update() 에서 개별 보간
+    ENDPOINTS,      // 궤적 시작점 -> 끝점 선형 보간
+    SEGMENTED       // 궤적 구간을 균등 시간으로 나누어 구간별 선형 보간
+};
+
+struct TrackingProfile {
+    std::chrono::steady_clock::time_point launchStartTime;
+    float totalTime_sec = 0.0f;
+    const std::vector<ST_3D_GEODETIC_POSITION>* trajectory = nullptr;
+    TrackingInterpolation interpolation = TrackingInterpolation::NONE;
+};
+
+// =============================================================================
+// 교전계획 내용 해시
+//
+// 시각에 따라 바뀌는 발사 후 현재 위치를 제외한 계획 내용(무장 종류, 유효 여부,
+// 시간 요약, 다음 경로점, 발사/표적 위치, 궤적, 경로점)을 8바이트 단위로 섞는다.
+// 재계산마다 호출하여 변경을 판정한다 (System.EngagementPlanSummaryCompare 가
+// 켜져 있으면 궤적을 훑지 않는 요약 비교, EngagementManagerBase::commitPlan).
+// =============================================================================
+
+uint64_t HashEngagementPlanContent(const EngagementPlanResult& result);
+
 // =============================================================================
 // 기본 교전계획 관리자 인터페이스
 // =============================================================================
@@ -27,6 +58,18 @@ public:
     virtual EngagementPlanResult getEngagementResult() const = 0;
     virtual bool isEngagementPlanValid() const = 0;
     
+    // 호출자 버퍼에 복사 (기존 용량 재사용, 주기 경로용)
+    virtual void copyEngagementResult(EngagementPlanResult& out) const { out = getEngagementResult(); }
+    
+    // 현재 결과 참조 (복사 없음, 다음 계산/리셋 전까지 유효)
+    virtual const EngagementPlanResult& getEngagementResultRef() const = 0;
+    
+    // 교전계획 세대 - 계획 내용이 바뀔 때마다 1 증가. 내용 해시는
+    // System.EngagementPlanSummaryCompare 가 켜져 있으면 0 이다.
+    // 다른 스레드에서 읽을 수 있으며, 세대를 읽은 뒤의 내용 해시는 그 세대 이후 값이다.
+    virtual uint64_t getPlanGeneration() const = 0;
+    virtual uint64_t getPlanContentHash() const = 0;
+    
     // ==========================================================================
     // 환경 정보 업데이트
     // ==========================================================================
@@ -56,13 +99,24 @@ public:
     // ==========================================================================
     virtual uint16_t getTubeNumber() const = 0;
     virtual EN_WPN_KIND getWeaponKind() const = 0;
+    
+    // ==========================================================================
+    // 발사 후 추적 일괄 처리 (지원 시 true, 결과는 setTrackedPosition 으로 반영)
+    // ==========================================================================
+    virtual bool getTrackingProfile(TrackingProfile& profile) const { return false; }
+    virtual void setTrackedPosition(const ST_3D_GEODETIC_POSITION& position) {}
+    
+    // ==========================================================================
+    // 메모리 사용량
+    // ==========================================================================
+    virtual MemoryFootprint getMemoryFootprint() const { return {}; }
 };
 
 // =============================================================================
 // 자항기뢰 전용 교전계획 관리자 인터페이스
 // =============================================================================
 
-class IMineEngagementManager : public IEngagementManager {
+class IMineEngagementManager : public virtual IEngagementManager {
 public:
     virtual ~IMineEngagementManager() = default;
     
@@ -91,7 +145,7 @@ public:
 // 미사일 전용 교전계획 관리자 인터페이스 (ALM, ASM, AAM)
 // =============================================================================
 
-class IMissileEngagementManager : public IEngagementManager {
+class IMissileEngagementManager : public virtual IEngagementManager {
 public:
     virtual ~IMissileEngagementManager() = default;
     
@@ -125,7 +179,7 @@ public:
 // 교전계획 관리자 기반 클래스
 // =============================================================================
 
-class EngagementManagerBase : public IEngagementManager {
+class EngagementManagerBase : public virtual IEngagementManager {
 public:
     explicit EngagementManagerBase(EN_WPN_KIND weaponKind);
     virtual ~EngagementManagerBase() = default;
@@ -139,17 +193,29 @@ public:
     void setAxisCenter(const GEO_POINT_2D& axisCenter) override { m_axisCenter = axisCenter; }
     void updateOwnShipInfo(const NAVINF_SHIP_NAVIGATION_INFO& ownShip) override { m_ownShipInfo = ownShip; }
     
-    void setLaunched(bool launched) override { m_launched = launched; }
+    void setLaunched(bool launched) override;
     bool isLaunched() const override { return m_launched; }
     
     EngagementPlanResult getEngagementResult() const override { return m_engagementResult; }
-    bool isEngagementPlanValid() const override { return m_engagementResult.isValid; }
+    void copyEngagementResult(EngagementPlanResult& out) const override { out = m_engagementResult; }
+    const EngagementPlanResult& getEngagementResultRef() const override { return m_engagementResult; }
+    bool isEngagementPlanValid() const override { return m_planValid.load(std::memory_order_relaxed); }
+    
+    uint64_t getPlanGeneration() const override { return m_planGeneration.load(std::memory_order_acquire); }
+    uint64_t getPlanContentHash() const override { return m_planContentHash.load(std::memory_order_relaxed); }
     
     uint16_t getTubeNumber() const override { return m_tubeNumber; }
     EN_WPN_KIND getWeaponKind() const override { return m_weaponKind; }
     
     void update() override;
     
+    bool getTrackingProfile(TrackingProfile& profile) const override;
+    void setTrackedPosition(const ST_3D_GEODETIC_POSITION& position) override {
+        m_engagementResult.currentPosition = position;
+    }
+    
+    MemoryFootprint getMemoryFootprint() const override;
+    
 protected:
     // ==========================================================================
     // 파생 클래스에서 구현해야 할 순수 가상 함수
@@ -157,12 +223,18 @@ protected:
     virtual Result<void> calculateTrajectory() = 0;
     virtual ST_3D_GEODETIC_POSITION interpolatePosition(float timeSinceLaunch) const = 0;
     
+    // interpolatePosition 과 같은 결과를 내는 일괄 보간 방식 (없으면 NONE)
+    virtual TrackingInterpolation trackingInterpolation() const { return TrackingInterpolation::NONE; }
+    
     // ==========================================================================
     // 유틸리티 함수
     // ==========================================================================
     double calculateDistance(const ST_3D_GEODETIC_POSITION& p1, const ST_3D_GEODETIC_POSITION& p2) const;
     double calculateBearing(const ST_3D_GEODETIC_POSITION& from, const ST_3D_GEODETIC_POSITION& to) const;
     
+    // 계산/리셋 후 경로점 입력을 결과에 반영하고 변경 판정 값 갱신, 바뀌었으면 세대 증가
+    void commitPlan();
+    
     // ==========================================================================
     // 멤버 변수
     // ==========================================================================
@@ -172,6 +244,11 @@ protected:
     
     GEO_POINT_2D m_axisCenter;
     EngagementPlanResult m_engagementResult;
+    std::atomic<uint64_t> m_planGeneration;      // 해시 저장 후 release 로 증가
+    std::atomic<uint64_t> m_planContentHash;
+    std::atomic<bool> m_planValid;               // 상태 조회 스레드용 유효 여부 (commitPlan 에서 갱신)
+    bool m_planSummaryCompare;                   // 전체 내용 해시 대신 요약으로 판정
+    uint64_t m_planFingerprint;                  // 마지막 commitPlan 의 변경 판정 값
     
     std::vector<ST_WEAPON_WAYPOINT> m_waypoints;
     ST_3D_GEODETIC_POSITION m_launchPosition;
@@ -144,6 +144,10 @@ protected:
         return Result<void>::success();
     }
     
+    TrackingInterpolation trackingInterpolation() const override {
+        return TrackingInterpolation::ENDPOINTS;
+    }
+    
     ST_3D_GEODETIC_POSITION interpolatePosition(float timeSinceLaunch) const override {
         // 시간에 따른 위치 보간 (임시 구현)
         if (m_engagementResult.trajectory.size() < 2) {
@@ -210,6 +214,10 @@ protected:
         return Result<void>::success();
     }
     
+    TrackingInterpolation trackingInterpolation() const override {
+        return TrackingInterpolation::ENDPOINTS;
+    }
+    
     ST_3D_GEODETIC_POSITION interpolatePosition(float timeSinceLaunch) const override {
         // ASM 위치 보간 (임시 구현)
         if (m_engagementResult.trajectory.size() < 2) {
@@ -273,6 +281,10 @@ protected:
         return Result<void>::success();
     }
     
+    TrackingInterpolation trackingInterpolation() const override {
+        return TrackingInterpolation::ENDPOINTS;
+    }
+    
     ST_3D_GEODETIC_POSITION interpolatePosition(float timeSinceLaunch) const override {
         if (m_engagementResult.trajectory.size() < 2) {
             return ST_3D_GEODETIC_POSITION();
@@ -343,6 +355,10 @@ protected:
         return Result<void>::success();
     }
     
+    TrackingInterpolation trackingInterpolation() const override {
+        return TrackingInterpolation::SEGMENTED;
+    }
+    
     ST_3D_GEODETIC_POSITION interpolatePosition(float timeSinceLaunch) const override {
         // 자항기뢰 위치 보간 (경로점을 따라 이동)
         if (m_engagementResult.trajectory.size() < 2) {
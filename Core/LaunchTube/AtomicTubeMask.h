@@ -0,0 +1,126 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+
+namespace WeaponControl {
+
+// =============================================================================
+// 비트 연산 헬퍼
+// =============================================================================
+
+inline unsigned CountTrailingZeros64(uint64_t value) {
+#if defined(__GNUC__) || defined(__clang__)
+    return static_cast<unsigned>(__builtin_ctzll(value));
+#else
+    unsigned count = 0;
+    while ((value & 1) == 0) {
+        value >>= 1;
+        ++count;
+    }
+    return count;
+#endif
+}
+
+inline unsigned PopCount64(uint64_t value) {
+#if defined(__GNUC__) || defined(__clang__)
+    return static_cast<unsigned>(__builtin_popcountll(value));
+#else
+    unsigned count = 0;
+    for (; value != 0; value &= value - 1) {
+        ++count;
+    }
+    return count;
+#endif
+}
+
+// 워드 하나의 설정된 비트를 발사관 번호로 변환하여 방문
+template <typename Visitor>
+void ForEachTubeBit(uint64_t bits, size_t word, Visitor&& visitor) {
+    while (bits != 0) {
+        unsigned bit = CountTrailingZeros64(bits);
+        bits &= bits - 1;
+        visitor(static_cast<uint16_t>(word * 64 + bit));
+    }
+}
+
+// =============================================================================
+// 발사관 번호 비트마스크 (비트 n = 발사관 n, 잠금 없이 갱신/순회)
+// =============================================================================
+
+class AtomicTubeMask {
+public:
+    explicit AtomicTubeMask(uint16_t maxTubeNumber)
+        : m_wordCount(maxTubeNumber / 64 + 1)
+        , m_words(new std::atomic<uint64_t>[m_wordCount])
+    {
+        for (size_t i = 0; i < m_wordCount; ++i) {
+            m_words[i].store(0, std::memory_order_relaxed);
+        }
+    }
+
+    AtomicTubeMask(const AtomicTubeMask&) = delete;
+    AtomicTubeMask& operator=(const AtomicTubeMask&) = delete;
+
+    void set(uint16_t tubeNumber, bool value) {
+        uint64_t bit = uint64_t(1) << (tubeNumber % 64);
+        auto& word = m_words[tubeNumber / 64];
+        if (value) {
+            word.fetch_or(bit, std::memory_order_release);
+        } else {
+            word.fetch_and(~bit, std::memory_order_release);
+        }
+    }
+
+    bool test(uint16_t tubeNumber) const {
+        uint64_t bit = uint64_t(1) << (tubeNumber % 64);
+        return (m_words[tubeNumber / 64].load(std::memory_order_acquire) & bit) != 0;
+    }
+
+    size_t wordCount() const { return m_wordCount; }
+
+    uint64_t loadWord(size_t word) const {
+        return m_words[word].load(std::memory_order_acquire);
+    }
+
+    // 워드를 읽고 비움 (한 번만 처리할 표시용)
+    uint64_t takeWord(size_t word) {
+        return m_words[word].exchange(0, std::memory_order_acq_rel);
+    }
+
+    void orWord(size_t word, uint64_t bits) {
+        if (bits != 0) {
+            m_words[word].fetch_or(bits, std::memory_order_release);
+        }
+    }
+
+    // 다른 마스크의 설정된 비트를 모두 추가
+    void setAll(const AtomicTubeMask& other) {
+        for (size_t word = 0; word < m_wordCount && word < other.m_wordCount; ++word) {
+            orWord(word, other.loadWord(word));
+        }
+    }
+
+    size_t count() const {
+        size_t total = 0;
+        for (size_t word = 0; word < m_wordCount; ++word) {
+            total += PopCount64(m_words[word].load(std::memory_order_relaxed));
+        }
+        return total;
+    }
+
+    template <typename Visitor>
+    void forEach(Visitor&& visitor) const {
+        for (size_t word = 0; word < m_wordCount; ++word) {
+            ForEachTubeBit(loadWord(word), word, visitor);
+        }
+    }
+
+private:
+    size_t m_wordCount;
+    std::unique_ptr<std::atomic<uint64_t>[]> m_words;
+};
+
+} // namespace WeaponControl
@@ -2,12 +2,62 @@
 
 #include "../Weapons/IWeapon.h"
 #include "../EngagementManagers/IEngagementManager.h"
+#include "PostLaunchTracker.h"
 #include "../../Common/Types/CommonTypes.h"
+#include "../../Infrastructure/Diagnostics/StageProfiler.h"
+#include "../../Infrastructure/Diagnostics/MetricsRegistry.h"
+#include "../../Infrastructure/Diagnostics/TraceRecorder.h"
 #include <memory>
 #include <functional>
+#include <iostream>
 
 namespace WeaponControl {
 
+// =============================================================================
+// 발사관 주기 갱신 필요 분류
+// =============================================================================
+
+enum class TubeActivity : uint8_t {
+    IDLE = 0,               // OFF/ABORT - 입력 변경 시에만 교전계획 재계산
+    SEQUENCING,             // POC/LAUNCH 진행 중
+    INTERLOCK_MONITOR,      // ON/RTL - 인터록 조건 및 교전계획 감시
+    POST_LAUNCH_TRACKING    // 발사 후 위치 추적
+};
+
+inline TubeActivity ActivityForState(EN_WPN_CTRL_STATE state) {
+    switch (state) {
+        case EN_WPN_CTRL_STATE::WPN_CTRL_STATE_POC:
+        case EN_WPN_CTRL_STATE::WPN_CTRL_STATE_LAUNCH:
+            return TubeActivity::SEQUENCING;
+        case EN_WPN_CTRL_STATE::WPN_CTRL_STATE_ON:
+        case EN_WPN_CTRL_STATE::WPN_CTRL_STATE_RTL:
+            return TubeActivity::INTERLOCK_MONITOR;
+        case EN_WPN_CTRL_STATE::WPN_CTRL_STATE_POST_LAUNCH:
+            return TubeActivity::POST_LAUNCH_TRACKING;
+        default:
+            return TubeActivity::IDLE;
+    }
+}
+
+// 재시작 후 복원할 상태 - 중단된 절차는 이어갈 수 없으므로 POC 는 OFF,
+// LAUNCH 는 ABORT 로 둔다. RTL 은 ON 으로 두고 다음 주기 인터록 확인에 맡긴다.
+inline EN_WPN_CTRL_STATE RestoredWeaponState(EN_WPN_CTRL_STATE state, bool launched) {
+    if (launched) {
+        return EN_WPN_CTRL_STATE::WPN_CTRL_STATE_POST_LAUNCH;
+    }
+    
+    switch (state) {
+        case EN_WPN_CTRL_STATE::WPN_CTRL_STATE_ON:
+        case EN_WPN_CTRL_STATE::WPN_CTRL_STATE_RTL:
+            return EN_WPN_CTRL_STATE::WPN_CTRL_STATE_ON;
+        case EN_WPN_CTRL_STATE::WPN_CTRL_STATE_LAUNCH:
+        case EN_WPN_CTRL_STATE::WPN_CTRL_STATE_ABORT:
+            return EN_WPN_CTRL_STATE::WPN_CTRL_STATE_ABORT;
+        default:
+            return EN_WPN_CTRL_STATE::WPN_CTRL_STATE_OFF;
+    }
+}
+
 // =============================================================================
 // 개별 발사관 클래스 (단순화된 컨테이너 역할)
 // =============================================================================
@@ -22,6 +72,9 @@ public:
     // ==========================================================================
     uint16_t getTubeNumber() const { return m_tubeNumber; }
     bool hasWeapon() const { return m_weapon != nullptr; }
+    TubeActivity getActivity() const {
+        return hasWeapon() ? ActivityForState(m_weapon->getCurrentState()) : TubeActivity::IDLE;
+    }
     
     // ==========================================================================
     // 무장 관리
@@ -48,6 +101,7 @@ public:
     // 무장 통제 (위임)
     // ==========================================================================
     Result<void> requestWeaponStateChange(EN_WPN_CTRL_STATE newState, const CancellationToken& token = {});
+    Result<void> restoreWeaponState(EN_WPN_CTRL_STATE state);   // 체크포인트 복원 (RestoredWeaponState 적용 후)
     EN_WPN_CTRL_STATE getWeaponState() const;
     bool isLaunched() const;
     
@@ -55,18 +109,20 @@ public:
     // 경로점 관리 (위임)
     // ==========================================================================
     Result<void> updateWaypoints(const std::vector<ST_WEAPON_WAYPOINT>& waypoints);
+    std::vector<ST_WEAPON_WAYPOINT> getWaypoints() const;   // 미사일: 편집 경로점, 자항기뢰: 부설계획 경로점
     
     // ==========================================================================
     // 교전계획 (위임)
     // ==========================================================================
     Result<void> calculateEngagementPlan();
     EngagementPlanResult getEngagementResult() const;
+    void copyEngagementResult(EngagementPlanResult& out) const;    // 호출자 버퍼 재사용 (궤적 용량 유지)
     bool isEngagementPlanValid() const;
     
     // ==========================================================================
-    // 주기적 업데이트
+    // 주기적 업데이트 (tracker 가 주어지면 발사 후 위치 계산을 일괄 처리기에 위임)
     // ==========================================================================
-    void update();
+    void update(PostLaunchTracker* tracker = nullptr);
     
     // ==========================================================================
     // IStateObserver 구현
@@ -85,6 +141,9 @@ public:
     // 상태 정보 (단순화)
     // ==========================================================================
     LaunchTubeStatus getStatus() const;
+    
+    // 현재 할당이 보유한 동적 메모리 (무장 + 교전계획)
+    MemoryFootprint getMemoryFootprint() const;
 
 private:
     // ==========================================================================
@@ -101,8 +160,12 @@ private:
     std::function<void(uint16_t, bool)> m_launchStatusCallback;
     std::function<void(uint16_t, const EngagementPlanResult&)> m_engagementPlanCallback;
     
-    // 마지막 교전계획 결과 (변화 감지용)
-    mutable EngagementPlanResult m_lastEngagementResult;
+    // 마지막으로 통지한 교전계획 세대 (변화 감지용)
+    uint64_t m_notifiedPlanGeneration;
+    
+    // 교전계획 재계산 지표 (생성 시 등록, 주기 중 조회 없음)
+    MetricCounter& m_recomputeSuccess;
+    MetricCounter& m_recomputeFailure;
     
     // ==========================================================================
     // 헬퍼 함수들
@@ -120,6 +183,11 @@ inline LaunchTube::LaunchTube(uint16_t tubeNumber)
     : m_tubeNumber(tubeNumber)
     , m_weapon(nullptr)
     , m_engagementMgr(nullptr)
+    , m_notifiedPlanGeneration(0)
+    , m_recomputeSuccess(MetricsRegistry::getInstance().counter(
+          "engagement_plan_recompute_total", "Engagement plan recomputations", "result=\"success\""))
+    , m_recomputeFailure(MetricsRegistry::getInstance().counter(
+          "engagement_plan_recompute_total", "Engagement plan recomputations", "result=\"failure\""))
 {
     std::cout << "LaunchTube " << tubeNumber << " created" << std::endl;
 }
@@ -130,7 +198,8 @@ inline Result<void> LaunchTube::assignWeapon(WeaponPtr weapon, EngagementManager
     }
     
     if (hasWeapon()) {
-        return Result<void>::failure("Tube " + std::to_string(m_tubeNumber) + " already has assigned weapon");
+        return Result<void>::failure(formatFixed<ERROR_MESSAGE_CAPACITY>(
+            "Tube ", m_tubeNumber, " already has assigned weapon"));
     }
     
     if (assignmentInfo.tubeNumber != m_tubeNumber) {
@@ -146,15 +215,18 @@ inline Result<void> LaunchTube::assignWeapon(WeaponPtr weapon, EngagementManager
     auto weaponResult = m_weapon->initialize(m_tubeNumber);
     if (!weaponResult) {
         clearAssignment();
-        return Result<void>::failure("Failed to initialize weapon: " + weaponResult.error().message);
+        return Result<void>::failure(formatFixed<ERROR_MESSAGE_CAPACITY>(
+            "Failed to initialize weapon: ", weaponResult.error().message));
     }
     
     // 교전계획 관리자 초기화
     auto engagementResult = m_engagementMgr->initialize(m_tubeNumber, assignmentInfo.weaponKind);
     if (!engagementResult) {
         clearAssignment();
-        return Result<void>::failure("Failed to initialize engagement manager: " + engagementResult.error().message);
+        return Result<void>::failure(formatFixed<ERROR_MESSAGE_CAPACITY>(
+            "Failed to initialize engagement manager: ", engagementResult.error().message));
     }
+    m_notifiedPlanGeneration = m_engagementMgr->getPlanGeneration();
     
     // 관찰자 등록
     m_weapon->addStateObserver(shared_from_this());
@@ -197,7 +269,8 @@ inline void LaunchTube::clearAssignment() {
 
 inline Result<void> LaunchTube::updateAssignmentInfo(const AssignmentInfo& info) {
     if (!hasWeapon()) {
-        return Result<void>::failure("No weapon assigned to tube " + std::to_string(m_tubeNumber));
+        return Result<void>::failure(formatFixed<ERROR_MESSAGE_CAPACITY>(
+            "No weapon assigned to tube ", m_tubeNumber));
     }
     
     m_assignmentInfo = info;
@@ -233,12 +306,29 @@ inline void LaunchTube::setAxisCenter(const GEO_POINT_2D& axisCenter) {
 
 inline Result<void> LaunchTube::requestWeaponStateChange(EN_WPN_CTRL_STATE newState, const CancellationToken& token) {
     if (!hasWeapon()) {
-        return Result<void>::failure("No weapon assigned to tube " + std::to_string(m_tubeNumber));
+        return Result<void>::failure(formatFixed<ERROR_MESSAGE_CAPACITY>(
+            "No weapon assigned to tube ", m_tubeNumber));
     }
     
     return m_weapon->requestStateChange(newState, token);
 }
 
+inline Result<void> LaunchTube::restoreWeaponState(EN_WPN_CTRL_STATE state) {
+    if (!hasWeapon()) {
+        return Result<void>::failure(formatFixed<ERROR_MESSAGE_CAPACITY>(
+            "No weapon assigned to tube ", m_tubeNumber));
+    }
+    
+    // 비행 시간은 복원 시점부터 다시 계산
+    bool launched = state == EN_WPN_CTRL_STATE::WPN_CTRL_STATE_POST_LAUNCH;
+    if (launched) {
+        m_engagementMgr->setLaunched(true);
+    }
+    m_weapon->restoreState(state, launched);
+    
+    return Result<void>::success();
+}
+
 inline EN_WPN_CTRL_STATE LaunchTube::getWeaponState() const {
     if (!hasWeapon()) {
         return EN_WPN_CTRL_STATE::WPN_CTRL_STATE_OFF;
@@ -257,7 +347,8 @@ inline bool LaunchTube::isLaunched() const {
 
 inline Result<void> LaunchTube::updateWaypoints(const std::vector<ST_WEAPON_WAYPOINT>& waypoints) {
     if (!hasWeapon()) {
-        return Result<void>::failure("No weapon assigned to tube " + std::to_string(m_tubeNumber));
+        return Result<void>::failure(formatFixed<ERROR_MESSAGE_CAPACITY>(
+            "No weapon assigned to tube ", m_tubeNumber));
     }
     
     // 무장별 특화 처리
@@ -274,21 +365,45 @@ inline Result<void> LaunchTube::updateWaypoints(const std::vector<ST_WEAPON_WAYP
     return Result<void>::failure("Failed to update waypoints");
 }
 
+inline std::vector<ST_WEAPON_WAYPOINT> LaunchTube::getWaypoints() const {
+    std::vector<ST_WEAPON_WAYPOINT> waypoints;
+    if (!hasWeapon()) {
+        return waypoints;
+    }
+    
+    if (m_assignmentInfo.weaponKind == EN_WPN_KIND::WPN_KIND_M_MINE) {
+        ST_M_MINE_PLAN_INFO plan;
+        auto mineManager = std::dynamic_pointer_cast<IMineEngagementManager>(m_engagementMgr);
+        if (mineManager && mineManager->getDropPlan(plan)) {
+            uint16_t count = std::min<uint16_t>(plan.usWaypointCnt(), static_cast<uint16_t>(plan.stWaypoint().size()));
+            waypoints.assign(plan.stWaypoint().begin(), plan.stWaypoint().begin() + count);
+        }
+    } else if (auto missileManager = std::dynamic_pointer_cast<IMissileEngagementManager>(m_engagementMgr)) {
+        waypoints = missileManager->getWaypoints();
+    }
+    
+    return waypoints;
+}
+
 inline Result<void> LaunchTube::calculateEngagementPlan() {
     if (!hasWeapon()) {
-        return Result<void>::failure("No weapon assigned to tube " + std::to_string(m_tubeNumber));
+        return Result<void>::failure(formatFixed<ERROR_MESSAGE_CAPACITY>(
+            "No weapon assigned to tube ", m_tubeNumber));
     }
     
+    ScopedStageTimer stageTimer(ProfileStage::ENGAGEMENT_PLAN);
+    ScopedTrace trace(TraceCategory::PLAN, "calculateEngagementPlan", m_tubeNumber);
     auto result = m_engagementMgr->calculateEngagementPlan();
+    (result.isSuccess() ? m_recomputeSuccess : m_recomputeFailure).increment();
     
     if (result.isSuccess()) {
         // 교전계획이 준비되었음을 무장에 알림
         m_weapon->setFireSolutionReady(m_engagementMgr->isEngagementPlanValid());
-        
-        // 변화 확인 및 콜백 호출
-        notifyEngagementPlanChange();
     }
     
+    // 변화 확인 및 콜백 호출 (실패로 계획이 무효가 된 경우 포함)
+    notifyEngagementPlanChange();
+    
     return result;
 }
 
@@ -302,6 +417,34 @@ inline EngagementPlanResult LaunchTube::getEngagementResult() const {
     return m_engagementMgr->getEngagementResult();
 }
 
+inline void LaunchTube::copyEngagementResult(EngagementPlanResult& out) const {
+    if (!hasWeapon()) {
+        out.tubeNumber = m_tubeNumber;
+        out.weaponKind = EN_WPN_KIND::WPN_KIND_NA;
+        out.isValid = false;
+        out.totalTime_sec = 0.0f;
+        out.timeToTarget_sec = 0.0f;
+        out.nextWaypointIndex = 0;
+        out.timeToNextWaypoint_sec = 0.0f;
+        out.trajectory.clear();
+        out.waypoints.clear();
+        return;
+    }
+    
+    m_engagementMgr->copyEngagementResult(out);
+}
+
+inline MemoryFootprint LaunchTube::getMemoryFootprint() const {
+    MemoryFootprint footprint;
+    if (!hasWeapon()) {
+        return footprint;
+    }
+    
+    footprint += m_weapon->getMemoryFootprint();
+    footprint += m_engagementMgr->getMemoryFootprint();
+    return footprint;
+}
+
 inline bool LaunchTube::isEngagementPlanValid() const {
     if (!hasWeapon()) {
         return false;
@@ -310,16 +453,21 @@ inline bool LaunchTube::isEngagementPlanValid() const {
     return m_engagementMgr->isEngagementPlanValid();
 }
 
-inline void LaunchTube::update() {
+inline void LaunchTube::update(PostLaunchTracker* tracker) {
     if (!hasWeapon()) {
         return;
     }
     
+    ScopedStageTimer stageTimer(ProfileStage::TUBE_UPDATE);
+    ScopedTrace trace(TraceCategory::TICK, "LaunchTube::update", m_tubeNumber);
+    
     // 무장 업데이트
     m_weapon->update();
     
-    // 교전계획 업데이트
-    m_engagementMgr->update();
+    // 교전계획 업데이트 (발사 후 추적은 가능하면 일괄 처리)
+    if (!tracker || !m_weapon->isLaunched() || !tracker->add(*m_engagementMgr)) {
+        m_engagementMgr->update();
+    }
     
     // 정기적으로 교전계획 재계산 (발사 전에만)
     if (!m_weapon->isLaunched()) {
@@ -431,17 +579,14 @@ inline Result<void> LaunchTube::setupMissileSpecificAssignment() {
 }
 
 inline void LaunchTube::notifyEngagementPlanChange() {
-    auto currentResult = getEngagementResult();
-    
-    // 결과가 변경되었는지 확인 (간단한 비교)
-    bool changed = (currentResult.isValid != m_lastEngagementResult.isValid) ||
-                   (currentResult.totalTime_sec != m_lastEngagementResult.totalTime_sec) ||
-                   (currentResult.trajectory.size() != m_lastEngagementResult.trajectory.size());
-    
-    if (changed && m_engagementPlanCallback) {
-        m_engagementPlanCallback(m_tubeNumber, currentResult);
-        m_lastEngagementResult = currentResult;
+    // 계획 내용이 바뀌면 관리자가 세대를 올리므로 정수 비교만 한다 (결과 복사 없음)
+    uint64_t generation = m_engagementMgr->getPlanGeneration();
+    if (generation == m_notifiedPlanGeneration || !m_engagementPlanCallback) {
+        return;
     }
+    
+    m_notifiedPlanGeneration = generation;
+    m_engagementPlanCallback(m_tubeNumber, m_engagementMgr->getEngagementResultRef());
 }
 
 } // namespace WeaponControl
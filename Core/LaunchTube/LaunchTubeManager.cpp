@@ -1,5 +1,7 @@
 #include "LaunchTubeManager.h"
 #include "../Factory/WeaponFactory.h"
+#include "../../Infrastructure/Diagnostics/StageProfiler.h"
+#include "../../Infrastructure/Diagnostics/TraceRecorder.h"
 #include <iostream>
 #include <algorithm>
 
@@ -13,7 +15,16 @@ LaunchTubeManager::LaunchTubeManager(uint16_t maxTubes)
     : m_maxTubes(maxTubes == 0 ? SystemConfig::getInstance().getMaxLaunchTubes() : maxTubes)
     , m_minTubeNumber(1)
     , m_maxTubeNumber(m_maxTubes)
+    , m_directoryReady(false)
+    , m_assignedMask(m_maxTubes)
+    , m_activeMask(m_maxTubes)
+    , m_planDirtyMask(m_maxTubes)
+    , m_planUpdatedMask(m_maxTubes)
     , m_axisCenter{0.0, 0.0}
+    , m_launchCounter(MetricsRegistry::getInstance().counter(
+          "weapon_launches_total", "Weapons reported as launched"))
+    , m_assignedTubesGauge(MetricsRegistry::getInstance().gauge(
+          "launch_tubes_assigned", "Launch tubes with an assigned weapon"))
     , m_initialized(false)
 {
     std::cout << "LaunchTubeManager created with " << m_maxTubes << " tubes" << std::endl;
@@ -26,27 +37,9 @@ Result<void> LaunchTubeManager::initialize() {
     }
     
     try {
-        // 발사관들 생성 (1부터 maxTubes까지)
-        m_launchTubes.resize(m_maxTubes + 1); // 0번 인덱스는 사용하지 않음
-        
-        for (uint16_t i = m_minTubeNumber; i <= m_maxTubeNumber; ++i) {
-            m_launchTubes[i] = std::make_shared<LaunchTube>(i);
-            
-            // 콜백 등록
-            m_launchTubes[i]->setStateChangeCallback(
-                [this](uint16_t tubeNumber, EN_WPN_CTRL_STATE oldState, EN_WPN_CTRL_STATE newState) {
-                    onTubeStateChanged(tubeNumber, oldState, newState);
-                });
-            
-            m_launchTubes[i]->setLaunchStatusCallback(
-                [this](uint16_t tubeNumber, bool launched) {
-                    onTubeLaunchStatusChanged(tubeNumber, launched);
-                });
-            
-            m_launchTubes[i]->setEngagementPlanCallback(
-                [this](uint16_t tubeNumber, const EngagementPlanResult& result) {
-                    onTubeEngagementPlanUpdated(tubeNumber, result);
-                });
+        // 발사관 디렉터리는 최초 1회만 구성 (shutdown 후 재초기화 시 기존 발사관 재사용)
+        if (!m_directoryReady.load(std::memory_order_acquire)) {
+            buildTubeDirectory();
         }
         
         m_initialized = true;
@@ -60,14 +53,13 @@ Result<void> LaunchTubeManager::initialize() {
 }
 
 void LaunchTubeManager::shutdown() {
-    std::lock_guard<std::shared_mutex> lock(m_tubesMutex);
-    
-    // 모든 발사관 할당 해제
-    for (uint16_t i = m_minTubeNumber; i <= m_maxTubeNumber; ++i) {
-        if (m_launchTubes[i] && m_launchTubes[i]->hasWeapon()) {
-            m_launchTubes[i]->clearAssignment();
-        }
-    }
+    // 모든 발사관 할당 해제 (발사관 객체 자체는 관리자 소멸 시까지 유지)
+    m_assignedMask.forEach([this](uint16_t tubeNumber) {
+        m_assignedMask.set(tubeNumber, false);
+        m_activeMask.set(tubeNumber, false);
+        m_launchTubes[tubeNumber]->clearAssignment();
+        m_assignedTubesGauge.add(-1);
+    });
     
     m_initialized = false;
     std::cout << "LaunchTubeManager shutdown complete" << std::endl;
@@ -76,20 +68,23 @@ void LaunchTubeManager::shutdown() {
 Result<void> LaunchTubeManager::assignWeapon(const WeaponAssignmentRequest& request) {
     auto tube = getValidatedTube(request.tubeNumber);
     if (!tube) {
-        return Result<void>::failure("Invalid tube number: " + std::to_string(request.tubeNumber));
+        return Result<void>::failure(formatFixed<ERROR_MESSAGE_CAPACITY>(
+            "Invalid tube number: ", request.tubeNumber));
     }
     
     if (tube->hasWeapon()) {
-        return Result<void>::failure("Tube " + std::to_string(request.tubeNumber) + " already assigned");
+        return Result<void>::failure(formatFixed<ERROR_MESSAGE_CAPACITY>(
+            "Tube ", request.tubeNumber, " already assigned"));
     }
     
     // 무장과 교전계획 관리자 생성
     auto weaponResult = createWeaponAndManager(request.weaponKind);
     if (!weaponResult) {
-        return Result<void>::failure("Failed to create weapon: " + weaponResult.error().message);
+        return Result<void>::failure(formatFixed<ERROR_MESSAGE_CAPACITY>(
+            "Failed to create weapon: ", weaponResult.error().message));
     }
     
-    auto [weapon, engagementMgr] = weaponResult.value();
+    auto [weapon, engagementMgr] = std::move(weaponResult.value());
     
     // 발사관에 할당
     auto assignResult = tube->assignWeapon(std::move(weapon), std::move(engagementMgr), request.assignmentInfo);
@@ -97,9 +92,14 @@ Result<void> LaunchTubeManager::assignWeapon(const WeaponAssignmentRequest& requ
         return assignResult;
     }
     
+    // 환경 정보 복사 전에 표시하여 그 사이의 환경 갱신이 누락되지 않도록 함
+    m_assignedMask.set(request.tubeNumber, true);
+    m_activeMask.set(request.tubeNumber, tube->getActivity() != TubeActivity::IDLE);
+    
     // 환경 정보 업데이트
     {
-        std::shared_lock<std::shared_mutex> envLock(m_environmentMutex);
+        std::shared_lock<ProfiledSharedMutex> envLock(m_environmentMutex, std::defer_lock);
+        lockTraced(envLock, "m_environmentMutex");
         tube->setAxisCenter(m_axisCenter);
         tube->updateOwnShipInfo(m_ownShipInfo);
         
@@ -113,6 +113,11 @@ Result<void> LaunchTubeManager::assignWeapon(const WeaponAssignmentRequest& requ
         }
     }
     
+    m_assignedTubesGauge.add(1);
+    
+    // 최초 교전계획은 다음 주기에 계산
+    m_planDirtyMask.set(request.tubeNumber, true);
+    
     // 할당 변경 콜백 호출
     if (m_assignmentChangeCallback) {
         m_assignmentChangeCallback(request.tubeNumber, request.weaponKind, true);
@@ -127,15 +132,18 @@ Result<void> LaunchTubeManager::assignWeapon(const WeaponAssignmentRequest& requ
 Result<void> LaunchTubeManager::unassignWeapon(uint16_t tubeNumber) {
     auto tube = getValidatedTube(tubeNumber);
     if (!tube) {
-        return Result<void>::failure("Invalid tube number: " + std::to_string(tubeNumber));
+        return Result<void>::failure(formatFixed<ERROR_MESSAGE_CAPACITY>("Invalid tube number: ", tubeNumber));
     }
     
     if (!tube->hasWeapon()) {
-        return Result<void>::failure("Tube " + std::to_string(tubeNumber) + " is not assigned");
+        return Result<void>::failure(formatFixed<ERROR_MESSAGE_CAPACITY>("Tube ", tubeNumber, " is not assigned"));
     }
     
     EN_WPN_KIND weaponKind = tube->getWeapon()->getWeaponKind();
+    m_assignedMask.set(tubeNumber, false);
+    m_activeMask.set(tubeNumber, false);
     tube->clearAssignment();
+    m_assignedTubesGauge.add(-1);
     
     // 할당 변경 콜백 호출
     if (m_assignmentChangeCallback) {
@@ -170,29 +178,29 @@ bool LaunchTubeManager::canAssignWeapon(uint16_t tubeNumber, EN_WPN_KIND weaponK
 Result<void> LaunchTubeManager::requestWeaponStateChange(const WeaponControlRequest& request) {
     auto tube = getValidatedTube(request.tubeNumber);
     if (!tube) {
-        return Result<void>::failure("Invalid tube number: " + std::to_string(request.tubeNumber));
+        return Result<void>::failure(formatFixed<ERROR_MESSAGE_CAPACITY>(
+            "Invalid tube number: ", request.tubeNumber));
     }
     
     return tube->requestWeaponStateChange(request.targetState, request.cancellationToken);
 }
 
 Result<void> LaunchTubeManager::requestAllWeaponStateChange(EN_WPN_CTRL_STATE newState) {
-    auto assignedTubes = getAssignedTubes();
     bool allSuccess = true;
-    std::string errors;
+    ErrorMessage errors("Some state changes failed: ");
     
-    for (auto& tube : assignedTubes) {
-        auto result = tube->requestWeaponStateChange(newState);
+    forEachAssignedTube([&](LaunchTube& tube) {
+        auto result = tube.requestWeaponStateChange(newState);
         if (!result) {
             allSuccess = false;
-            errors += "Tube " + std::to_string(tube->getTubeNumber()) + ": " + result.error().message + "; ";
+            errors << "Tube " << tube.getTubeNumber() << ": " << result.error().message << "; ";
         }
-    }
+    });
     
     if (allSuccess) {
         return Result<void>::success();
     } else {
-        return Result<void>::failure("Some state changes failed: " + errors);
+        return Result<void>::failure(errors);
     }
 }
 
@@ -209,12 +217,12 @@ bool LaunchTubeManager::canChangeState(uint16_t tubeNumber, EN_WPN_CTRL_STATE ne
 Result<void> LaunchTubeManager::emergencyStop() {
     std::cout << "EMERGENCY STOP initiated" << std::endl;
     
-    auto assignedTubes = getAssignedTubes();
     bool allSuccess = true;
-    std::string errors;
+    // 실패 메시지는 고정 버퍼에 누적 (용량을 넘는 발사관 목록은 잘림)
+    ErrorMessage errors("Emergency stop partially failed: ");
     
-    for (auto& tube : assignedTubes) {
-        EN_WPN_CTRL_STATE currentState = tube->getWeaponState();
+    forEachAssignedTube([&](LaunchTube& tube) {
+        EN_WPN_CTRL_STATE currentState = tube.getWeaponState();
         
         // 발사 중이면 중단, 그렇지 않으면 끔
         EN_WPN_CTRL_STATE targetState = (currentState == EN_WPN_CTRL_STATE::WPN_CTRL_STATE_LAUNCH) 
@@ -227,96 +235,137 @@ Result<void> LaunchTubeManager::emergencyStop() {
             emergencyToken.cancel(); // 즉시 취소
         }
         
-        auto result = tube->requestWeaponStateChange(targetState, emergencyToken);
+        auto result = tube.requestWeaponStateChange(targetState, emergencyToken);
         if (!result) {
             allSuccess = false;
-            errors += "Tube " + std::to_string(tube->getTubeNumber()) + ": " + result.error().message + "; ";
+            errors << "Tube " << tube.getTubeNumber() << ": " << result.error().message << "; ";
         }
-    }
+    });
     
     if (allSuccess) {
         std::cout << "Emergency stop completed successfully" << std::endl;
         return Result<void>::success();
     } else {
-        return Result<void>::failure("Emergency stop partially failed: " + errors);
+        return Result<void>::failure(errors);
+    }
+}
+
+Result<void> LaunchTubeManager::restoreWeaponState(uint16_t tubeNumber, EN_WPN_CTRL_STATE state, bool launched) {
+    auto tube = getValidatedTube(tubeNumber);
+    if (!tube) {
+        return Result<void>::failure(formatFixed<ERROR_MESSAGE_CAPACITY>("Invalid tube number: ", tubeNumber));
+    }
+    
+    // 활성 마스크와 상태 전이 지표는 상태 변경 통지에서 갱신
+    auto result = tube->restoreWeaponState(RestoredWeaponState(state, launched));
+    if (result) {
+        m_planDirtyMask.set(tubeNumber, true);
     }
+    return result;
 }
 
 void LaunchTubeManager::updateOwnShipInfo(const NAVINF_SHIP_NAVIGATION_INFO& ownShip) {
     {
-        std::lock_guard<std::shared_mutex> lock(m_environmentMutex);
+        std::unique_lock<ProfiledSharedMutex> lock(m_environmentMutex, std::defer_lock);
+        lockTraced(lock, "m_environmentMutex");
         m_ownShipInfo = ownShip;
     }
     
     // 모든 할당된 발사관에 업데이트
-    auto assignedTubes = getAssignedTubes();
-    for (auto& tube : assignedTubes) {
-        tube->updateOwnShipInfo(ownShip);
-    }
+    forEachAssignedTube([&](LaunchTube& tube) {
+        tube.updateOwnShipInfo(ownShip);
+    });
+    m_planDirtyMask.setAll(m_assignedMask);
 }
 
 void LaunchTubeManager::updateTargetInfo(const TRKMGR_SYSTEMTARGET_INFO& target) {
     {
-        std::lock_guard<std::shared_mutex> lock(m_environmentMutex);
-        m_targetInfoMap[target.unTargetSystemID()] = target;
+        std::unique_lock<ProfiledSharedMutex> lock(m_environmentMutex, std::defer_lock);
+        lockTraced(lock, "m_environmentMutex");
+        m_targetInfoNodes.assign(m_targetInfoMap, target.unTargetSystemID(), target);
     }
     
-    // 모든 할당된 발사관에 업데이트
-    auto assignedTubes = getAssignedTubes();
-    for (auto& tube : assignedTubes) {
-        tube->updateTargetInfo(target);
-    }
+    // 모든 할당된 발사관에 업데이트 (해당 표적을 추적 중인 발사관만 재계산 대기)
+    forEachAssignedTube([&](LaunchTube& tube) {
+        tube.updateTargetInfo(target);
+        if (tube.getAssignmentInfo().systemTargetId == target.unTargetSystemID()) {
+            m_planDirtyMask.set(tube.getTubeNumber(), true);
+        }
+    });
 }
 
 void LaunchTubeManager::setAxisCenter(const GEO_POINT_2D& axisCenter) {
     {
-        std::lock_guard<std::shared_mutex> lock(m_environmentMutex);
+        std::unique_lock<ProfiledSharedMutex> lock(m_environmentMutex, std::defer_lock);
+        lockTraced(lock, "m_environmentMutex");
         m_axisCenter = axisCenter;
     }
     
     // 모든 할당된 발사관에 업데이트
-    auto assignedTubes = getAssignedTubes();
-    for (auto& tube : assignedTubes) {
-        tube->setAxisCenter(axisCenter);
-    }
+    forEachAssignedTube([&](LaunchTube& tube) {
+        tube.setAxisCenter(axisCenter);
+    });
+    m_planDirtyMask.setAll(m_assignedMask);
+}
+
+void LaunchTubeManager::getEnvironment(NAVINF_SHIP_NAVIGATION_INFO& ownShip, GEO_POINT_2D& axisCenter) const {
+    std::shared_lock<ProfiledSharedMutex> lock(m_environmentMutex, std::defer_lock);
+    lockTraced(lock, "m_environmentMutex");
+    ownShip = m_ownShipInfo;
+    axisCenter = m_axisCenter;
+}
+
+void LaunchTubeManager::reserveTargets(size_t maxTargets) {
+    std::unique_lock<ProfiledSharedMutex> lock(m_environmentMutex, std::defer_lock);
+    lockTraced(lock, "m_environmentMutex");
+    m_targetInfoNodes.reserve(m_targetInfoMap, maxTargets);
 }
 
 Result<void> LaunchTubeManager::updateWaypoints(const WaypointUpdateRequest& request) {
     auto tube = getValidatedTube(request.tubeNumber);
     if (!tube) {
-        return Result<void>::failure("Invalid tube number: " + std::to_string(request.tubeNumber));
+        return Result<void>::failure(formatFixed<ERROR_MESSAGE_CAPACITY>(
+            "Invalid tube number: ", request.tubeNumber));
     }
     
-    return tube->updateWaypoints(request.waypoints);
+    auto result = tube->updateWaypoints(request.waypoints);
+    if (result) {
+        m_planDirtyMask.set(request.tubeNumber, true);
+    }
+    return result;
 }
 
 Result<void> LaunchTubeManager::calculateEngagementPlan(uint16_t tubeNumber) {
     auto tube = getValidatedTube(tubeNumber);
     if (!tube) {
-        return Result<void>::failure("Invalid tube number: " + std::to_string(tubeNumber));
+        return Result<void>::failure(formatFixed<ERROR_MESSAGE_CAPACITY>("Invalid tube number: ", tubeNumber));
     }
     
     return tube->calculateEngagementPlan();
 }
 
 void LaunchTubeManager::calculateAllEngagementPlans() {
-    auto assignedTubes = getAssignedTubes();
-    for (auto& tube : assignedTubes) {
-        tube->calculateEngagementPlan();
-    }
+    forEachAssignedTube([](LaunchTube& tube) {
+        tube.calculateEngagementPlan();
+    });
 }
 
 std::vector<LaunchTubeStatus> LaunchTubeManager::getAllTubeStatus() const {
     std::vector<LaunchTubeStatus> statuses;
+    getAllTubeStatus(statuses);
+    return statuses;
+}
+
+void LaunchTubeManager::getAllTubeStatus(std::vector<LaunchTubeStatus>& statuses) const {
+    statuses.clear();
+    if (!m_directoryReady.load(std::memory_order_acquire)) {
+        return;
+    }
     
-    std::shared_lock<std::shared_mutex> lock(m_tubesMutex);
+    statuses.reserve(m_maxTubes);
     for (uint16_t i = m_minTubeNumber; i <= m_maxTubeNumber; ++i) {
-        if (m_launchTubes[i]) {
-            statuses.push_back(m_launchTubes[i]->getStatus());
-        }
+        statuses.push_back(m_launchTubes[i]->getStatus());
     }
-    
-    return statuses;
 }
 
 LaunchTubeStatus LaunchTubeManager::getTubeStatus(uint16_t tubeNumber) const {
@@ -333,14 +382,26 @@ LaunchTubeStatus LaunchTubeManager::getTubeStatus(uint16_t tubeNumber) const {
 std::vector<EngagementPlanResult> LaunchTubeManager::getAllEngagementResults() const {
     std::vector<EngagementPlanResult> results;
     
-    auto assignedTubes = getAssignedTubes();
-    for (auto& tube : assignedTubes) {
-        results.push_back(tube->getEngagementResult());
-    }
+    forEachAssignedTube([&](LaunchTube& tube) {
+        results.push_back(tube.getEngagementResult());
+    });
     
     return results;
 }
 
+void LaunchTubeManager::copyAllEngagementResults(std::vector<EngagementPlanResult>& results) const {
+    if (!m_directoryReady.load(std::memory_order_acquire)) {
+        results.clear();
+        return;
+    }
+    
+    // 원소를 제자리에서 덮어써 궤적/경로점 버퍼 용량을 유지
+    results.resize(m_maxTubes);
+    for (uint16_t i = m_minTubeNumber; i <= m_maxTubeNumber; ++i) {
+        m_launchTubes[i]->copyEngagementResult(results[i - m_minTubeNumber]);
+    }
+}
+
 EngagementPlanResult LaunchTubeManager::getEngagementResult(uint16_t tubeNumber) const {
     auto tube = getValidatedTube(tubeNumber);
     if (tube) {
@@ -353,31 +414,48 @@ EngagementPlanResult LaunchTubeManager::getEngagementResult(uint16_t tubeNumber)
 }
 
 std::shared_ptr<LaunchTube> LaunchTubeManager::getLaunchTube(uint16_t tubeNumber) {
-    return getValidatedTube(tubeNumber);
+    // 소유권이 필요한 외부 호출자용 - 내부 경로는 getValidatedTube 사용
+    return getValidatedTube(tubeNumber) ? m_launchTubes[tubeNumber] : nullptr;
 }
 
 std::shared_ptr<const LaunchTube> LaunchTubeManager::getLaunchTube(uint16_t tubeNumber) const {
-    return getValidatedTube(tubeNumber);
+    return getValidatedTube(tubeNumber) ? m_launchTubes[tubeNumber] : nullptr;
 }
 
 std::vector<std::shared_ptr<LaunchTube>> LaunchTubeManager::getAssignedTubes() const {
     std::vector<std::shared_ptr<LaunchTube>> assignedTubes;
     
-    std::shared_lock<std::shared_mutex> lock(m_tubesMutex);
-    for (uint16_t i = m_minTubeNumber; i <= m_maxTubeNumber; ++i) {
-        if (m_launchTubes[i] && m_launchTubes[i]->hasWeapon()) {
-            assignedTubes.push_back(m_launchTubes[i]);
-        }
-    }
+    m_assignedMask.forEach([&](uint16_t tubeNumber) {
+        assignedTubes.push_back(m_launchTubes[tubeNumber]);
+    });
     
     return assignedTubes;
 }
 
+void LaunchTubeManager::forEachAssignedTube(const std::function<void(LaunchTube&)>& visitor) const {
+    m_assignedMask.forEach([&](uint16_t tubeNumber) {
+        visitor(*m_launchTubes[tubeNumber]);
+    });
+}
+
 void LaunchTubeManager::update() {
-    auto assignedTubes = getAssignedTubes();
-    for (auto& tube : assignedTubes) {
-        tube->update();
+    ScopedStageTimer stageTimer(ProfileStage::TUBE_MANAGER_UPDATE);
+    ScopedTrace trace(TraceCategory::TICK, "tick");
+    
+    // 시각은 주기당 한 번만 읽어 비행 중인 모든 무장에 공통 적용
+    m_postLaunchTracker.begin(ClockProvider::get().now());
+    
+    // 활성 발사관과 입력이 변경된 발사관만 갱신 (주기 비용이 발사관 수가 아닌 활동량에 비례)
+    for (size_t word = 0; word < m_assignedMask.wordCount(); ++word) {
+        uint64_t due = (m_activeMask.loadWord(word) | m_planDirtyMask.takeWord(word))
+                     & m_assignedMask.loadWord(word);
+        ForEachTubeBit(due, word, [this](uint16_t tubeNumber) {
+            m_launchTubes[tubeNumber]->update(&m_postLaunchTracker);
+        });
     }
+    
+    m_postLaunchTracker.run();
+    deliverEngagementPlanBatch();
 }
 
 void LaunchTubeManager::setStateChangeCallback(std::function<void(uint16_t, EN_WPN_CTRL_STATE, EN_WPN_CTRL_STATE)> callback) {
@@ -396,23 +474,27 @@ void LaunchTubeManager::setAssignmentChangeCallback(std::function<void(uint16_t,
     m_assignmentChangeCallback = callback;
 }
 
+void LaunchTubeManager::setEngagementPlanBatchCallback(std::function<void(const EngagementPlanBatch&)> callback) {
+    m_engagementPlanBatchCallback = callback;
+}
+
 bool LaunchTubeManager::isValidTubeNumber(uint16_t tubeNumber) const {
     return tubeNumber >= m_minTubeNumber && tubeNumber <= m_maxTubeNumber;
 }
 
 size_t LaunchTubeManager::getAssignedTubeCount() const {
-    return getAssignedTubes().size();
+    return m_assignedMask.count();
 }
 
 size_t LaunchTubeManager::getReadyTubeCount() const {
     size_t readyCount = 0;
-    auto statuses = getAllTubeStatus();
     
-    for (const auto& status : statuses) {
-        if (status.hasWeapon && status.weaponState == EN_WPN_CTRL_STATE::WPN_CTRL_STATE_RTL) {
+    // 무장이 있는 발사관은 모두 할당 마스크에 포함되므로 할당 발사관만 확인
+    forEachAssignedTube([&readyCount](LaunchTube& tube) {
+        if (tube.getWeaponState() == EN_WPN_CTRL_STATE::WPN_CTRL_STATE_RTL) {
             readyCount++;
         }
-    }
+    });
     
     return readyCount;
 }
@@ -421,44 +503,125 @@ size_t LaunchTubeManager::getReadyTubeCount() const {
 // Private 메서드들
 // =============================================================================
 
-std::shared_ptr<LaunchTube> LaunchTubeManager::getValidatedTube(uint16_t tubeNumber) {
+LaunchTube* LaunchTubeManager::getValidatedTube(uint16_t tubeNumber) const {
     if (!isValidTubeNumber(tubeNumber)) {
         std::cout << "Invalid tube number: " << tubeNumber << std::endl;
         return nullptr;
     }
     
-    std::shared_lock<std::shared_mutex> lock(m_tubesMutex);
-    return m_launchTubes[tubeNumber];
+    if (!m_directoryReady.load(std::memory_order_acquire)) {
+        return nullptr;
+    }
+    
+    return m_launchTubes[tubeNumber].get();
 }
 
-std::shared_ptr<const LaunchTube> LaunchTubeManager::getValidatedTube(uint16_t tubeNumber) const {
-    if (!isValidTubeNumber(tubeNumber)) {
-        std::cout << "Invalid tube number: " << tubeNumber << std::endl;
-        return nullptr;
+void LaunchTubeManager::buildTubeDirectory() {
+    // 발사관들 생성 (1부터 maxTubes까지)
+    m_launchTubes.resize(m_maxTubes + 1); // 0번 인덱스는 사용하지 않음
+    m_stateTransitionCounters.resize(m_maxTubes + 1);
+    
+    auto& metrics = MetricsRegistry::getInstance();
+    
+    for (uint16_t i = m_minTubeNumber; i <= m_maxTubeNumber; ++i) {
+        m_launchTubes[i] = std::make_shared<LaunchTube>(i);
+        
+        for (size_t s = 0; s < WEAPON_CTRL_STATE_COUNT; ++s) {
+            m_stateTransitionCounters[i][s] = &metrics.counter(
+                "weapon_state_transitions_total", "Weapon control state transitions by tube and new state",
+                "tube=\"" + std::to_string(i) + "\",state=\"" + std::string(StateToString(ALL_WEAPON_CTRL_STATES[s])) + "\"");
+        }
+        
+        // 콜백 등록
+        m_launchTubes[i]->setStateChangeCallback(
+            [this](uint16_t tubeNumber, EN_WPN_CTRL_STATE oldState, EN_WPN_CTRL_STATE newState) {
+                onTubeStateChanged(tubeNumber, oldState, newState);
+            });
+        
+        m_launchTubes[i]->setLaunchStatusCallback(
+            [this](uint16_t tubeNumber, bool launched) {
+                onTubeLaunchStatusChanged(tubeNumber, launched);
+            });
+        
+        m_launchTubes[i]->setEngagementPlanCallback(
+            [this](uint16_t tubeNumber, const EngagementPlanResult& result) {
+                onTubeEngagementPlanUpdated(tubeNumber, result);
+            });
     }
     
-    std::shared_lock<std::shared_mutex> lock(m_tubesMutex);
-    return m_launchTubes[tubeNumber];
+    m_postLaunchTracker.reserve(m_maxTubes);
+    m_planBatch.reserve(m_maxTubes);
+    m_planBatchResults.resize(m_maxTubes);
+    for (auto& result : m_planBatchResults) {
+        result.trajectory.reserve(MAX_TRAJECTORY_POINTS);
+    }
+    
+    // 이후 m_launchTubes 는 변경되지 않음 - 조회는 이 플래그 확인 후 색인만 수행
+    m_directoryReady.store(true, std::memory_order_release);
 }
 
 void LaunchTubeManager::onTubeStateChanged(uint16_t tubeNumber, EN_WPN_CTRL_STATE oldState, EN_WPN_CTRL_STATE newState) {
+    size_t stateIndex = WeaponCtrlStateIndex(newState);
+    if (tubeNumber < m_stateTransitionCounters.size() && stateIndex < WEAPON_CTRL_STATE_COUNT) {
+        m_stateTransitionCounters[tubeNumber][stateIndex]->increment();
+    }
+    
+    // 주기 갱신 대상 여부는 상태 전이 시점에만 변경
+    if (isValidTubeNumber(tubeNumber)) {
+        m_activeMask.set(tubeNumber, ActivityForState(newState) != TubeActivity::IDLE);
+    }
+    
     if (m_stateChangeCallback) {
         m_stateChangeCallback(tubeNumber, oldState, newState);
     }
 }
 
 void LaunchTubeManager::onTubeLaunchStatusChanged(uint16_t tubeNumber, bool launched) {
+    if (launched) {
+        m_launchCounter.increment();
+    }
+    
     if (m_launchStatusCallback) {
         m_launchStatusCallback(tubeNumber, launched);
     }
 }
 
 void LaunchTubeManager::onTubeEngagementPlanUpdated(uint16_t tubeNumber, const EngagementPlanResult& result) {
+    // 묶음 모드: 표시만 하고 주기 끝에 전달 (명령 스레드에서 바뀐 계획은 다음 주기 끝)
+    if (m_engagementPlanBatchCallback) {
+        m_planUpdatedMask.set(tubeNumber, true);
+        return;
+    }
+    
     if (m_engagementPlanCallback) {
         m_engagementPlanCallback(tubeNumber, result);
     }
 }
 
+void LaunchTubeManager::deliverEngagementPlanBatch() {
+    if (!m_engagementPlanBatchCallback) {
+        return;
+    }
+    
+    // 표시된 발사관만 발사관별 버퍼로 복사 (버퍼 용량을 유지해 정상 상태 무할당)
+    m_planBatch.clear();
+    for (size_t word = 0; word < m_planUpdatedMask.wordCount(); ++word) {
+        ForEachTubeBit(m_planUpdatedMask.takeWord(word), word, [this](uint16_t tubeNumber) {
+            const auto& tube = m_launchTubes[tubeNumber];
+            if (tube->hasWeapon()) {
+                auto& result = m_planBatchResults[tubeNumber - m_minTubeNumber];
+                tube->copyEngagementResult(result);
+                m_planBatch.push_back(EngagementPlanUpdate{tubeNumber, &result});
+            }
+        });
+    }
+    
+    if (!m_planBatch.empty()) {
+        ScopedStageTimer stageTimer(ProfileStage::OBSERVER_NOTIFY);
+        m_engagementPlanBatchCallback(EngagementPlanBatch(m_planBatch.data(), m_planBatch.size()));
+    }
+}
+
 Result<std::pair<WeaponPtr, EngagementManagerPtr>> LaunchTubeManager::createWeaponAndManager(EN_WPN_KIND weaponKind) {
     auto& factory = WeaponFactory::getInstance();
     
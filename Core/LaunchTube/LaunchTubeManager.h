@@ -1,9 +1,15 @@
 #pragma once
 
 #include "LaunchTube.h"
+#include "AtomicTubeMask.h"
 #include "../../Common/Types/CommonTypes.h"
 #include "../../Infrastructure/Configuration/SystemConfig.h"
+#include "../../Infrastructure/Diagnostics/MetricsRegistry.h"
+#include "../../Infrastructure/Diagnostics/LockProfiler.h"
+#include "../../Infrastructure/Diagnostics/MemoryAccounting.h"
+#include "../../Infrastructure/RealTime/MapNodePool.h"
 #include <array>
+#include <atomic>
 #include <memory>
 #include <vector>
 #include <functional>
@@ -12,6 +18,34 @@
 
 namespace WeaponControl {
 
+// =============================================================================
+// 주기 묶음 교전계획 갱신
+//
+// 묶음 모드에서는 교전계획이 바뀐 발사관을 모아 update() 끝에 한 번 전달한다.
+// 같은 주기에 여러 번 바뀐 발사관은 한 번만, 전달 시점의 최신 결과로 담긴다.
+// 결과는 주기 끝에 발사관별 버퍼로 복사한 것이며 콜백이 반환할 때까지만 유효하다.
+// =============================================================================
+
+struct EngagementPlanUpdate {
+    uint16_t tubeNumber = 0;
+    const EngagementPlanResult* result = nullptr;
+};
+
+class EngagementPlanBatch {
+public:
+    EngagementPlanBatch(const EngagementPlanUpdate* updates, size_t count) : m_updates(updates), m_count(count) {}
+    
+    const EngagementPlanUpdate* begin() const { return m_updates; }
+    const EngagementPlanUpdate* end() const { return m_updates + m_count; }
+    const EngagementPlanUpdate& operator[](size_t index) const { return m_updates[index]; }
+    size_t size() const { return m_count; }
+    bool empty() const { return m_count == 0; }
+    
+private:
+    const EngagementPlanUpdate* m_updates;
+    size_t m_count;
+};
+
 // =============================================================================
 // 발사관 관리자 인터페이스
 // =============================================================================
@@ -36,10 +70,17 @@ public:
     virtual bool canChangeState(uint16_t tubeNumber, EN_WPN_CTRL_STATE newState) const = 0;
     virtual Result<void> emergencyStop() = 0;
     
+    // 체크포인트 복원 (할당 이후, 진행 중이던 절차는 RestoredWeaponState 규칙 적용)
+    virtual Result<void> restoreWeaponState(uint16_t tubeNumber, EN_WPN_CTRL_STATE state, bool launched) = 0;
+    
     // 환경 정보 업데이트
     virtual void updateOwnShipInfo(const NAVINF_SHIP_NAVIGATION_INFO& ownShip) = 0;
     virtual void updateTargetInfo(const TRKMGR_SYSTEMTARGET_INFO& target) = 0;
     virtual void setAxisCenter(const GEO_POINT_2D& axisCenter) = 0;
+    virtual void getEnvironment(NAVINF_SHIP_NAVIGATION_INFO& ownShip, GEO_POINT_2D& axisCenter) const = 0;  // 이중화 전체 재전송용
+    
+    // 표적 정보 캐시 노드 미리 확보 (실시간 모드)
+    virtual void reserveTargets(size_t maxTargets) = 0;
     
     // 경로점 관리
     virtual Result<void> updateWaypoints(const WaypointUpdateRequest& request) = 0;
@@ -50,8 +91,10 @@ public:
     
     // 상태 조회
     virtual std::vector<LaunchTubeStatus> getAllTubeStatus() const = 0;
+    virtual void getAllTubeStatus(std::vector<LaunchTubeStatus>& statuses) const = 0;  // 호출자 버퍼 재사용
     virtual LaunchTubeStatus getTubeStatus(uint16_t tubeNumber) const = 0;
     virtual std::vector<EngagementPlanResult> getAllEngagementResults() const = 0;
+    virtual void copyAllEngagementResults(std::vector<EngagementPlanResult>& results) const = 0;  // 전체 발사관 번호 순, 호출자 버퍼 재사용
     virtual EngagementPlanResult getEngagementResult(uint16_t tubeNumber) const = 0;
     
     // 발사관 조회
@@ -59,6 +102,9 @@ public:
     virtual std::shared_ptr<const LaunchTube> getLaunchTube(uint16_t tubeNumber) const = 0;
     virtual std::vector<std::shared_ptr<LaunchTube>> getAssignedTubes() const = 0;
     
+    // 할당된 발사관 순회 (번호 순, 벡터 할당 및 참조 계수 변경 없음)
+    virtual void forEachAssignedTube(const std::function<void(LaunchTube&)>& visitor) const = 0;
+    
     // 주기적 업데이트
     virtual void update() = 0;
     
@@ -68,6 +114,9 @@ public:
     virtual void setEngagementPlanCallback(std::function<void(uint16_t, const EngagementPlanResult&)> callback) = 0;
     virtual void setAssignmentChangeCallback(std::function<void(uint16_t, EN_WPN_KIND, bool)> callback) = 0;
     
+    // 설정하면 묶음 모드: 발사관별 교전계획 콜백 대신 update() 끝에 한 번 전달 (초기화 시에만 설정)
+    virtual void setEngagementPlanBatchCallback(std::function<void(const EngagementPlanBatch&)> callback) = 0;
+    
     // 유틸리티
     virtual bool isValidTubeNumber(uint16_t tubeNumber) const = 0;
     virtual size_t getAssignedTubeCount() const = 0;
@@ -96,10 +145,13 @@ public:
     Result<void> requestAllWeaponStateChange(EN_WPN_CTRL_STATE newState) override;
     bool canChangeState(uint16_t tubeNumber, EN_WPN_CTRL_STATE newState) const override;
     Result<void> emergencyStop() override;
+    Result<void> restoreWeaponState(uint16_t tubeNumber, EN_WPN_CTRL_STATE state, bool launched) override;
     
     void updateOwnShipInfo(const NAVINF_SHIP_NAVIGATION_INFO& ownShip) override;
     void updateTargetInfo(const TRKMGR_SYSTEMTARGET_INFO& target) override;
     void setAxisCenter(const GEO_POINT_2D& axisCenter) override;
+    void getEnvironment(NAVINF_SHIP_NAVIGATION_INFO& ownShip, GEO_POINT_2D& axisCenter) const override;
+    void reserveTargets(size_t maxTargets) override;
     
     Result<void> updateWaypoints(const WaypointUpdateRequest& request) override;
     
@@ -107,13 +159,16 @@ public:
     void calculateAllEngagementPlans() override;
     
     std::vector<LaunchTubeStatus> getAllTubeStatus() const override;
+    void getAllTubeStatus(std::vector<LaunchTubeStatus>& statuses) const override;
     LaunchTubeStatus getTubeStatus(uint16_t tubeNumber) const override;
     std::vector<EngagementPlanResult> getAllEngagementResults() const override;
+    void copyAllEngagementResults(std::vector<EngagementPlanResult>& results) const override;
     EngagementPlanResult getEngagementResult(uint16_t tubeNumber) const override;
     
     std::shared_ptr<LaunchTube> getLaunchTube(uint16_t tubeNumber) override;
     std::shared_ptr<const LaunchTube> getLaunchTube(uint16_t tubeNumber) const override;
     std::vector<std::shared_ptr<LaunchTube>> getAssignedTubes() const override;
+    void forEachAssignedTube(const std::function<void(LaunchTube&)>& visitor) const override;
     
     void update() override;
     
@@ -121,44 +176,74 @@ public:
     void setLaunchStatusCallback(std::function<void(uint16_t, bool)> callback) override;
     void setEngagementPlanCallback(std::function<void(uint16_t, const EngagementPlanResult&)> callback) override;
     void setAssignmentChangeCallback(std::function<void(uint16_t, EN_WPN_KIND, bool)> callback) override;
+    void setEngagementPlanBatchCallback(std::function<void(const EngagementPlanBatch&)> callback) override;
     
     bool isValidTubeNumber(uint16_t tubeNumber) const override;
     size_t getAssignedTubeCount() const override;
     size_t getReadyTubeCount() const override;
 
 private:
-    // 발사관 검증
-    std::shared_ptr<LaunchTube> getValidatedTube(uint16_t tubeNumber);
-    std::shared_ptr<const LaunchTube> getValidatedTube(uint16_t tubeNumber) const;
+    // 발사관 검증 (디렉터리 색인 + 범위 확인, 잠금/참조 계수 변경 없음)
+    LaunchTube* getValidatedTube(uint16_t tubeNumber) const;
+    void buildTubeDirectory();
     
     // 콜백 전달
     void onTubeStateChanged(uint16_t tubeNumber, EN_WPN_CTRL_STATE oldState, EN_WPN_CTRL_STATE newState);
     void onTubeLaunchStatusChanged(uint16_t tubeNumber, bool launched);
     void onTubeEngagementPlanUpdated(uint16_t tubeNumber, const EngagementPlanResult& result);
+    void deliverEngagementPlanBatch();
     
     // 무장 생성 (WeaponFactory 사용)
     Result<std::pair<WeaponPtr, EngagementManagerPtr>> createWeaponAndManager(EN_WPN_KIND weaponKind);
     
-    // 발사관 배열 (동적 크기)
+    // 발사관 디렉터리 - 최초 initialize 에서 한 번 구성한 뒤 고정 (재초기화 시에도 재사용)
+    // 발사관 객체는 관리자 소멸 시까지 유지되므로 조회 결과 포인터는 shutdown 이후에도 유효하다.
     std::vector<std::shared_ptr<LaunchTube>> m_launchTubes;
     uint16_t m_maxTubes;
     uint16_t m_minTubeNumber;
     uint16_t m_maxTubeNumber;
+    std::atomic<bool> m_directoryReady;
+    
+    // 발사관 비트마스크
+    //   할당: 무장이 할당된 발사관
+    //   활성: 매 주기 갱신이 필요한 발사관 (POC/LAUNCH 진행, ON/RTL 인터록 감시, 발사 후 추적)
+    //   계획 갱신 대기: 입력 변경 후 다음 주기에 교전계획을 한 번 재계산할 발사관
+    //   계획 통지 대기: 묶음 모드에서 교전계획이 바뀌어 주기 끝에 전달할 발사관
+    AtomicTubeMask m_assignedMask;
+    AtomicTubeMask m_activeMask;
+    AtomicTubeMask m_planDirtyMask;
+    AtomicTubeMask m_planUpdatedMask;
+    
+    // 발사 후 위치 일괄 계산 (update 스레드 전용)
+    PostLaunchTracker m_postLaunchTracker;
+    
+    // 교전계획 묶음 (update 스레드 전용, 발사관 수만큼 예약)
+    // 항목은 관리자 내부 결과가 아니라 발사관별 복사 버퍼를 가리킨다 - 콜백 중 명령
+    // 스레드가 계획을 재계산하거나 할당을 해제해도 전달된 결과는 바뀌지 않는다.
+    std::vector<EngagementPlanUpdate> m_planBatch;
+    std::vector<EngagementPlanResult> m_planBatchResults;
     
     // 공통 환경 정보
     GEO_POINT_2D m_axisCenter;
     NAVINF_SHIP_NAVIGATION_INFO m_ownShipInfo;
-    std::map<uint32_t, TRKMGR_SYSTEMTARGET_INFO> m_targetInfoMap;
+    using TargetInfoMap = AccountedMap<uint32_t, TRKMGR_SYSTEMTARGET_INFO, MemoryAccountId::TUBE_TARGET_CACHE>;
+    TargetInfoMap m_targetInfoMap;
+    MapNodePool<TargetInfoMap> m_targetInfoNodes;
     
     // 콜백 함수들
     std::function<void(uint16_t, EN_WPN_CTRL_STATE, EN_WPN_CTRL_STATE)> m_stateChangeCallback;
     std::function<void(uint16_t, bool)> m_launchStatusCallback;
     std::function<void(uint16_t, const EngagementPlanResult&)> m_engagementPlanCallback;
     std::function<void(uint16_t, EN_WPN_KIND, bool)> m_assignmentChangeCallback;
+    std::function<void(const EngagementPlanBatch&)> m_engagementPlanBatchCallback;
+    
+    // 운용 지표 (initialize 시 등록, 발사관별 상태 전이 횟수)
+    std::vector<std::array<MetricCounter*, WEAPON_CTRL_STATE_COUNT>> m_stateTransitionCounters;
+    MetricCounter& m_launchCounter;
+    MetricGauge& m_assignedTubesGauge;
     
     // 스레드 안전성
-    mutable std::shared_mutex m_tubesMutex;
-    mutable std::shared_mutex m_environmentMutex;
+    mutable ProfiledSharedMutex m_environmentMutex{"LaunchTubeManager::m_environmentMutex"};
     
     // 초기화 상태
     bool m_initialized;
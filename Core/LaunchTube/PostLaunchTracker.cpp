@@ -0,0 +1,151 @@
+#include "PostLaunchTracker.h"
+#include "../../Infrastructure/Diagnostics/StageProfiler.h"
+#include <algorithm>
+
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
+namespace WeaponControl {
+
+// =============================================================================
+// PostLaunchTracker 구현
+// =============================================================================
+
+void PostLaunchTracker::reserve(size_t capacity) {
+    m_managers.reserve(capacity);
+    m_startLat.reserve(capacity);
+    m_startLon.reserve(capacity);
+    m_endLat.reserve(capacity);
+    m_endLon.reserve(capacity);
+    m_startDepth.reserve(capacity);
+    m_endDepth.reserve(capacity);
+    m_progress.reserve(capacity);
+    m_lat.reserve(capacity);
+    m_lon.reserve(capacity);
+    m_depth.reserve(capacity);
+}
+
+void PostLaunchTracker::begin(std::chrono::steady_clock::time_point now) {
+    m_now = now;
+    m_managers.clear();
+    m_startLat.clear();
+    m_startLon.clear();
+    m_endLat.clear();
+    m_endLon.clear();
+    m_startDepth.clear();
+    m_endDepth.clear();
+    m_progress.clear();
+}
+
+bool PostLaunchTracker::add(IEngagementManager& engagementMgr) {
+    TrackingProfile profile;
+    if (!engagementMgr.getTrackingProfile(profile) || !profile.trajectory) {
+        return false;
+    }
+
+    const auto& trajectory = *profile.trajectory;
+    const ST_3D_GEODETIC_POSITION* start = nullptr;
+    const ST_3D_GEODETIC_POSITION* end = nullptr;
+    float localProgress = 0.0f;
+    ST_3D_GEODETIC_POSITION empty;
+
+    if (trajectory.size() < 2) {
+        // 궤적이 없으면 기본 위치
+        start = end = &empty;
+    } else {
+        // 주기 시각(m_now)은 begin() 에서 잡으므로 같은 주기에 발사된 발사관은
+        // 발사 시각이 더 늦어 경과 시간이 음수가 된다 - 진행률을 [0, 1] 로 제한
+        float timeSinceLaunch = std::chrono::duration<float>(m_now - profile.launchStartTime).count();
+        float progress = profile.totalTime_sec > 0.0f
+            ? std::clamp(timeSinceLaunch / profile.totalTime_sec, 0.0f, 1.0f)
+            : 1.0f;
+
+        if (profile.interpolation == TrackingInterpolation::ENDPOINTS) {
+            start = &trajectory.front();
+            end = &trajectory.back();
+            localProgress = progress;
+        } else {
+            float segmentProgress = progress * (trajectory.size() - 1);
+            size_t segmentIndex = static_cast<size_t>(segmentProgress);
+            if (segmentIndex >= trajectory.size() - 1) {
+                start = end = &trajectory.back();
+            } else {
+                start = &trajectory[segmentIndex];
+                end = &trajectory[segmentIndex + 1];
+                localProgress = segmentProgress - segmentIndex;
+            }
+        }
+    }
+
+    m_managers.push_back(&engagementMgr);
+    m_startLat.push_back(start->dLatitude());
+    m_startLon.push_back(start->dLongitude());
+    m_endLat.push_back(end->dLatitude());
+    m_endLon.push_back(end->dLongitude());
+    m_startDepth.push_back(start->fDepth());
+    m_endDepth.push_back(end->fDepth());
+    m_progress.push_back(localProgress);
+    return true;
+}
+
+void PostLaunchTracker::run() {
+    size_t count = m_managers.size();
+    if (count == 0) {
+        return;
+    }
+
+    ScopedStageTimer stageTimer(ProfileStage::POST_LAUNCH_TRACKING);
+
+    m_lat.resize(count);
+    m_lon.resize(count);
+    m_depth.resize(count);
+    interpolate(count);
+
+    for (size_t i = 0; i < count; ++i) {
+        ST_3D_GEODETIC_POSITION position;
+        position.dLatitude() = m_lat[i];
+        position.dLongitude() = m_lon[i];
+        position.fDepth() = m_depth[i];
+        m_managers[i]->setTrackedPosition(position);
+    }
+}
+
+void PostLaunchTracker::interpolate(size_t count) {
+    // 결과 = 시작 + (끝 - 시작) * 진행률 (개별 보간과 같은 연산 순서, FMA 미사용)
+    size_t i = 0;
+
+#if defined(__SSE2__)
+    for (; i + 4 <= count; i += 4) {
+        __m128 progress = _mm_loadu_ps(&m_progress[i]);
+        __m128d progressLo = _mm_cvtps_pd(progress);
+        __m128d progressHi = _mm_cvtps_pd(_mm_movehl_ps(progress, progress));
+
+        __m128d startLat0 = _mm_loadu_pd(&m_startLat[i]);
+        __m128d startLat1 = _mm_loadu_pd(&m_startLat[i + 2]);
+        __m128d endLat0 = _mm_loadu_pd(&m_endLat[i]);
+        __m128d endLat1 = _mm_loadu_pd(&m_endLat[i + 2]);
+        _mm_storeu_pd(&m_lat[i], _mm_add_pd(startLat0, _mm_mul_pd(_mm_sub_pd(endLat0, startLat0), progressLo)));
+        _mm_storeu_pd(&m_lat[i + 2], _mm_add_pd(startLat1, _mm_mul_pd(_mm_sub_pd(endLat1, startLat1), progressHi)));
+
+        __m128d startLon0 = _mm_loadu_pd(&m_startLon[i]);
+        __m128d startLon1 = _mm_loadu_pd(&m_startLon[i + 2]);
+        __m128d endLon0 = _mm_loadu_pd(&m_endLon[i]);
+        __m128d endLon1 = _mm_loadu_pd(&m_endLon[i + 2]);
+        _mm_storeu_pd(&m_lon[i], _mm_add_pd(startLon0, _mm_mul_pd(_mm_sub_pd(endLon0, startLon0), progressLo)));
+        _mm_storeu_pd(&m_lon[i + 2], _mm_add_pd(startLon1, _mm_mul_pd(_mm_sub_pd(endLon1, startLon1), progressHi)));
+
+        __m128 startDepth = _mm_loadu_ps(&m_startDepth[i]);
+        __m128 endDepth = _mm_loadu_ps(&m_endDepth[i]);
+        _mm_storeu_ps(&m_depth[i], _mm_add_ps(startDepth, _mm_mul_ps(_mm_sub_ps(endDepth, startDepth), progress)));
+    }
+#endif
+
+    for (; i < count; ++i) {
+        m_lat[i] = m_startLat[i] + (m_endLat[i] - m_startLat[i]) * m_progress[i];
+        m_lon[i] = m_startLon[i] + (m_endLon[i] - m_startLon[i]) * m_progress[i];
+        m_depth[i] = m_startDepth[i] + (m_endDepth[i] - m_startDepth[i]) * m_progress[i];
+    }
+}
+
+} // namespace WeaponControl
@@ -0,0 +1,59 @@
+#pragma once
+
+#include "../EngagementManagers/IEngagementManager.h"
+#include "../../Common/Types/CommonTypes.h"
+#include <chrono>
+#include <vector>
+
+namespace WeaponControl {
+
+// =============================================================================
+// 발사 후 추적 일괄 처리기
+//
+// 주기마다 시각을 한 번 읽고, 비행 중인 무장들의 현재 구간(시작/끝 좌표와
+// 구간 내 진행률)을 SoA 배열로 모은 뒤 한 번의 벡터 연산으로 현재 위치를
+// 계산하여 각 교전계획 관리자의 currentPosition 에 되돌려 쓴다.
+// 보간식은 각 관리자의 interpolatePosition 과 연산 순서까지 동일하다.
+// DDS 결과(getMissileEngagementResult 등)는 currentPosition 에서 생성된다.
+// =============================================================================
+
+class PostLaunchTracker {
+public:
+    PostLaunchTracker() = default;
+
+    // 발사관 수만큼 미리 확보하여 주기 중 할당이 없도록 함
+    void reserve(size_t capacity);
+
+    void begin(std::chrono::steady_clock::time_point now);
+
+    // 일괄 처리 가능하면 등록하고 true (불가하면 호출자가 개별 update 수행)
+    bool add(IEngagementManager& engagementMgr);
+
+    // 등록된 무장의 위치 계산 및 반영
+    void run();
+
+    size_t size() const { return m_managers.size(); }
+
+private:
+    void interpolate(size_t count);
+
+    std::chrono::steady_clock::time_point m_now;
+
+    std::vector<IEngagementManager*> m_managers;
+
+    // 구간 정보 (SoA)
+    std::vector<double> m_startLat;
+    std::vector<double> m_startLon;
+    std::vector<double> m_endLat;
+    std::vector<double> m_endLon;
+    std::vector<float> m_startDepth;
+    std::vector<float> m_endDepth;
+    std::vector<float> m_progress;
+
+    // 결과 (SoA)
+    std::vector<double> m_lat;
+    std::vector<double> m_lon;
+    std::vector<float> m_depth;
+};
+
+} // namespace WeaponControl
@@ -0,0 +1,379 @@
+#include "EventReplayer.h"
+#include "WeaponControlService.h"
+#include <filesystem>
+#include <map>
+#include <sstream>
+#include <thread>
+
+namespace WeaponControl {
+
+// =============================================================================
+// EventReplayer 구현
+// =============================================================================
+
+namespace {
+
+double toSeconds(int64_t ns) {
+    return static_cast<double>(ns) / 1e9;
+}
+
+std::string describeState(const StateChangedEvent& event) {
+    std::string text(StateToString(event.oldState));
+    text += "->";
+    text += StateToString(event.newState);
+    return text;
+}
+
+std::string describePlan(const EngagementPlanEvent& event) {
+    std::ostringstream out;
+    out << (event.isValid ? "valid" : "invalid") << " traj=" << event.trajectoryCount
+        << " wp=" << event.waypointCount << " digest=" << std::hex << event.contentDigest;
+    return out.str();
+}
+
+} // namespace
+
+EventReplayer::EventReplayer(ReplayOptions options)
+    : m_options(std::move(options)) {}
+
+Result<ReplayReport> EventReplayer::replay(const std::string& logPath) {
+    auto records = EventLogReader::readAll(logPath);
+    if (!records) {
+        return Result<ReplayReport>::failure(records.error().message);
+    }
+    return replay(records.value());
+}
+
+Result<ReplayReport> EventReplayer::replay(const std::vector<EventRecord>& records) {
+    if (records.empty()) {
+        return Result<ReplayReport>::failure("Event log is empty");
+    }
+
+    ReplayReport report;
+    const int64_t originNs = records.front().timestampNs;
+
+    // 세션 정보 (발사관 수)
+    uint16_t tubeCount = 0;
+    for (const auto& record : records) {
+        if (record.type == EventType::SESSION_START) {
+            SessionStartEvent session;
+            auto decoder = record.decoder();
+            decode(decoder, session);
+            tubeCount = session.tubeCount;
+            break;
+        }
+    }
+
+    // 가상 시각에서 새 서비스 인스턴스 구성
+    VirtualClock clock;
+    ClockProvider::ScopedOverride clockOverride(clock);
+
+    std::string mineDataPath = m_options.mineDataPath;
+    bool temporaryMinePath = mineDataPath.empty();
+    if (temporaryMinePath) {
+        mineDataPath = (std::filesystem::temp_directory_path() / "weapon_control_replay_mine").string();
+        std::filesystem::remove_all(mineDataPath);
+    }
+
+    auto mineService = std::make_unique<MineDropPlanService>(mineDataPath);
+    MineDropPlanService* minePlans = mineService.get();
+    WeaponControlService service(
+        std::make_unique<LaunchTubeManager>(tubeCount),
+        std::make_unique<TargetTrackingService>(),
+        std::move(mineService));
+
+    std::vector<OutputEvent> produced;
+    auto elapsedNs = [&clock]() {
+        return static_cast<int64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(clock.elapsed()).count());
+    };
+
+    service.setStateChangeCallback([&](uint16_t tube, EN_WPN_CTRL_STATE oldState, EN_WPN_CTRL_STATE newState) {
+        StateChangedEvent event{tube, oldState, newState};
+        produced.push_back(toOutput(EventType::STATE_CHANGED, tube,
+            (static_cast<uint64_t>(oldState) << 32) | static_cast<uint64_t>(newState), elapsedNs(), describeState(event)));
+    });
+    service.setLaunchStatusCallback([&](uint16_t tube, bool launched) {
+        produced.push_back(toOutput(EventType::LAUNCH_STATUS, tube, launched ? 1 : 0, elapsedNs(),
+                                    launched ? "launched" : "not launched"));
+    });
+    auto producePlan = [&](uint16_t tube, const EngagementPlanResult& result) {
+        auto event = EngagementPlanEvent::fromResult(tube, result);
+        produced.push_back(toOutput(EventType::ENGAGEMENT_PLAN, tube, event.contentDigest, elapsedNs(), describePlan(event)));
+    };
+    // 교전계획은 설정에 따라 발사관별 콜백 또는 주기 묶음 콜백 중 하나로만 전달된다
+    service.setEngagementPlanCallback(producePlan);
+    service.setEngagementPlanBatchCallback([&](const EngagementPlanBatch& batch) {
+        for (const auto& update : batch) {
+            producePlan(update.tubeNumber, *update.result);
+        }
+    });
+
+    auto initResult = service.initialize();
+    if (!initResult) {
+        return Result<ReplayReport>::failure("Replay service initialization failed: " + initResult.error().message);
+    }
+
+    // 입력 재주입
+    std::vector<OutputEvent> expected;
+    std::map<uint32_t, std::pair<uint32_t, std::vector<ST_M_MINE_PLAN_INFO>>> pendingPlanSaves;
+    auto wallStart = std::chrono::steady_clock::now();
+
+    for (const auto& record : records) {
+        if (IsOutputEvent(record.type)) {
+            OutputEvent output;
+            if (decodeOutput(record, originNs, output)) {
+                expected.push_back(std::move(output));
+            } else {
+                ++report.skippedEvents;
+            }
+            continue;
+        }
+
+        // 기록 시각까지 가상 시각 진행 (처리 중 자동 진행된 경우 그대로 둠)
+        auto target = IClock::TimePoint(std::chrono::nanoseconds(record.timestampNs - originNs));
+        if (clock.now() < target) {
+            clock.advance(target - clock.now());
+        }
+
+        if (m_options.speed > 0.0) {
+            auto wallOffset = std::chrono::duration<double>(toSeconds(record.timestampNs - originNs) / m_options.speed);
+            std::this_thread::sleep_until(wallStart + std::chrono::duration_cast<std::chrono::steady_clock::duration>(wallOffset));
+        }
+
+        auto decoder = record.decoder();
+        bool applied = true;
+
+        switch (record.type) {
+            case EventType::SESSION_START:
+                break;
+            case EventType::ASSIGN: {
+                WeaponAssignmentRequest request;
+                decode(decoder, request);
+                if ((applied = decoder.ok())) service.assignWeapon(request);
+                break;
+            }
+            case EventType::UNASSIGN: {
+                uint16_t tubeNumber = 0;
+                decode(decoder, tubeNumber);
+                if ((applied = decoder.ok())) service.unassignWeapon(tubeNumber);
+                break;
+            }
+            case EventType::CONTROL: {
+                WeaponControlRequest request;
+                decode(decoder, request);
+                if ((applied = decoder.ok())) service.controlWeapon(request);
+                break;
+            }
+            case EventType::WAYPOINTS: {
+                WaypointUpdateRequest request;
+                decode(decoder, request);
+                if ((applied = decoder.ok())) service.updateWaypoints(request);
+                break;
+            }
+            case EventType::EMERGENCY_STOP:
+                service.emergencyStop();
+                break;
+            case EventType::OWN_SHIP: {
+                NAVINF_SHIP_NAVIGATION_INFO ownShip;
+                decode(decoder, ownShip);
+                if ((applied = decoder.ok())) service.updateOwnShipInfo(ownShip);
+                break;
+            }
+            case EventType::TRACK: {
+                TRKMGR_SYSTEMTARGET_INFO target;
+                decode(decoder, target);
+                if ((applied = decoder.ok())) service.updateTargetInfo(target);
+                break;
+            }
+            case EventType::AXIS_CENTER: {
+                GEO_POINT_2D axisCenter{0.0, 0.0};
+                decode(decoder, axisCenter);
+                if ((applied = decoder.ok())) service.setAxisCenter(axisCenter);
+                break;
+            }
+            case EventType::UPDATE_TICK:
+                service.update();
+                break;
+            case EventType::MINE_PLAN_SAVE_BEGIN: {
+                PlanListEvent event;
+                decode(decoder, event);
+                if ((applied = decoder.ok())) {
+                    pendingPlanSaves[event.planListNumber] = {event.value, {}};
+                    if (event.value == 0) {
+                        minePlans->savePlanList(event.planListNumber, {});
+                    }
+                }
+                break;
+            }
+            case EventType::MINE_PLAN_SAVE_ITEM: {
+                PlanEvent event;
+                decode(decoder, event);
+                auto it = pendingPlanSaves.find(event.planListNumber);
+                if ((applied = decoder.ok() && it != pendingPlanSaves.end())) {
+                    it->second.second.push_back(event.plan);
+                    if (it->second.second.size() == it->second.first) {
+                        minePlans->savePlanList(event.planListNumber, it->second.second);
+                        pendingPlanSaves.erase(it);
+                    }
+                }
+                break;
+            }
+            case EventType::MINE_PLAN_UPDATE:
+            case EventType::MINE_PLAN_ADD: {
+                PlanEvent event;
+                decode(decoder, event);
+                if ((applied = decoder.ok())) {
+                    if (record.type == EventType::MINE_PLAN_UPDATE) {
+                        minePlans->updatePlan(event.planListNumber, event.plan);
+                    } else {
+                        minePlans->addPlan(event.planListNumber, event.plan);
+                    }
+                }
+                break;
+            }
+            case EventType::MINE_PLAN_REMOVE:
+            case EventType::MINE_PLAN_LIST_CREATE:
+            case EventType::MINE_PLAN_LIST_DELETE: {
+                PlanListEvent event;
+                decode(decoder, event);
+                if ((applied = decoder.ok())) {
+                    if (record.type == EventType::MINE_PLAN_REMOVE) {
+                        minePlans->removePlan(event.planListNumber, event.value);
+                    } else if (record.type == EventType::MINE_PLAN_LIST_CREATE) {
+                        minePlans->createNewPlanList(event.planListNumber);
+                    } else {
+                        minePlans->deletePlanList(event.planListNumber);
+                    }
+                }
+                break;
+            }
+            default:
+                applied = false;
+                break;
+        }
+
+        if (applied) {
+            ++report.inputEvents;
+        } else {
+            ++report.skippedEvents;
+        }
+    }
+
+    service.shutdown();
+
+    report.wallSeconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - wallStart).count();
+    report.simulatedSeconds = toSeconds(elapsedNs());
+    report.expectedOutputs = expected.size();
+    report.producedOutputs = produced.size();
+    compareOutputs(expected, produced, report);
+
+    if (temporaryMinePath) {
+        std::filesystem::remove_all(mineDataPath);
+    }
+
+    return Result<ReplayReport>::success(std::move(report));
+}
+
+EventReplayer::OutputEvent EventReplayer::toOutput(EventType type, uint16_t tubeNumber, uint64_t key, int64_t timeNs,
+                                                   const std::string& description) {
+    OutputEvent output;
+    output.type = type;
+    output.tubeNumber = tubeNumber;
+    output.key = key;
+    output.timeNs = timeNs;
+    output.description = description;
+    return output;
+}
+
+bool EventReplayer::decodeOutput(const EventRecord& record, int64_t originNs, OutputEvent& output) {
+    auto decoder = record.decoder();
+    int64_t timeNs = record.timestampNs - originNs;
+
+    switch (record.type) {
+        case EventType::STATE_CHANGED: {
+            StateChangedEvent event;
+            decode(decoder, event);
+            output = toOutput(record.type, event.tubeNumber,
+                (static_cast<uint64_t>(event.oldState) << 32) | static_cast<uint64_t>(event.newState),
+                timeNs, describeState(event));
+            break;
+        }
+        case EventType::LAUNCH_STATUS: {
+            LaunchStatusEvent event;
+            decode(decoder, event);
+            output = toOutput(record.type, event.tubeNumber, event.launched ? 1 : 0, timeNs,
+                              event.launched ? "launched" : "not launched");
+            break;
+        }
+        case EventType::ENGAGEMENT_PLAN: {
+            EngagementPlanEvent event;
+            decode(decoder, event);
+            output = toOutput(record.type, event.tubeNumber, event.contentDigest, timeNs, describePlan(event));
+            break;
+        }
+        default:
+            return false;
+    }
+
+    return decoder.ok();
+}
+
+void EventReplayer::compareOutputs(const std::vector<OutputEvent>& expected, const std::vector<OutputEvent>& produced,
+                                   ReplayReport& report) const {
+    // 발사관/콜백 종류별 순서 비교 (발사관 간 상대 순서는 스레드 배치에 따라 달라질 수 있음)
+    using StreamKey = std::pair<uint16_t, uint16_t>;
+    std::map<StreamKey, std::vector<const OutputEvent*>> expectedStreams;
+    std::map<StreamKey, std::vector<const OutputEvent*>> producedStreams;
+
+    for (const auto& e : expected) {
+        expectedStreams[{e.tubeNumber, static_cast<uint16_t>(e.type)}].push_back(&e);
+    }
+    for (const auto& p : produced) {
+        producedStreams[{p.tubeNumber, static_cast<uint16_t>(p.type)}].push_back(&p);
+    }
+
+    auto addDivergence = [&](const std::string& text) {
+        ++report.mismatchedOutputs;
+        if (report.divergences.size() < m_options.maxReportedDivergences) {
+            report.divergences.push_back(text);
+        }
+    };
+
+    auto streamName = [](const StreamKey& key) {
+        return "tube " + std::to_string(key.first) + " " + EventTypeName(static_cast<EventType>(key.second));
+    };
+
+    std::map<StreamKey, bool> allKeys;
+    for (const auto& entry : expectedStreams) allKeys[entry.first] = true;
+    for (const auto& entry : producedStreams) allKeys[entry.first] = true;
+
+    for (const auto& entry : allKeys) {
+        const auto& exp = expectedStreams[entry.first];
+        const auto& prod = producedStreams[entry.first];
+        size_t common = std::min(exp.size(), prod.size());
+
+        for (size_t i = 0; i < common; ++i) {
+            if (exp[i]->key != prod[i]->key) {
+                std::ostringstream out;
+                out << streamName(entry.first) << " #" << i << ": expected " << exp[i]->description
+                    << " at " << toSeconds(exp[i]->timeNs) << "s, got " << prod[i]->description
+                    << " at " << toSeconds(prod[i]->timeNs) << "s";
+                addDivergence(out.str());
+            }
+        }
+        for (size_t i = common; i < exp.size(); ++i) {
+            std::ostringstream out;
+            out << streamName(entry.first) << " #" << i << ": missing " << exp[i]->description
+                << " (recorded at " << toSeconds(exp[i]->timeNs) << "s)";
+            addDivergence(out.str());
+        }
+        for (size_t i = common; i < prod.size(); ++i) {
+            std::ostringstream out;
+            out << streamName(entry.first) << " #" << i << ": unexpected " << prod[i]->description
+                << " at " << toSeconds(prod[i]->timeNs) << "s";
+            addDivergence(out.str());
+        }
+    }
+}
+
+} // namespace WeaponControl
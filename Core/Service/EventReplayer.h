@@ -0,0 +1,67 @@
+#pragma once
+
+#include "../../Infrastructure/Recording/EventLog.h"
+#include "../../Common/Types/CommonTypes.h"
+#include <string>
+#include <vector>
+
+namespace WeaponControl {
+
+// =============================================================================
+// 재생 옵션 및 결과
+// =============================================================================
+
+struct ReplayOptions {
+    double speed = 0.0;                 // 0: 최대 속도, 1: 실시간, N: N배속
+    std::string mineDataPath;           // 재생용 부설계획 경로 (비어 있으면 임시 디렉터리)
+    size_t maxReportedDivergences = 20;
+};
+
+struct ReplayReport {
+    uint64_t inputEvents = 0;
+    uint64_t skippedEvents = 0;         // 디코딩 실패 또는 알 수 없는 이벤트
+    uint64_t expectedOutputs = 0;       // 기록된 콜백 수
+    uint64_t producedOutputs = 0;       // 재생 중 발생한 콜백 수
+    uint64_t mismatchedOutputs = 0;     // 내용 불일치 + 누락 + 추가
+    double wallSeconds = 0.0;
+    double simulatedSeconds = 0.0;
+    std::vector<std::string> divergences;
+
+    bool identical() const { return mismatchedOutputs == 0 && expectedOutputs == producedOutputs; }
+};
+
+// =============================================================================
+// 이벤트 재생기
+//
+// 기록된 입력 이벤트를 새 WeaponControlService 인스턴스에 가상 시각으로
+// 다시 주입하고, 발생한 상태/발사/교전계획 콜백을 기록된 콜백과 발사관별
+// 순서대로 비교한다. 재생 결과는 같은 SystemConfig 설정을 전제로 한다.
+// =============================================================================
+
+class EventReplayer {
+public:
+    explicit EventReplayer(ReplayOptions options = ReplayOptions());
+
+    Result<ReplayReport> replay(const std::string& logPath);
+    Result<ReplayReport> replay(const std::vector<EventRecord>& records);
+
+private:
+    struct OutputEvent {
+        EventType type;
+        uint16_t tubeNumber;
+        uint64_t key;           // 비교 대상 내용
+        int64_t timeNs;         // 세션 시작 기준
+        std::string description;
+    };
+
+    static OutputEvent toOutput(EventType type, uint16_t tubeNumber, uint64_t key, int64_t timeNs,
+                                const std::string& description);
+    static bool decodeOutput(const EventRecord& record, int64_t originNs, OutputEvent& output);
+
+    void compareOutputs(const std::vector<OutputEvent>& expected, const std::vector<OutputEvent>& produced,
+                        ReplayReport& report) const;
+
+    ReplayOptions m_options;
+};
+
+} // namespace WeaponControl
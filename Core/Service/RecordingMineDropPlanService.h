@@ -0,0 +1,110 @@
+#pragma once
+
+#include "ServiceInterfaces.h"
+#include "../../Infrastructure/Recording/EventRecorder.h"
+#include <memory>
+
+namespace WeaponControl {
+
+// =============================================================================
+// 부설계획 편집 기록 데코레이터
+//
+// WeaponControlService 에 IMineDropPlanService 로 주입하면 편집 요청을
+// 이벤트 로그에 기록한 후 내부 서비스로 전달한다.
+// =============================================================================
+
+class RecordingMineDropPlanService : public IMineDropPlanService {
+public:
+    RecordingMineDropPlanService(std::unique_ptr<IMineDropPlanService> inner, std::shared_ptr<EventRecorder> recorder)
+        : m_inner(std::move(inner))
+        , m_recorder(std::move(recorder)) {}
+
+    Result<void> initialize(const std::string& planDataPath = "") override {
+        return m_inner->initialize(planDataPath);
+    }
+
+    Result<void> loadPlanList(uint32_t planListNumber) override {
+        return m_inner->loadPlanList(planListNumber);
+    }
+
+    Result<void> savePlanList(uint32_t planListNumber, const std::vector<ST_M_MINE_PLAN_INFO>& plans) override {
+        m_recorder->record(EventType::MINE_PLAN_SAVE_BEGIN,
+                           PlanListEvent{planListNumber, static_cast<uint32_t>(plans.size())});
+        for (const auto& plan : plans) {
+            m_recorder->record(EventType::MINE_PLAN_SAVE_ITEM, PlanEvent{planListNumber, plan});
+        }
+        return m_inner->savePlanList(planListNumber, plans);
+    }
+
+    Result<void> createNewPlanList(uint32_t planListNumber) override {
+        m_recorder->record(EventType::MINE_PLAN_LIST_CREATE, PlanListEvent{planListNumber, 0});
+        return m_inner->createNewPlanList(planListNumber);
+    }
+
+    Result<void> deletePlanList(uint32_t planListNumber) override {
+        m_recorder->record(EventType::MINE_PLAN_LIST_DELETE, PlanListEvent{planListNumber, 0});
+        return m_inner->deletePlanList(planListNumber);
+    }
+
+    std::vector<ST_M_MINE_PLAN_INFO> getPlanList(uint32_t planListNumber) const override {
+        return m_inner->getPlanList(planListNumber);
+    }
+
+    Result<ST_M_MINE_PLAN_INFO> getPlan(uint32_t planListNumber, uint32_t planNumber) const override {
+        return m_inner->getPlan(planListNumber, planNumber);
+    }
+
+    std::vector<uint32_t> getAvailablePlanListNumbers() const override {
+        return m_inner->getAvailablePlanListNumbers();
+    }
+
+    Result<void> updatePlan(uint32_t planListNumber, const ST_M_MINE_PLAN_INFO& plan) override {
+        m_recorder->record(EventType::MINE_PLAN_UPDATE, PlanEvent{planListNumber, plan});
+        return m_inner->updatePlan(planListNumber, plan);
+    }
+
+    Result<void> addPlan(uint32_t planListNumber, const ST_M_MINE_PLAN_INFO& plan) override {
+        m_recorder->record(EventType::MINE_PLAN_ADD, PlanEvent{planListNumber, plan});
+        return m_inner->addPlan(planListNumber, plan);
+    }
+
+    Result<void> removePlan(uint32_t planListNumber, uint32_t planNumber) override {
+        m_recorder->record(EventType::MINE_PLAN_REMOVE, PlanListEvent{planListNumber, planNumber});
+        return m_inner->removePlan(planListNumber, planNumber);
+    }
+
+    Result<AIEP_CMSHCI_M_MINE_ALL_PLAN_LIST> convertToAllPlanListMessage(uint32_t planListNumber) const override {
+        return m_inner->convertToAllPlanListMessage(planListNumber);
+    }
+
+    // TODO: DDS 편집 목록 변환 구현 시 목록 번호/계획을 추출하여 SAVE 이벤트로 기록
+    Result<void> updateFromEditedPlanList(const CMSHCI_AIEP_M_MINE_EDITED_PLAN_LIST& editedPlanList) override {
+        return m_inner->updateFromEditedPlanList(editedPlanList);
+    }
+
+    bool isValidPlanListNumber(uint32_t planListNumber) const override {
+        return m_inner->isValidPlanListNumber(planListNumber);
+    }
+
+    bool isValidPlanNumber(uint32_t planListNumber, uint32_t planNumber) const override {
+        return m_inner->isValidPlanNumber(planListNumber, planNumber);
+    }
+
+    bool validatePlan(const ST_M_MINE_PLAN_INFO& plan) const override {
+        return m_inner->validatePlan(plan);
+    }
+
+    size_t getPlanCount(uint32_t planListNumber) const override {
+        return m_inner->getPlanCount(planListNumber);
+    }
+
+    size_t getTotalPlanListCount() const override {
+        return m_inner->getTotalPlanListCount();
+    }
+
+private:
+    std::unique_ptr<IMineDropPlanService> m_inner;
+    std::shared_ptr<EventRecorder> m_recorder;
+};
+
+} // namespace WeaponControl
@@ -1,9 +1,13 @@
 #include "ServiceInterfaces.h"
+#include "WeaponControlService.h"
 #include "../../Infrastructure/Configuration/SystemConfig.h"
+#include "../../Infrastructure/Diagnostics/StageProfiler.h"
+#include "../../Infrastructure/Diagnostics/MetricsRegistry.h"
 #include <iostream>
 #include <fstream>
 #include <filesystem>
 #include <algorithm>
+#include <iomanip>
 #include <sstream>
 
 namespace WeaponControl {
@@ -12,26 +16,40 @@ namespace WeaponControl {
 // TargetTrackingService 구현
 // =============================================================================
 
+TargetTrackingService::TargetTrackingService()
+    : m_ingestCounter(MetricsRegistry::getInstance().counter(
+          "target_track_updates_total", "System target track updates received"))
+    , m_trackedTargetsGauge(MetricsRegistry::getInstance().gauge(
+          "target_tracks_active", "System targets currently tracked"))
+{
+}
+
 void TargetTrackingService::updateTargetInfo(const TRKMGR_SYSTEMTARGET_INFO& targetInfo) {
-    std::lock_guard<std::shared_mutex> lock(m_targetsMutex);
+    ScopedStageTimer stageTimer(ProfileStage::TARGET_INGEST);
+    m_ingestCounter.increment();
+    std::lock_guard<ProfiledSharedMutex> lock(m_targetsMutex);
+    
+    auto now = ClockProvider::get().now();
     
     TargetData data;
     data.info = targetInfo;
-    data.lastUpdateTime = std::chrono::steady_clock::now();
+    data.lastUpdateTime = now;
     
-    m_targets[targetInfo.unTargetSystemID()] = data;
+    m_targetNodes.assign(m_targets, targetInfo.unTargetSystemID(), data);
     
-    // 주기적으로 오래된 표적 정리 (간단한 구현)
-    static auto lastCleanup = std::chrono::steady_clock::now();
-    auto now = std::chrono::steady_clock::now();
-    if (now - lastCleanup > std::chrono::minutes(1)) {
-        clearOldTargets(std::chrono::minutes(5)); // 5분 이상 업데이트 없는 표적 제거
-        lastCleanup = now;
+    // 주기적으로 오래된 표적 정리 (이미 잠금을 보유하므로 내부 함수 사용)
+    if (m_lastCleanupTime == std::chrono::steady_clock::time_point()) {
+        m_lastCleanupTime = now;
+    } else if (now - m_lastCleanupTime > std::chrono::minutes(1)) {
+        removeOldTargetsLocked(std::chrono::minutes(5), now); // 5분 이상 업데이트 없는 표적 제거
+        m_lastCleanupTime = now;
     }
+    
+    m_trackedTargetsGauge.set(static_cast<int64_t>(m_targets.size()));
 }
 
 std::optional<TRKMGR_SYSTEMTARGET_INFO> TargetTrackingService::getTarget(uint32_t systemTargetId) const {
-    std::shared_lock<std::shared_mutex> lock(m_targetsMutex);
+    std::shared_lock<ProfiledSharedMutex> lock(m_targetsMutex);
     
     auto it = m_targets.find(systemTargetId);
     if (it != m_targets.end()) {
@@ -42,7 +60,7 @@ std::optional<TRKMGR_SYSTEMTARGET_INFO> TargetTrackingService::getTarget(uint32_
 }
 
 std::vector<uint32_t> TargetTrackingService::getAllTargetIds() const {
-    std::shared_lock<std::shared_mutex> lock(m_targetsMutex);
+    std::shared_lock<ProfiledSharedMutex> lock(m_targetsMutex);
     
     std::vector<uint32_t> targetIds;
     for (const auto& [id, data] : m_targets) {
@@ -53,26 +71,37 @@ std::vector<uint32_t> TargetTrackingService::getAllTargetIds() const {
 }
 
 size_t TargetTrackingService::getTargetCount() const {
-    std::shared_lock<std::shared_mutex> lock(m_targetsMutex);
+    std::shared_lock<ProfiledSharedMutex> lock(m_targetsMutex);
     return m_targets.size();
 }
 
 void TargetTrackingService::clearOldTargets(std::chrono::seconds maxAge) {
-    std::lock_guard<std::shared_mutex> lock(m_targetsMutex);
+    std::lock_guard<ProfiledSharedMutex> lock(m_targetsMutex);
+    
+    removeOldTargetsLocked(maxAge, ClockProvider::get().now());
     
-    auto now = std::chrono::steady_clock::now();
+    m_trackedTargetsGauge.set(static_cast<int64_t>(m_targets.size()));
+}
+
+void TargetTrackingService::removeOldTargetsLocked(std::chrono::seconds maxAge,
+                                                   std::chrono::steady_clock::time_point now) {
     auto it = m_targets.begin();
     
     while (it != m_targets.end()) {
         if (now - it->second.lastUpdateTime > maxAge) {
             std::cout << "Removing old target: " << it->first << std::endl;
-            it = m_targets.erase(it);
+            it = m_targetNodes.erase(m_targets, it);
         } else {
             ++it;
         }
     }
 }
 
+void TargetTrackingService::reserveTargets(size_t maxTargets) {
+    std::lock_guard<ProfiledSharedMutex> lock(m_targetsMutex);
+    m_targetNodes.reserve(m_targets, maxTargets);
+}
+
 // =============================================================================
 // MineDropPlanService 구현
 // =============================================================================
@@ -125,8 +154,8 @@ Result<void> MineDropPlanService::loadPlanList(uint32_t planListNumber) {
     }
     
     {
-        std::lock_guard<std::shared_mutex> lock(m_plansMutex);
-        m_cachedPlans[planListNumber] = plans.value();
+        std::lock_guard<ProfiledSharedMutex> lock(m_plansMutex);
+        m_cachedPlans[planListNumber].assign(plans.value().begin(), plans.value().end());
     }
     
     std::cout << "Loaded plan list " << planListNumber << " with " << plans.value().size() << " plans" << std::endl;
@@ -155,8 +184,8 @@ Result<void> MineDropPlanService::savePlanList(uint32_t planListNumber, const st
     }
     
     {
-        std::lock_guard<std::shared_mutex> lock(m_plansMutex);
-        m_cachedPlans[planListNumber] = plans;
+        std::lock_guard<ProfiledSharedMutex> lock(m_plansMutex);
+        m_cachedPlans[planListNumber].assign(plans.begin(), plans.end());
     }
     
     std::cout << "Saved plan list " << planListNumber << " with " << plans.size() << " plans" << std::endl;
@@ -183,7 +212,7 @@ Result<void> MineDropPlanService::deletePlanList(uint32_t planListNumber) {
         std::filesystem::remove(filePath);
         
         {
-            std::lock_guard<std::shared_mutex> lock(m_plansMutex);
+            std::lock_guard<ProfiledSharedMutex> lock(m_plansMutex);
             m_cachedPlans.erase(planListNumber);
         }
         
@@ -200,10 +229,10 @@ std::vector<ST_M_MINE_PLAN_INFO> MineDropPlanService::getPlanList(uint32_t planL
         return {};
     }
     
-    std::shared_lock<std::shared_mutex> lock(m_plansMutex);
+    std::shared_lock<ProfiledSharedMutex> lock(m_plansMutex);
     auto it = m_cachedPlans.find(planListNumber);
     if (it != m_cachedPlans.end()) {
-        return it->second;
+        return std::vector<ST_M_MINE_PLAN_INFO>(it->second.begin(), it->second.end());
     }
     
     return {};
@@ -378,6 +407,7 @@ Result<std::vector<ST_M_MINE_PLAN_INFO>> MineDropPlanService::loadPlanListFromFi
 }
 
 Result<void> MineDropPlanService::writeJsonToFile(const std::string& filePath, uint32_t planListNumber, const std::vector<ST_M_MINE_PLAN_INFO>& plans) {
+    ScopedStageTimer stageTimer(ProfileStage::MINE_PLAN_IO);
     try {
         std::ofstream file(filePath);
         if (!file.is_open()) {
@@ -417,6 +447,7 @@ Result<void> MineDropPlanService::writeJsonToFile(const std::string& filePath, u
 }
 
 Result<std::vector<ST_M_MINE_PLAN_INFO>> MineDropPlanService::readJsonFromFile(const std::string& filePath) {
+    ScopedStageTimer stageTimer(ProfileStage::MINE_PLAN_IO);
     try {
         if (!std::filesystem::exists(filePath)) {
             return Result<std::vector<ST_M_MINE_PLAN_INFO>>::failure("File not found");
@@ -466,4 +497,1003 @@ bool MineDropPlanService::validatePosition(const ST_WEAPON_WAYPOINT& position) c
     return true;
 }
 
+// =============================================================================
+// WeaponControlService 구현
+// (DDS 메시지 변환 함수들은 메시지 정의에 맞춰 별도 구현)
+// =============================================================================
+
+WeaponControlService::WeaponControlService(
+    std::unique_ptr<ILaunchTubeManager> tubeManager,
+    std::unique_ptr<ITargetTrackingService> targetService,
+    std::unique_ptr<IMineDropPlanService> mineService)
+    : m_tubeManager(std::move(tubeManager))
+    , m_targetService(std::move(targetService))
+    , m_mineService(std::move(mineService))
+    , m_selectedPlanListNumber(0)
+    , m_initialized(false)
+    , m_realTimeMode(false)
+    , m_replicationRole(ReplicationRole::NONE)
+    , m_replicaSynchronized(false)
+    , m_promoted(false)
+    , m_promotionMilliseconds(0.0)
+    , m_replicationApplyFailures(0)
+    , m_environmentGeneration(0)
+    , m_snapshotEpoch(0)
+    , m_snapshotSkipped(MetricsRegistry::getInstance().counter(
+          "system_snapshot_skipped_total", "Update ticks that skipped the system snapshot because readers held every spare slot"))
+    , m_startTime(ClockProvider::get().now())
+    , m_lastUpdateTime(m_startTime.time_since_epoch().count())
+{
+    static const char* commandNames[COMMAND_TYPE_COUNT] = {
+        "assign", "unassign", "control", "waypoints", "emergency_stop"
+    };
+    
+    auto& metrics = MetricsRegistry::getInstance();
+    for (size_t i = 0; i < COMMAND_TYPE_COUNT; ++i) {
+        std::string typeLabel = "type=\"" + std::string(commandNames[i]) + "\"";
+        m_commandMetrics[i].success = &metrics.counter(
+            "weapon_commands_total", "Weapon control commands by type and result", typeLabel + ",result=\"success\"");
+        m_commandMetrics[i].failure = &metrics.counter(
+            "weapon_commands_total", "Weapon control commands by type and result", typeLabel + ",result=\"failure\"");
+        m_commandMetrics[i].durationUs = &metrics.histogram(
+            "weapon_command_duration_us", "Weapon control command processing time in microseconds", typeLabel);
+    }
+    
+    // 관리자 콜백은 서비스를 거쳐 전달 (이벤트 기록 지점)
+    m_tubeManager->setStateChangeCallback(
+        [this](uint16_t tubeNumber, EN_WPN_CTRL_STATE oldState, EN_WPN_CTRL_STATE newState) {
+            if (m_eventRecorder) {
+                m_eventRecorder->record(EventType::STATE_CHANGED, StateChangedEvent{tubeNumber, oldState, newState});
+            }
+            if (m_checkpoint) {
+                m_checkpoint->updateTubeState(tubeNumber, newState,
+                                              newState == EN_WPN_CTRL_STATE::WPN_CTRL_STATE_POST_LAUNCH);
+            }
+            replicate(ReplicationRecordType::STATE, ReplicatedTubeState{tubeNumber, newState,
+                      newState == EN_WPN_CTRL_STATE::WPN_CTRL_STATE_POST_LAUNCH});
+            if (m_stateChangeCallback) {
+                m_stateChangeCallback(tubeNumber, oldState, newState);
+            }
+        });
+    
+    m_tubeManager->setLaunchStatusCallback(
+        [this](uint16_t tubeNumber, bool launched) {
+            if (m_eventRecorder) {
+                m_eventRecorder->record(EventType::LAUNCH_STATUS, LaunchStatusEvent{tubeNumber, launched});
+            }
+            if (m_launchStatusCallback) {
+                m_launchStatusCallback(tubeNumber, launched);
+            }
+        });
+    
+    m_tubeManager->setEngagementPlanCallback(
+        [this](uint16_t tubeNumber, const EngagementPlanResult& result) {
+            // 즉시 전달 모드 전용 (묶음 모드에서는 발사관 관리자가 묶음으로만 전달)
+            recordEngagementPlanUpdate(tubeNumber, result);
+            if (m_engagementPlanCallback) {
+                m_engagementPlanCallback(tubeNumber, result);
+            }
+        });
+}
+
+void WeaponControlService::recordEngagementPlanUpdate(uint16_t tubeNumber, const EngagementPlanResult& result) {
+    if (m_eventRecorder) {
+        m_eventRecorder->record(EventType::ENGAGEMENT_PLAN, EngagementPlanEvent::fromResult(tubeNumber, result));
+    }
+    // 대기 인스턴스의 버전은 주 인스턴스 레코드로 갱신
+    if (m_replicationRole != ReplicationRole::STANDBY && tubeNumber >= 1 && tubeNumber <= m_planVersions.size()) {
+        uint32_t version = m_planVersions[tubeNumber - 1].fetch_add(1, std::memory_order_relaxed) + 1;
+        replicate(ReplicationRecordType::PLAN_VERSION, EngagementPlanEvent::fromResult(tubeNumber, result), version);
+    }
+}
+
+Result<void> WeaponControlService::initialize() {
+    if (m_initialized) {
+        return Result<void>::success();
+    }
+    
+    auto tubeResult = m_tubeManager->initialize();
+    if (!tubeResult) {
+        return tubeResult;
+    }
+    
+    auto mineResult = m_mineService->initialize();
+    if (!mineResult) {
+        return mineResult;
+    }
+    
+    m_planVersions = std::vector<std::atomic<uint32_t>>(m_tubeManager->getAllTubeStatus().size());
+    reserveSnapshots();
+    
+    auto& config = SystemConfig::getInstance();
+    
+    // 교전계획 묶음 전달: 주기 끝에 바뀐 발사관을 한 번에 기록/복제하고 묶음 콜백으로만 통지
+    if (config.isEngagementPlanBatchingEnabled()) {
+        m_tubeManager->setEngagementPlanBatchCallback(
+            [this](const EngagementPlanBatch& batch) {
+                for (const auto& update : batch) {
+                    recordEngagementPlanUpdate(update.tubeNumber, *update.result);
+                }
+                if (m_engagementPlanBatchCallback) {
+                    m_engagementPlanBatchCallback(batch);
+                }
+            });
+    }
+    
+    // 대기 인스턴스는 주 인스턴스에서 상태를 받으므로 체크포인트를 복원하지 않음
+    auto replicationConfig = config.getReplicationConfig();
+    if (config.isStateCheckpointEnabled() && replicationConfig.role != ReplicationRole::STANDBY) {
+        auto checkpointResult = enableStateCheckpoint(config.getStateCheckpointConfig());
+        if (!checkpointResult) {
+            return checkpointResult;
+        }
+    }
+    
+    if (replicationConfig.role != ReplicationRole::NONE) {
+        auto replicationResult = startReplication(replicationConfig);
+        if (!replicationResult) {
+            return replicationResult;
+        }
+    }
+    
+    if (config.isRealTimeModeEnabled()) {
+        auto realTimeResult = enterRealTimeMode(config.getRealTimeMemoryConfig());
+        if (!realTimeResult) {
+            return realTimeResult;
+        }
+    }
+    
+    m_initialized = true;
+    recordSessionStart();
+    std::cout << "WeaponControlService initialized" << std::endl;
+    return Result<void>::success();
+}
+
+Result<void> WeaponControlService::enterRealTimeMode(const RealTimeMemoryConfig& config) {
+    // 정상 상태에서 커지는 저장소를 먼저 확보한 뒤 고정/선점
+    m_targetService->reserveTargets(config.maxTargets);
+    m_tubeManager->reserveTargets(config.maxTargets);
+    
+    auto lockResult = RealTimeMemory::lockAndPrefault(config);
+    if (!lockResult) {
+        return lockResult;
+    }
+    
+    AllocationGuard::arm(true);
+    m_realTimeMode = true;
+    std::cout << "Real-time memory mode enabled (memory locked: "
+              << (RealTimeMemory::isMemoryLocked() ? "yes" : "no") << ")" << std::endl;
+    return Result<void>::success();
+}
+
+Result<void> WeaponControlService::enableStateCheckpoint(const StateCheckpointConfig& config) {
+    auto checkpoint = std::make_unique<StateCheckpoint>();
+    auto openResult = checkpoint->open(config, static_cast<uint16_t>(m_tubeManager->getAllTubeStatus().size()));
+    if (!openResult) {
+        return openResult;
+    }
+    
+    auto start = std::chrono::steady_clock::now();
+    auto contents = checkpoint->load();
+    auto loaded = std::chrono::steady_clock::now();
+    
+    // 복원 중 발생하는 변경은 기록하지 않고, 복원 규칙이 적용된 결과로 다시 기록
+    m_checkpoint.reset();
+    restoreCheckpoint(contents);
+    m_checkpoint = std::move(checkpoint);
+    writeFullCheckpoint(contents);
+    auto end = std::chrono::steady_clock::now();
+    
+    m_restoreReport.restored = true;
+    m_restoreReport.discardedRecords = contents.discardedRecords;
+    m_restoreReport.loadMilliseconds = std::chrono::duration<double, std::milli>(loaded - start).count();
+    m_restoreReport.restoreMilliseconds = std::chrono::duration<double, std::milli>(end - start).count();
+    
+    std::cout << "State checkpoint " << config.path << ": restored " << m_restoreReport.tubes << " tubes, "
+              << m_restoreReport.targets << " targets in " << m_restoreReport.restoreMilliseconds << " ms ("
+              << m_restoreReport.failedTubes << " failed, " << m_restoreReport.discardedRecords
+              << " discarded records)" << std::endl;
+    return Result<void>::success();
+}
+
+void WeaponControlService::restoreCheckpoint(const CheckpointContents& contents) {
+    m_restoreReport = CheckpointRestoreReport();
+    m_selectedPlanListNumber = contents.selectedPlanListNumber;
+    
+    // 표적 먼저 (시스템 표적을 지정한 할당이 표적 정보를 바로 받도록)
+    for (const auto& target : contents.targets) {
+        m_targetService->updateTargetInfo(target);
+        m_tubeManager->updateTargetInfo(target);
+    }
+    m_restoreReport.targets = contents.targets.size();
+    
+    for (const auto& tube : contents.tubes) {
+        uint16_t tubeNumber = tube.assignment.tubeNumber;
+        auto result = m_tubeManager->assignWeapon(tube.assignment);
+        if (!result) {
+            std::cout << "Checkpoint restore: tube " << tubeNumber << " assignment failed: "
+                      << result.error().message << std::endl;
+            ++m_restoreReport.failedTubes;
+            continue;
+        }
+        
+        // 경로점/상태 복원 실패 시에도 할당은 유지 (기록은 실제 상태로 갱신됨)
+        if (tube.hasWaypoints) {
+            WaypointUpdateRequest waypoints;
+            waypoints.tubeNumber = tubeNumber;
+            waypoints.waypoints = tube.waypoints;
+            result = m_tubeManager->updateWaypoints(waypoints);
+        }
+        if (result) {
+            result = m_tubeManager->restoreWeaponState(tubeNumber, tube.state, tube.launched);
+        }
+        
+        if (result) {
+            ++m_restoreReport.tubes;
+        } else {
+            std::cout << "Checkpoint restore: tube " << tubeNumber << " restored without state: "
+                      << result.error().message << std::endl;
+            ++m_restoreReport.failedTubes;
+        }
+    }
+}
+
+void WeaponControlService::writeFullCheckpoint(const CheckpointContents& contents) {
+    m_checkpoint->reset();
+    m_checkpoint->writeSelectedPlanList(m_selectedPlanListNumber);
+    
+    for (const auto& target : contents.targets) {
+        m_checkpoint->writeTarget(target);
+    }
+    
+    m_tubeManager->forEachAssignedTube([this](LaunchTube& tube) {
+        WeaponAssignmentRequest request;
+        request.tubeNumber = tube.getTubeNumber();
+        request.weaponKind = tube.getWeapon()->getWeaponKind();
+        request.assignmentInfo = tube.getAssignmentInfo();
+        m_checkpoint->writeTubeState(request, tube.getWeaponState(), tube.isLaunched());
+    });
+    
+    for (const auto& tube : contents.tubes) {
+        if (tube.hasWaypoints && m_tubeManager->isAssigned(tube.assignment.tubeNumber)) {
+            m_checkpoint->writeWaypoints(tube.assignment.tubeNumber, tube.waypoints);
+        }
+    }
+}
+
+// =============================================================================
+// 상시 대기 이중화
+// =============================================================================
+
+Result<void> WeaponControlService::startReplication(const ReplicationConfig& config) {
+    if (config.role == ReplicationRole::NONE) {
+        return Result<void>::failure("Replication role is not set");
+    }
+    
+    m_replicationConfig = config;
+    m_replication = std::make_unique<ReplicationChannel>();
+    m_replicaSynchronized = false;
+    
+    if (config.role == ReplicationRole::PRIMARY) {
+        // 이미 연결된 대기 인스턴스는 epoch 변경을 보고 다시 연결한 뒤 재전송을 요청함
+        auto createResult = m_replication->create(config);
+        if (!createResult) {
+            m_replication.reset();
+            return createResult;
+        }
+        m_replicationRole = ReplicationRole::PRIMARY;
+        std::cout << "Replication primary: channel " << config.channelName << " (" << m_replication->capacity()
+                  << " slots, " << m_replication->mappedBytes() / 1024 << " KB)" << std::endl;
+        return Result<void>::success();
+    }
+    
+    // 주 인스턴스 채널이 아직 없으면 update 마다 다시 연결을 시도
+    m_replicationRole = ReplicationRole::STANDBY;
+    applyReplication();
+    std::cout << "Replication standby: channel " << config.channelName
+              << (m_replication->isOpen() ? " attached" : " not found, waiting for primary") << std::endl;
+    return Result<void>::success();
+}
+
+uint64_t WeaponControlService::nextEnvironmentGeneration() {
+    return m_environmentGeneration.fetch_add(1, std::memory_order_relaxed) + 1;
+}
+
+void WeaponControlService::publishFullState() {
+    m_replication->publish(ReplicationRecordType::RESYNC_BEGIN);
+    m_replication->publish(ReplicationRecordType::SELECTED_PLAN, m_selectedPlanListNumber);
+    
+    uint64_t generation = m_environmentGeneration.load(std::memory_order_relaxed);
+    NAVINF_SHIP_NAVIGATION_INFO ownShip;
+    GEO_POINT_2D axisCenter;
+    m_tubeManager->getEnvironment(ownShip, axisCenter);
+    m_replication->publish(ReplicationRecordType::OWN_SHIP, ownShip, generation);
+    m_replication->publish(ReplicationRecordType::AXIS_CENTER, axisCenter, generation);
+    
+    size_t targets = 0;
+    for (uint32_t targetId : m_targetService->getAllTargetIds()) {
+        auto target = m_targetService->getTarget(targetId);
+        if (target) {
+            m_replication->publish(ReplicationRecordType::TARGET, *target, generation);
+            ++targets;
+        }
+    }
+    
+    size_t tubes = 0;
+    m_tubeManager->forEachAssignedTube([this, &tubes](LaunchTube& tube) {
+        uint16_t tubeNumber = tube.getTubeNumber();
+        WeaponAssignmentRequest request;
+        request.tubeNumber = tubeNumber;
+        request.weaponKind = tube.getWeapon()->getWeaponKind();
+        request.assignmentInfo = tube.getAssignmentInfo();
+        m_replication->publish(ReplicationRecordType::ASSIGN, request);
+        
+        WaypointUpdateRequest waypoints;
+        waypoints.tubeNumber = tubeNumber;
+        waypoints.waypoints = tube.getWaypoints();
+        if (!waypoints.waypoints.empty()) {
+            m_replication->publish(ReplicationRecordType::WAYPOINTS, waypoints);
+        }
+        
+        m_replication->publish(ReplicationRecordType::STATE,
+                               ReplicatedTubeState{tubeNumber, tube.getWeaponState(), tube.isLaunched()});
+        
+        uint32_t version = tubeNumber <= m_planVersions.size()
+            ? m_planVersions[tubeNumber - 1].load(std::memory_order_relaxed) : 0;
+        if (version > 0) {
+            m_replication->publish(ReplicationRecordType::PLAN_VERSION,
+                                   EngagementPlanEvent::fromResult(tubeNumber, tube.getEngagementResult()), version);
+        }
+        ++tubes;
+    });
+    
+    m_replication->publish(ReplicationRecordType::RESYNC_END);
+    std::cout << "Replication resync sent: " << tubes << " tubes, " << targets << " targets" << std::endl;
+}
+
+bool WeaponControlService::serviceReplication() {
+    if (m_replicationRole == ReplicationRole::PRIMARY) {
+        if (m_replication->consumeResyncRequest()) {
+            publishFullState();
+        }
+        return true;
+    }
+    
+    applyReplication();
+    
+    // 채널을 찾기 전(주 인스턴스 미기동)에는 승격하지 않음
+    if (m_replication->isOpen() && m_replication->isPrimaryLost()) {
+        return promoteToPrimary().isSuccess();
+    }
+    return false;
+}
+
+size_t WeaponControlService::applyReplication() {
+    if (!m_replication->isOpen() || m_replication->primaryRestarted()) {
+        if (!m_replication->attach(m_replicationConfig)) {
+            return 0;
+        }
+        
+        // 연결 이전 레코드는 버리고 전체 재전송으로 시작
+        m_replication->discardPending();
+        m_replication->consumeOverrun();
+        m_replicaSynchronized = false;
+        m_replication->requestResync();
+    }
+    
+    size_t applied = m_replication->poll(
+        [this](ReplicationRecordType type, uint64_t generation, EventDecoder decoder) {
+            applyReplicationRecord(type, generation, decoder);
+        });
+    
+    // 주 인스턴스가 링이 가득 차 변경을 버렸으면 미러가 어긋났으므로 재전송 요청
+    if (m_replication->consumeOverrun()) {
+        m_replicaSynchronized = false;
+        m_replication->requestResync();
+    }
+    return applied;
+}
+
+void WeaponControlService::applyReplicationRecord(ReplicationRecordType type, uint64_t generation, EventDecoder& decoder) {
+    auto result = Result<void>::success();
+    auto applyGeneration = [this](uint64_t value) {
+        if (value > m_environmentGeneration.load(std::memory_order_relaxed)) {
+            m_environmentGeneration.store(value, std::memory_order_relaxed);
+        }
+    };
+    
+    switch (type) {
+        case ReplicationRecordType::RESYNC_BEGIN:
+            clearReplica();
+            break;
+        case ReplicationRecordType::RESYNC_END:
+            m_replicaSynchronized = true;
+            std::cout << "Replication standby synchronized: " << m_tubeManager->getAssignedTubeCount()
+                      << " tubes" << std::endl;
+            break;
+        case ReplicationRecordType::ASSIGN: {
+            WeaponAssignmentRequest request;
+            decode(decoder, request);
+            if (decoder.ok()) {
+                result = m_tubeManager->assignWeapon(request);
+            }
+            break;
+        }
+        case ReplicationRecordType::UNASSIGN: {
+            uint16_t tubeNumber = 0;
+            decode(decoder, tubeNumber);
+            if (decoder.ok()) {
+                result = m_tubeManager->unassignWeapon(tubeNumber);
+            }
+            break;
+        }
+        case ReplicationRecordType::STATE: {
+            // 할당 게시 전에 통지된 상태(할당 직후 초기 상태 등)는 무시
+            ReplicatedTubeState state;
+            decode(decoder, state);
+            auto tube = m_tubeManager->getLaunchTube(state.tubeNumber);
+            if (decoder.ok() && tube && tube->hasWeapon()) {
+                result = tube->restoreWeaponState(state.state);
+            }
+            break;
+        }
+        case ReplicationRecordType::WAYPOINTS: {
+            WaypointUpdateRequest request;
+            decode(decoder, request);
+            if (decoder.ok()) {
+                result = m_tubeManager->updateWaypoints(request);
+            }
+            break;
+        }
+        case ReplicationRecordType::TARGET: {
+            TRKMGR_SYSTEMTARGET_INFO target;
+            decode(decoder, target);
+            if (decoder.ok()) {
+                m_targetService->updateTargetInfo(target);
+                m_tubeManager->updateTargetInfo(target);
+                applyGeneration(generation);
+            }
+            break;
+        }
+        case ReplicationRecordType::OWN_SHIP: {
+            NAVINF_SHIP_NAVIGATION_INFO ownShip;
+            decode(decoder, ownShip);
+            if (decoder.ok()) {
+                m_tubeManager->updateOwnShipInfo(ownShip);
+                applyGeneration(generation);
+            }
+            break;
+        }
+        case ReplicationRecordType::AXIS_CENTER: {
+            GEO_POINT_2D axisCenter;
+            decode(decoder, axisCenter);
+            if (decoder.ok()) {
+                m_tubeManager->setAxisCenter(axisCenter);
+                applyGeneration(generation);
+            }
+            break;
+        }
+        case ReplicationRecordType::SELECTED_PLAN:
+            decode(decoder, m_selectedPlanListNumber);
+            break;
+        case ReplicationRecordType::PLAN_VERSION: {
+            EngagementPlanEvent plan;
+            decode(decoder, plan);
+            if (decoder.ok() && plan.tubeNumber >= 1 && plan.tubeNumber <= m_planVersions.size()) {
+                m_planVersions[plan.tubeNumber - 1].store(static_cast<uint32_t>(generation), std::memory_order_relaxed);
+            }
+            break;
+        }
+        default:
+            result = Result<void>::failure("Unknown replication record");
+            break;
+    }
+    
+    if (!decoder.ok()) {
+        result = Result<void>::failure("Malformed replication record");
+    }
+    if (!result) {
+        ++m_replicationApplyFailures;
+        MetricsRegistry::getInstance().counter(
+            "replication_apply_failures_total", "State deltas the standby could not apply").increment();
+        std::cout << "Replication " << ReplicationRecordTypeName(type) << " not applied: "
+                  << result.error().message << std::endl;
+        
+        // 동기화 이후의 불일치는 전체 재전송으로 복구
+        if (m_replicaSynchronized) {
+            m_replicaSynchronized = false;
+            m_replication->requestResync();
+        }
+    }
+}
+
+void WeaponControlService::clearReplica() {
+    std::vector<uint16_t> assigned;
+    m_tubeManager->forEachAssignedTube([&assigned](LaunchTube& tube) {
+        assigned.push_back(tube.getTubeNumber());
+    });
+    for (uint16_t tubeNumber : assigned) {
+        m_tubeManager->unassignWeapon(tubeNumber);
+    }
+    for (auto& version : m_planVersions) {
+        version.store(0, std::memory_order_relaxed);
+    }
+    m_replicaSynchronized = false;
+}
+
+Result<void> WeaponControlService::promoteToPrimary() {
+    if (m_replicationRole != ReplicationRole::STANDBY) {
+        return Result<void>::failure("Not a standby instance");
+    }
+    
+    auto start = std::chrono::steady_clock::now();
+    applyReplication();
+    
+    // 진행 중이던 전원 인가/발사는 체크포인트 복원과 같은 규칙(RestoredWeaponState)으로 정리
+    // (RTL 은 인터록 판정 결과이므로 그대로 유지)
+    std::vector<ReplicatedTubeState> transient;
+    m_tubeManager->forEachAssignedTube([&transient](LaunchTube& tube) {
+        EN_WPN_CTRL_STATE state = tube.getWeaponState();
+        bool launched = tube.isLaunched();
+        if (state != EN_WPN_CTRL_STATE::WPN_CTRL_STATE_RTL && RestoredWeaponState(state, launched) != state) {
+            transient.push_back(ReplicatedTubeState{tube.getTubeNumber(), state, launched});
+        }
+    });
+    for (const auto& tube : transient) {
+        m_tubeManager->restoreWeaponState(tube.tubeNumber, tube.state, tube.launched);
+    }
+    
+    bool synchronized = m_replicaSynchronized;
+    m_replication->close();
+    m_replication.reset();
+    m_replicationRole = ReplicationRole::NONE;
+    m_promoted = true;
+    m_promotionMilliseconds = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+    MetricsRegistry::getInstance().counter(
+        "replication_failovers_total", "Standby promotions after the primary stopped or missed its heartbeat").increment();
+    
+    std::cout << "Replication standby promoted to primary in " << m_promotionMilliseconds << " ms ("
+              << m_tubeManager->getAssignedTubeCount() << " tubes, " << transient.size() << " transient states settled"
+              << (synchronized ? "" : ", mirror was not synchronized") << ")" << std::endl;
+    return Result<void>::success();
+}
+
+ReplicationStatus WeaponControlService::getReplicationStatus() const {
+    ReplicationStatus status;
+    status.role = m_replicationRole;
+    status.connected = m_replication && m_replication->isOpen();
+    status.synchronized = m_replicationRole == ReplicationRole::STANDBY && m_replicaSynchronized;
+    status.promoted = m_promoted;
+    status.backlog = status.connected ? m_replication->backlog() : 0;
+    status.environmentGeneration = m_environmentGeneration.load(std::memory_order_relaxed);
+    status.primaryEnvironmentGeneration = m_replicationRole == ReplicationRole::STANDBY && status.connected
+        ? m_replication->primaryEnvironmentGeneration() : status.environmentGeneration;
+    status.applyFailures = m_replicationApplyFailures;
+    status.planVersions.reserve(m_planVersions.size());
+    for (const auto& version : m_planVersions) {
+        status.planVersions.push_back(version.load(std::memory_order_relaxed));
+    }
+    status.promotionMilliseconds = m_promotionMilliseconds;
+    return status;
+}
+
+// =============================================================================
+// 시스템 스냅샷
+// =============================================================================
+
+void WeaponControlService::reserveSnapshots() {
+    size_t tubeCount = m_planVersions.size();
+    m_snapshots.forEachSlot([tubeCount](SystemSnapshot& snapshot) {
+        snapshot.tubes.reserve(tubeCount);
+        snapshot.engagementResults.resize(tubeCount);
+        for (auto& result : snapshot.engagementResults) {
+            result.trajectory.reserve(MAX_TRAJECTORY_POINTS);
+        }
+        snapshot.planVersions.reserve(tubeCount);
+    });
+}
+
+void WeaponControlService::publishSystemSnapshot(uint64_t environmentGeneration) {
+    // 호출자가 m_snapshotMutex 를 배타로 잡고 있어 명령/환경 입력이 수집 중에 상태를 바꾸지 못한다
+    SystemSnapshot* snapshot = m_snapshots.beginWrite();
+    if (!snapshot) {
+        m_snapshotSkipped.increment();
+        return;
+    }
+    
+    m_tubeManager->getAllTubeStatus(snapshot->tubes);
+    m_tubeManager->copyAllEngagementResults(snapshot->engagementResults);
+    snapshot->planVersions.resize(m_planVersions.size());
+    for (size_t i = 0; i < m_planVersions.size(); ++i) {
+        snapshot->planVersions[i] = m_planVersions[i].load(std::memory_order_relaxed);
+    }
+    
+    snapshot->epoch = ++m_snapshotEpoch;
+    snapshot->environmentGeneration = environmentGeneration;
+    snapshot->timestamp = ClockProvider::get().now();
+    m_snapshots.publish();
+}
+
+void WeaponControlService::shutdown() {
+    if (m_realTimeMode) {
+        AllocationGuard::arm(false);
+        m_realTimeMode = false;
+    }
+    
+    // 주 인스턴스 정상 종료 표시 (대기 인스턴스는 다음 주기에 승격)
+    if (m_replication) {
+        m_replication->markPrimaryStopped();
+        m_replication->close();
+        m_replication.reset();
+        m_replicationRole = ReplicationRole::NONE;
+    }
+    
+    // 체크포인트 내용은 유지 (다음 시작 시 복원)
+    if (m_checkpoint) {
+        m_checkpoint->close();
+        m_checkpoint.reset();
+    }
+    m_tubeManager->shutdown();
+    m_initialized = false;
+    std::cout << "WeaponControlService shutdown complete" << std::endl;
+}
+
+Result<void> WeaponControlService::assignWeapon(const WeaponAssignmentRequest& request) {
+    if (isStandby()) {
+        return Result<void>::failure("Standby instance does not accept commands");
+    }
+    std::shared_lock<ProfiledSharedMutex> snapshotLock(m_snapshotMutex);
+    ScopedWaitYield yieldDuringWaits(snapshotLock);
+    if (m_eventRecorder) {
+        m_eventRecorder->record(EventType::ASSIGN, request);
+    }
+    
+    auto start = std::chrono::steady_clock::now();
+    auto result = m_tubeManager->assignWeapon(request);
+    if (result && m_checkpoint) {
+        m_checkpoint->writeTubeState(request, EN_WPN_CTRL_STATE::WPN_CTRL_STATE_OFF, false);
+    }
+    if (result) {
+        replicate(ReplicationRecordType::ASSIGN, request);
+    }
+    recordCommand(CommandType::ASSIGN, start, result.isSuccess());
+    return result;
+}
+
+Result<void> WeaponControlService::unassignWeapon(uint16_t tubeNumber) {
+    if (isStandby()) {
+        return Result<void>::failure("Standby instance does not accept commands");
+    }
+    std::shared_lock<ProfiledSharedMutex> snapshotLock(m_snapshotMutex);
+    ScopedWaitYield yieldDuringWaits(snapshotLock);
+    if (m_eventRecorder) {
+        m_eventRecorder->record(EventType::UNASSIGN, tubeNumber);
+    }
+    
+    auto start = std::chrono::steady_clock::now();
+    auto result = m_tubeManager->unassignWeapon(tubeNumber);
+    if (result && m_checkpoint) {
+        m_checkpoint->clearTube(tubeNumber);
+    }
+    if (result) {
+        replicate(ReplicationRecordType::UNASSIGN, tubeNumber);
+    }
+    recordCommand(CommandType::UNASSIGN, start, result.isSuccess());
+    return result;
+}
+
+Result<void> WeaponControlService::controlWeapon(const WeaponControlRequest& request) {
+    ScopedNoAllocation noAllocation("controlWeapon");
+    if (isStandby()) {
+        return Result<void>::failure("Standby instance does not accept commands");
+    }
+    std::shared_lock<ProfiledSharedMutex> snapshotLock(m_snapshotMutex);
+    // 전이 대기(POC 지연, 발사 단계, 다른 명령의 전이) 동안에는 잠금을 양보한다
+    ScopedWaitYield yieldDuringWaits(snapshotLock);
+    if (m_eventRecorder) {
+        m_eventRecorder->record(EventType::CONTROL, request);
+    }
+    
+    auto start = std::chrono::steady_clock::now();
+    auto result = m_tubeManager->requestWeaponStateChange(request);
+    recordCommand(CommandType::CONTROL, start, result.isSuccess());
+    return result;
+}
+
+Result<void> WeaponControlService::updateWaypoints(const WaypointUpdateRequest& request) {
+    if (isStandby()) {
+        return Result<void>::failure("Standby instance does not accept commands");
+    }
+    std::shared_lock<ProfiledSharedMutex> snapshotLock(m_snapshotMutex);
+    if (m_eventRecorder) {
+        m_eventRecorder->record(EventType::WAYPOINTS, request);
+    }
+    
+    auto start = std::chrono::steady_clock::now();
+    auto result = m_tubeManager->updateWaypoints(request);
+    if (result && m_checkpoint) {
+        m_checkpoint->writeWaypoints(request.tubeNumber, request.waypoints);
+    }
+    if (result) {
+        replicate(ReplicationRecordType::WAYPOINTS, request);
+    }
+    recordCommand(CommandType::WAYPOINTS, start, result.isSuccess());
+    return result;
+}
+
+Result<void> WeaponControlService::emergencyStop() {
+    if (isStandby()) {
+        return Result<void>::failure("Standby instance does not accept commands");
+    }
+    std::shared_lock<ProfiledSharedMutex> snapshotLock(m_snapshotMutex);
+    ScopedWaitYield yieldDuringWaits(snapshotLock);
+    if (m_eventRecorder) {
+        m_eventRecorder->record(EventType::EMERGENCY_STOP);
+    }
+    
+    auto start = std::chrono::steady_clock::now();
+    auto result = m_tubeManager->emergencyStop();
+    recordCommand(CommandType::EMERGENCY_STOP, start, result.isSuccess());
+    return result;
+}
+
+void WeaponControlService::updateOwnShipInfo(const NAVINF_SHIP_NAVIGATION_INFO& ownShip) {
+    ScopedNoAllocation noAllocation("updateOwnShipInfo");
+    if (isStandby()) {
+        return;
+    }
+    // 환경 입력도 교전계획을 다시 계산하므로 명령과 같이 스냅샷 수집/주기 갱신과 배타
+    std::shared_lock<ProfiledSharedMutex> snapshotLock(m_snapshotMutex);
+    if (m_eventRecorder) {
+        m_eventRecorder->record(EventType::OWN_SHIP, ownShip);
+    }
+    m_tubeManager->updateOwnShipInfo(ownShip);
+    replicate(ReplicationRecordType::OWN_SHIP, ownShip, nextEnvironmentGeneration());
+}
+
+void WeaponControlService::updateTargetInfo(const TRKMGR_SYSTEMTARGET_INFO& target) {
+    ScopedNoAllocation noAllocation("updateTargetInfo");
+    if (isStandby()) {
+        return;
+    }
+    // 환경 입력도 교전계획을 다시 계산하므로 명령과 같이 스냅샷 수집/주기 갱신과 배타
+    std::shared_lock<ProfiledSharedMutex> snapshotLock(m_snapshotMutex);
+    if (m_eventRecorder) {
+        m_eventRecorder->record(EventType::TRACK, target);
+    }
+    m_targetService->updateTargetInfo(target);
+    m_tubeManager->updateTargetInfo(target);
+    if (m_checkpoint) {
+        m_checkpoint->writeTarget(target);
+    }
+    replicate(ReplicationRecordType::TARGET, target, nextEnvironmentGeneration());
+}
+
+void WeaponControlService::setAxisCenter(const GEO_POINT_2D& axisCenter) {
+    ScopedNoAllocation noAllocation("setAxisCenter");
+    if (isStandby()) {
+        return;
+    }
+    // 환경 입력도 교전계획을 다시 계산하므로 명령과 같이 스냅샷 수집/주기 갱신과 배타
+    std::shared_lock<ProfiledSharedMutex> snapshotLock(m_snapshotMutex);
+    if (m_eventRecorder) {
+        m_eventRecorder->record(EventType::AXIS_CENTER, axisCenter);
+    }
+    m_tubeManager->setAxisCenter(axisCenter);
+    replicate(ReplicationRecordType::AXIS_CENTER, axisCenter, nextEnvironmentGeneration());
+}
+
+std::vector<LaunchTubeStatus> WeaponControlService::getAllTubeStatus() const {
+    return m_tubeManager->getAllTubeStatus();
+}
+
+void WeaponControlService::getAllTubeStatus(std::vector<LaunchTubeStatus>& statuses) const {
+    m_tubeManager->getAllTubeStatus(statuses);
+}
+
+LaunchTubeStatus WeaponControlService::getTubeStatus(uint16_t tubeNumber) const {
+    return m_tubeManager->getTubeStatus(tubeNumber);
+}
+
+std::vector<EngagementPlanResult> WeaponControlService::getAllEngagementResults() const {
+    return m_tubeManager->getAllEngagementResults();
+}
+
+EngagementPlanResult WeaponControlService::getEngagementResult(uint16_t tubeNumber) const {
+    return m_tubeManager->getEngagementResult(tubeNumber);
+}
+
+void WeaponControlService::update() {
+    // 이중화 채널 처리는 할당 감시 밖 (재전송/미러 적용은 무장 객체 생성을 포함)
+    if (m_replication && !serviceReplication()) {
+        std::unique_lock<ProfiledSharedMutex> lock(m_snapshotMutex, std::defer_lock);
+        lockTraced(lock, "m_snapshotMutex");
+        publishSystemSnapshot(m_environmentGeneration.load(std::memory_order_relaxed));     // 대기: 미러 상태
+        return;
+    }
+    
+    ScopedNoAllocation noAllocation("update");
+    {
+        // 주기 갱신(발사관 전이, 교전계획 재계산)과 스냅샷 수집을 한 배타 구간으로 묶어
+        // 명령/환경 입력의 재계산이 그 사이에 끼어들지 못하게 한다
+        std::unique_lock<ProfiledSharedMutex> lock(m_snapshotMutex, std::defer_lock);
+        lockTraced(lock, "m_snapshotMutex");
+        if (m_eventRecorder) {
+            m_eventRecorder->record(EventType::UPDATE_TICK);
+        }
+        uint64_t environmentGeneration = m_environmentGeneration.load(std::memory_order_relaxed);
+        m_tubeManager->update();
+        if (m_replicationRole == ReplicationRole::PRIMARY) {
+            m_replication->heartbeat(m_environmentGeneration.load(std::memory_order_relaxed));
+        }
+        publishSystemSnapshot(environmentGeneration);
+    }
+    m_lastUpdateTime.store(ClockProvider::get().now().time_since_epoch().count(), std::memory_order_relaxed);
+}
+
+void WeaponControlService::calculateAllEngagementPlans() {
+    std::shared_lock<ProfiledSharedMutex> snapshotLock(m_snapshotMutex);
+    m_tubeManager->calculateAllEngagementPlans();
+}
+
+void WeaponControlService::setStateChangeCallback(std::function<void(uint16_t, EN_WPN_CTRL_STATE, EN_WPN_CTRL_STATE)> callback) {
+    m_stateChangeCallback = callback;
+}
+
+void WeaponControlService::setLaunchStatusCallback(std::function<void(uint16_t, bool)> callback) {
+    m_launchStatusCallback = callback;
+}
+
+void WeaponControlService::setEngagementPlanCallback(std::function<void(uint16_t, const EngagementPlanResult&)> callback) {
+    m_engagementPlanCallback = callback;
+}
+
+void WeaponControlService::setEngagementPlanBatchCallback(std::function<void(const EngagementPlanBatch&)> callback) {
+    m_engagementPlanBatchCallback = callback;
+}
+
+void WeaponControlService::setAssignmentChangeCallback(std::function<void(uint16_t, EN_WPN_KIND, bool)> callback) {
+    m_tubeManager->setAssignmentChangeCallback(callback);
+}
+
+size_t WeaponControlService::getAssignedTubeCount() const {
+    return m_tubeManager->getAssignedTubeCount();
+}
+
+size_t WeaponControlService::getReadyTubeCount() const {
+    return m_tubeManager->getReadyTubeCount();
+}
+
+SystemStatistics WeaponControlService::getSystemStatistics() const {
+    auto& metrics = MetricsRegistry::getInstance();
+    
+    SystemStatistics statistics;
+    statistics.totalCommands = static_cast<uint32_t>(metrics.counterTotal("weapon_commands_total"));
+    statistics.successfulCommands = static_cast<uint32_t>(metrics.counterTotal("weapon_commands_total", "result=\"success\""));
+    statistics.failedCommands = statistics.totalCommands - statistics.successfulCommands;
+    statistics.assignedTubes = static_cast<uint32_t>(m_tubeManager->getAssignedTubeCount());
+    statistics.readyTubes = static_cast<uint32_t>(m_tubeManager->getReadyTubeCount());
+    statistics.launchedWeapons = static_cast<uint32_t>(metrics.counterTotal("weapon_launches_total"));
+    statistics.systemStartTime = m_startTime;
+    statistics.lastUpdateTime = IClock::TimePoint(IClock::Duration(m_lastUpdateTime.load(std::memory_order_relaxed)));
+    return statistics;
+}
+
+void WeaponControlService::setEventRecorder(std::shared_ptr<EventRecorder> recorder) {
+    m_eventRecorder = std::move(recorder);
+    if (m_initialized) {
+        recordSessionStart();
+    }
+}
+
+void WeaponControlService::recordSessionStart() {
+    if (m_eventRecorder) {
+        SessionStartEvent session;
+        session.tubeCount = static_cast<uint16_t>(m_tubeManager->getAllTubeStatus().size());
+        m_eventRecorder->record(EventType::SESSION_START, session);
+    }
+}
+
+std::string WeaponControlService::exportMetrics() const {
+    return MetricsRegistry::getInstance().exportPrometheus();
+}
+
+void WeaponControlService::recordCommand(CommandType type, std::chrono::steady_clock::time_point start, bool success) {
+    auto& metrics = m_commandMetrics[static_cast<size_t>(type)];
+    (success ? metrics.success : metrics.failure)->increment();
+    metrics.durationUs->record(static_cast<uint64_t>(
+        std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start).count()));
+}
+
+std::vector<StageTimingStats> WeaponControlService::getStageTimings() const {
+    return StageProfiler::getInstance().snapshot();
+}
+
+void WeaponControlService::resetStageTimings() {
+    StageProfiler::getInstance().reset();
+}
+
+void WeaponControlService::setStageProfilingEnabled(bool enabled) {
+    StageProfiler::getInstance().setEnabled(enabled);
+}
+
+void WeaponControlService::startTracing(size_t eventsPerThread) {
+    TraceRecorder::getInstance().start(eventsPerThread);
+}
+
+Result<void> WeaponControlService::stopTracing(const std::string& outputPath) {
+    auto& tracer = TraceRecorder::getInstance();
+    tracer.stop();
+    return tracer.writeChromeTrace(outputPath);
+}
+
+std::string WeaponControlService::getLockContentionReport() const {
+    return LockProfiler::getInstance().formatReport();
+}
+
+MemoryReport WeaponControlService::getMemoryReport() const {
+    MemoryReport report;
+    report.accounts = MemoryAccounting::getInstance().snapshot();
+    
+    if (m_tubeManager) {
+        m_tubeManager->forEachAssignedTube([&report](LaunchTube& tube) {
+            auto weapon = tube.getWeapon();
+            report.tubes.push_back(TubeMemoryFootprint{
+                tube.getTubeNumber(),
+                weapon ? weapon->getWeaponKind() : EN_WPN_KIND::WPN_KIND_NA,
+                tube.getMemoryFootprint()});
+        });
+    }
+    
+    return report;
+}
+
+// =============================================================================
+// MemoryReport 구현
+// =============================================================================
+
+int64_t MemoryReport::accountedLiveBytes() const {
+    int64_t total = 0;
+    for (const auto& account : accounts) {
+        total += account.liveBytes;
+    }
+    return total;
+}
+
+size_t MemoryReport::tubeTotalBytes() const {
+    size_t total = 0;
+    for (const auto& tube : tubes) {
+        total += tube.footprint.total();
+    }
+    return total;
+}
+
+std::string MemoryReport::format() const {
+    std::ostringstream out;
+    
+    out << std::left << std::setw(20) << "account" << std::right
+        << std::setw(12) << "live B" << std::setw(12) << "peak B"
+        << std::setw(12) << "allocs" << std::setw(12) << "frees" << "\n";
+    for (const auto& account : accounts) {
+        out << std::left << std::setw(20) << account.name << std::right
+            << std::setw(12) << account.liveBytes << std::setw(12) << account.peakBytes
+            << std::setw(12) << account.allocations << std::setw(12) << account.deallocations << "\n";
+    }
+    out << std::left << std::setw(20) << "total" << std::right << std::setw(12) << accountedLiveBytes() << "\n";
+    
+    out << std::left << std::setw(8) << "tube" << std::setw(12) << "weapon" << std::right
+        << std::setw(12) << "traj B" << std::setw(12) << "wp B"
+        << std::setw(12) << "obs B" << std::setw(12) << "other B" << "\n";
+    for (const auto& tube : tubes) {
+        out << std::left << std::setw(8) << tube.tubeNumber << std::setw(12) << WeaponKindToString(tube.weaponKind)
+            << std::right << std::setw(12) << tube.footprint.trajectoryBytes
+            << std::setw(12) << tube.footprint.waypointBytes
+            << std::setw(12) << tube.footprint.observerBytes
+            << std::setw(12) << tube.footprint.otherBytes << "\n";
+    }
+    out << std::left << std::setw(20) << "tube total" << std::right << std::setw(12) << tubeTotalBytes() << "\n";
+    
+    return out.str();
+}
+
 } // namespace WeaponControl
@@ -1,6 +1,10 @@
 #pragma once
 
 #include "../../Common/Types/CommonTypes.h"
+#include "../../Infrastructure/Diagnostics/LockProfiler.h"
+#include "../../Infrastructure/Diagnostics/MemoryAccounting.h"
+#include "../../Infrastructure/Diagnostics/MetricsRegistry.h"
+#include "../../Infrastructure/RealTime/MapNodePool.h"
 #include <optional>
 #include <vector>
 #include <string>
@@ -20,6 +24,9 @@ public:
     virtual std::vector<uint32_t> getAllTargetIds() const = 0;
     virtual size_t getTargetCount() const = 0;
     virtual void clearOldTargets(std::chrono::seconds maxAge) = 0;
+    
+    // 표적 저장소 노드 미리 확보 (실시간 모드, 이후 신규 표적 등록 시 할당 없음)
+    virtual void reserveTargets(size_t maxTargets) = 0;
 };
 
 // =============================================================================
@@ -69,7 +76,7 @@ public:
 
 class TargetTrackingService : public ITargetTrackingService {
 public:
-    TargetTrackingService() = default;
+    TargetTrackingService();
     ~TargetTrackingService() = default;
     
     void updateTargetInfo(const TRKMGR_SYSTEMTARGET_INFO& targetInfo) override;
@@ -77,6 +84,7 @@ public:
     std::vector<uint32_t> getAllTargetIds() const override;
     size_t getTargetCount() const override;
     void clearOldTargets(std::chrono::seconds maxAge) override;
+    void reserveTargets(size_t maxTargets) override;
 
 private:
     struct TargetData {
@@ -84,8 +92,18 @@ private:
         std::chrono::steady_clock::time_point lastUpdateTime;
     };
     
-    mutable std::shared_mutex m_targetsMutex;
-    std::map<uint32_t, TargetData> m_targets;
+    using TargetMap = AccountedMap<uint32_t, TargetData, MemoryAccountId::TARGET_STORE>;
+    
+    // m_targetsMutex 를 보유한 상태에서 호출
+    void removeOldTargetsLocked(std::chrono::seconds maxAge, std::chrono::steady_clock::time_point now);
+    
+    mutable ProfiledSharedMutex m_targetsMutex{"TargetTrackingService::m_targetsMutex"};
+    TargetMap m_targets;
+    MapNodePool<TargetMap> m_targetNodes;
+    std::chrono::steady_clock::time_point m_lastCleanupTime{};
+    
+    MetricCounter& m_ingestCounter;
+    MetricGauge& m_trackedTargetsGauge;
 };
 
 // =============================================================================
@@ -137,8 +155,9 @@ private:
     bool validatePosition(const ST_WEAPON_WAYPOINT& position) const;
     
     // 캐시된 계획 데이터
-    mutable std::map<uint32_t, std::vector<ST_M_MINE_PLAN_INFO>> m_cachedPlans;
-    mutable std::shared_mutex m_plansMutex;
+    using CachedPlanList = AccountedVector<ST_M_MINE_PLAN_INFO, MemoryAccountId::PLAN_CACHE>;
+    mutable AccountedMap<uint32_t, CachedPlanList, MemoryAccountId::PLAN_CACHE> m_cachedPlans;
+    mutable ProfiledSharedMutex m_plansMutex{"MineDropPlanService::m_plansMutex"};
     
     // 설정
     std::string m_planDataPath;
@@ -1,13 +1,96 @@
 #pragma once
 
 #include "../LaunchTube/LaunchTubeManager.h"
-#include "ITargetTrackingService.h"
-#include "IMineDropPlanService.h"
+#include "ServiceInterfaces.h"
 #include "../../Common/Types/CommonTypes.h"
+#include "../../Infrastructure/Diagnostics/StageProfiler.h"
+#include "../../Infrastructure/Diagnostics/MetricsRegistry.h"
+#include "../../Infrastructure/Diagnostics/TraceRecorder.h"
+#include "../../Infrastructure/Diagnostics/MemoryAccounting.h"
+#include "../../Infrastructure/Recording/EventRecorder.h"
+#include "../../Infrastructure/Persistence/StateCheckpoint.h"
+#include "../../Infrastructure/Replication/ReplicationChannel.h"
+#include "../../Infrastructure/RealTime/RealTimeMemory.h"
+#include "../../Infrastructure/RealTime/SnapshotExchange.h"
+#include <array>
+#include <atomic>
 #include <memory>
 
 namespace WeaponControl {
 
+// =============================================================================
+// 메모리 사용량 보고서
+// =============================================================================
+
+struct TubeMemoryFootprint {
+    uint16_t tubeNumber;
+    EN_WPN_KIND weaponKind;
+    MemoryFootprint footprint;
+};
+
+struct MemoryReport {
+    std::vector<MemoryAccountStats> accounts;       // 서비스/구성요소별 계정
+    std::vector<TubeMemoryFootprint> tubes;         // 할당된 발사관별
+    
+    int64_t accountedLiveBytes() const;
+    size_t tubeTotalBytes() const;
+    std::string format() const;
+};
+
+// =============================================================================
+// 체크포인트 복원 결과
+// =============================================================================
+
+struct CheckpointRestoreReport {
+    bool restored = false;
+    size_t tubes = 0;                   // 복원한 할당
+    size_t targets = 0;
+    size_t failedTubes = 0;             // 할당/상태 복원 실패
+    size_t discardedRecords = 0;        // 기록 중단/체크섬 불일치
+    double loadMilliseconds = 0.0;      // 파일 읽기/해석
+    double restoreMilliseconds = 0.0;   // 읽기 + 할당/경로점/상태 적용
+};
+
+// =============================================================================
+// 이중화 상태
+// =============================================================================
+
+struct ReplicationStatus {
+    ReplicationRole role = ReplicationRole::NONE;
+    bool connected = false;                     // 채널 연결 (대기: 주 인스턴스 채널 발견)
+    bool synchronized = false;                  // 대기: 전체 상태 수신 완료
+    bool promoted = false;                      // 대기에서 승격됨
+    uint64_t backlog = 0;                       // 적용 대기 레코드
+    uint64_t environmentGeneration = 0;         // 이 인스턴스가 반영한 환경 세대
+    uint64_t primaryEnvironmentGeneration = 0;  // 대기: 주 인스턴스의 현재 세대
+    uint64_t applyFailures = 0;
+    std::vector<uint32_t> planVersions;         // 발사관별 교전계획 버전 (인덱스 = 발사관 번호 - 1)
+    double promotionMilliseconds = 0.0;         // 남은 변경 적용 + 진행 중 절차 정리
+};
+
+// =============================================================================
+// 시스템 스냅샷 (update 마다 한 번 게시되는 불변 상태)
+//
+// 모든 발사관의 상태와 교전계획을 명령/환경 입력 처리와 겹치지 않는 한 시점에
+// 수집하므로 발사관 간 상태가 섞이지 않는다. 읽는 쪽은 getSystemSnapshot() 핸들을
+// 잡고 있는 동안 내용을 그대로 읽을 수 있다.
+// =============================================================================
+
+struct SystemSnapshot {
+    uint64_t epoch = 0;                                 // 게시 순번 (1부터)
+    uint64_t environmentGeneration = 0;                 // 이번 주기 교전계획 계산 시작 시점의 환경 세대
+    IClock::TimePoint timestamp;                        // 수집 시각 (ClockProvider)
+    std::vector<LaunchTubeStatus> tubes;                // 전체 발사관 (인덱스 = 발사관 번호 - 1)
+    std::vector<EngagementPlanResult> engagementResults;  // 전체 발사관, 미할당은 무효 결과
+    std::vector<uint32_t> planVersions;                 // 발사관별 교전계획 버전
+    
+    const LaunchTubeStatus* tube(uint16_t tubeNumber) const {
+        return tubeNumber >= 1 && tubeNumber <= tubes.size() ? &tubes[tubeNumber - 1] : nullptr;
+    }
+};
+
+using SystemSnapshotHandle = SnapshotExchange<SystemSnapshot>::Handle;
+
 // =============================================================================
 // 무장 통제 서비스 - 핵심 비즈니스 로직
 // =============================================================================
@@ -28,6 +111,34 @@ public:
     Result<void> initialize();
     void shutdown();
     
+    // 실시간 메모리 모드 진입 (RealTime.Enabled 이면 initialize 에서 호출)
+    // 표적 저장소 예약, 메모리 고정 및 힙/스택 선점 후 주기 갱신과 정상 상태
+    // 명령(통제, 표적/항법/축 중심 갱신)의 할당 감시를 시작한다.
+    // 주기/명령 스레드가 호출 스레드와 다르면 각 스레드에서
+    // RealTimeMemory::prefaultStack() 을 호출한다.
+    Result<void> enterRealTimeMode(const RealTimeMemoryConfig& config);
+    bool isRealTimeMode() const { return m_realTimeMode; }
+    
+    // 재시작 복구 (Checkpoint.Enabled 이면 initialize 에서 호출)
+    // 체크포인트 파일의 할당, 무장 상태, 경로점, 표적, 선택된 부설계획 목록을
+    // 다시 적용한 뒤 이후 상태 변경을 해당 레코드에 기록한다.
+    Result<void> enableStateCheckpoint(const StateCheckpointConfig& config);
+    const CheckpointRestoreReport& getCheckpointRestoreReport() const { return m_restoreReport; }
+    
+    // 상시 대기 이중화 (Replication.Role 이 primary/standby 이면 initialize 에서 호출)
+    // 주 인스턴스는 할당/상태 전이/경로점/환경 정보/교전계획 버전을 공유 메모리
+    // 채널에 게시하고, 대기 인스턴스는 update 마다 이를 발사관 관리자에 적용한다.
+    // 대기 인스턴스는 명령과 환경 입력을 받지 않으며, 주 인스턴스가 정상
+    // 종료하거나 주기 신호가 끊기면 그 update 에서 승격하여 바로 주기를 수행한다.
+    Result<void> startReplication(const ReplicationConfig& config);
+    Result<void> promoteToPrimary();
+    bool isStandby() const { return m_replicationRole == ReplicationRole::STANDBY; }
+    ReplicationStatus getReplicationStatus() const;
+    
+    // 최근 주기의 시스템 스냅샷 (대기 없음, 첫 update 이전에는 빈 핸들)
+    // 핸들을 오래 잡고 있으면 해당 슬롯을 재사용하지 못하므로 읽은 뒤 바로 해제한다.
+    SystemSnapshotHandle getSystemSnapshot() const { return m_snapshots.acquire(); }
+    
     // ==========================================================================
     // 핵심 비즈니스 로직
     // ==========================================================================
@@ -37,6 +148,11 @@ public:
     Result<void> updateWaypoints(const CMSHCI_AIEP_WPN_GEO_WAYPOINTS& waypointsMsg);
     Result<void> emergencyStop();
     
+    // 내부 요청 구조체 직접 처리 (DDS 변환 이후 경로, 부하 생성기/시뮬레이션 입력)
+    Result<void> assignWeapon(const WeaponAssignmentRequest& request);
+    Result<void> controlWeapon(const WeaponControlRequest& request);
+    Result<void> updateWaypoints(const WaypointUpdateRequest& request);
+    
     // ==========================================================================
     // 환경 정보 업데이트
     // ==========================================================================
@@ -55,6 +171,7 @@ public:
     // 조회 기능
     // ==========================================================================
     std::vector<LaunchTubeStatus> getAllTubeStatus() const;
+    void getAllTubeStatus(std::vector<LaunchTubeStatus>& statuses) const;
     LaunchTubeStatus getTubeStatus(uint16_t tubeNumber) const;
     std::vector<EngagementPlanResult> getAllEngagementResults() const;
     EngagementPlanResult getEngagementResult(uint16_t tubeNumber) const;
@@ -73,13 +190,88 @@ public:
     void setEngagementPlanCallback(std::function<void(uint16_t, const EngagementPlanResult&)> callback);
     void setAssignmentChangeCallback(std::function<void(uint16_t, EN_WPN_KIND, bool)> callback);
     
+    // 교전계획 갱신 묶음 (System.EngagementPlanBatching 이 켜져 있을 때 주기마다 한 번).
+    // 묶음 모드에서는 발사관별 교전계획 콜백을 호출하지 않고, 꺼져 있으면 묶음 콜백을 호출하지 않는다.
+    void setEngagementPlanBatchCallback(std::function<void(const EngagementPlanBatch&)> callback);
+    
     // ==========================================================================
     // 통계 정보
     // ==========================================================================
     size_t getAssignedTubeCount() const;
     size_t getReadyTubeCount() const;
+    SystemStatistics getSystemStatistics() const;
+    
+    // 운용 지표 스냅샷 (Prometheus text 형식)
+    std::string exportMetrics() const;
+    
+    // ==========================================================================
+    // 이벤트 기록 (입력 메시지 및 상태/교전계획 콜백, 오프라인 재생용)
+    // ==========================================================================
+    void setEventRecorder(std::shared_ptr<EventRecorder> recorder);
+    
+    // 구간별 처리 시간 (100ms 주기 예산 분석용)
+    std::vector<StageTimingStats> getStageTimings() const;
+    void resetStageTimings();
+    void setStageProfilingEnabled(bool enabled);
+    
+    // 타임라인 추적 (상태 전이/발사 단계/교전계획/주기/잠금 대기, Chrome trace JSON)
+    void startTracing(size_t eventsPerThread = TraceRecorder::DEFAULT_EVENTS_PER_THREAD);
+    Result<void> stopTracing(const std::string& outputPath);
+    
+    // 잠금별 대기/보유 시간 및 잠금 순서 보고서 (WEAPONCONTROL_LOCK_PROFILING 빌드)
+    std::string getLockContentionReport() const;
+    
+    // 구성요소 계정별 현재/최대 사용량과 할당된 발사관별 궤적/경로점 메모리
+    MemoryReport getMemoryReport() const;
     
 private:
+    // ==========================================================================
+    // 명령 지표
+    // ==========================================================================
+    enum class CommandType : uint8_t {
+        ASSIGN = 0,
+        UNASSIGN,
+        CONTROL,
+        WAYPOINTS,
+        EMERGENCY_STOP,
+        COUNT
+    };
+    static constexpr size_t COMMAND_TYPE_COUNT = static_cast<size_t>(CommandType::COUNT);
+    
+    struct CommandMetrics {
+        MetricCounter* success = nullptr;
+        MetricCounter* failure = nullptr;
+        MetricHistogram* durationUs = nullptr;
+    };
+    
+    void recordCommand(CommandType type, std::chrono::steady_clock::time_point start, bool success);
+    void recordSessionStart();
+    
+    // 체크포인트 내용을 관리자/서비스에 적용 (기록 연결 전)
+    void restoreCheckpoint(const CheckpointContents& contents);
+    void writeFullCheckpoint(const CheckpointContents& contents);
+    
+    // 이중화: 주 인스턴스 게시, 대기 인스턴스 적용
+    template<typename T>
+    void replicate(ReplicationRecordType type, const T& payload, uint64_t generation = 0) {
+        if (m_replicationRole == ReplicationRole::PRIMARY) {
+            m_replication->publish(type, payload, generation);
+        }
+    }
+    uint64_t nextEnvironmentGeneration();
+    void publishFullState();
+    bool serviceReplication();     // false: 대기 중 (이번 주기 생략)
+    size_t applyReplication();
+    void applyReplicationRecord(ReplicationRecordType type, uint64_t generation, EventDecoder& decoder);
+    void clearReplica();
+    
+    // 교전계획 갱신 기록/복제 (발사관별 또는 묶음 전달에서 호출, 통지는 호출자가 수행)
+    void recordEngagementPlanUpdate(uint16_t tubeNumber, const EngagementPlanResult& result);
+    
+    // 시스템 스냅샷 수집/게시 (update 스레드, m_snapshotMutex 배타 보유 중)
+    void reserveSnapshots();
+    void publishSystemSnapshot(uint64_t environmentGeneration);
+    
     // ==========================================================================
     // DDS 메시지 변환 헬퍼
     // ==========================================================================
@@ -101,6 +293,36 @@ private:
     
     uint32_t m_selectedPlanListNumber;
     bool m_initialized;
+    bool m_realTimeMode;
+    
+    std::array<CommandMetrics, COMMAND_TYPE_COUNT> m_commandMetrics;
+    std::shared_ptr<EventRecorder> m_eventRecorder;
+    std::unique_ptr<StateCheckpoint> m_checkpoint;
+    CheckpointRestoreReport m_restoreReport;
+    
+    ReplicationConfig m_replicationConfig;
+    ReplicationRole m_replicationRole;
+    std::unique_ptr<ReplicationChannel> m_replication;
+    bool m_replicaSynchronized;
+    bool m_promoted;
+    double m_promotionMilliseconds;
+    uint64_t m_replicationApplyFailures;
+    std::atomic<uint64_t> m_environmentGeneration;
+    std::vector<std::atomic<uint32_t>> m_planVersions;
+    
+    // 명령/환경 입력(공유)과 주기 갱신 + 스냅샷 수집(배타)을 직렬화하여 발사관 간 일관성 보장
+    // 명령은 상태를 읽고 바꾸는 동안만 잡고, 무장 전이 대기 중에는 양보한다 (ScopedWaitYield)
+    mutable ProfiledSharedMutex m_snapshotMutex{"WeaponControlService::m_snapshotMutex"};
+    SnapshotExchange<SystemSnapshot> m_snapshots;
+    uint64_t m_snapshotEpoch;
+    MetricCounter& m_snapshotSkipped;
+    
+    std::function<void(uint16_t, EN_WPN_CTRL_STATE, EN_WPN_CTRL_STATE)> m_stateChangeCallback;
+    std::function<void(uint16_t, bool)> m_launchStatusCallback;
+    std::function<void(uint16_t, const EngagementPlanResult&)> m_engagementPlanCallback;
+    std::function<void(const EngagementPlanBatch&)> m_engagementPlanBatchCallback;
+    IClock::TimePoint m_startTime;
+    std::atomic<IClock::Duration::rep> m_lastUpdateTime;
 };
 
 } // namespace WeaponControl
@@ -1,8 +1,11 @@
 #pragma once
 
 #include "../../Common/Types/CommonTypes.h"
+#include "../../Infrastructure/Diagnostics/LockProfiler.h"
+#include "../../Infrastructure/Diagnostics/MemoryAccounting.h"
 #include <functional>
 #include <memory>
+#include <set>
 #include <vector>
 
 namespace WeaponControl {
@@ -41,6 +44,9 @@ public:
                                            const CancellationToken& token = {}) = 0;
     virtual bool isValidTransition(EN_WPN_CTRL_STATE from, EN_WPN_CTRL_STATE to) const = 0;
     
+    // 체크포인트 복원 - 전이 절차(POC 지연, 발사 단계) 없이 상태를 바로 설정
+    virtual void restoreState(EN_WPN_CTRL_STATE state, bool launched) = 0;
+    
     // ==========================================================================
     // 발사 관리
     // ==========================================================================
@@ -66,6 +72,11 @@ public:
     // ==========================================================================
     virtual void addStateObserver(std::shared_ptr<IStateObserver> observer) = 0;
     virtual void removeStateObserver(std::shared_ptr<IStateObserver> observer) = 0;
+    
+    // ==========================================================================
+    // 메모리 사용량
+    // ==========================================================================
+    virtual MemoryFootprint getMemoryFootprint() const { return {}; }
 };
 
 // =============================================================================
@@ -99,6 +110,7 @@ public:
     Result<void> requestStateChange(EN_WPN_CTRL_STATE newState, 
                                    const CancellationToken& token = {}) override;
     bool isValidTransition(EN_WPN_CTRL_STATE from, EN_WPN_CTRL_STATE to) const override;
+    void restoreState(EN_WPN_CTRL_STATE state, bool launched) override;
     
     bool isLaunched() const override { return m_launched.load(); }
     void setLaunched(bool launched) override;
@@ -115,11 +127,13 @@ public:
     void addStateObserver(std::shared_ptr<IStateObserver> observer) override;
     void removeStateObserver(std::shared_ptr<IStateObserver> observer) override;
     
+    MemoryFootprint getMemoryFootprint() const override;
+    
 protected:
     // ==========================================================================
     // 상태 전이 맵 (각 무장별로 오버라이드 가능)
     // ==========================================================================
-    virtual std::map<EN_WPN_CTRL_STATE, std::set<EN_WPN_CTRL_STATE>> getValidTransitionMap() const;
+    virtual const std::map<EN_WPN_CTRL_STATE, std::set<EN_WPN_CTRL_STATE>>& getValidTransitionMap() const;
     
     // ==========================================================================
     // 상태별 처리 함수 (파생 클래스에서 오버라이드)
@@ -140,6 +154,7 @@ protected:
     // 유틸리티 함수
     // ==========================================================================
     bool sleepWithCancellationCheck(float duration, const CancellationToken& token);
+    std::unique_lock<ProfiledMutex> lockState();
     void setState(EN_WPN_CTRL_STATE newState);
     
     // ==========================================================================
@@ -160,10 +175,10 @@ protected:
     std::vector<LaunchStep> m_launchSteps;
     float m_onDelay;
     
-    mutable std::mutex m_observerMutex;
-    std::vector<std::weak_ptr<IStateObserver>> m_observers;
+    mutable ProfiledMutex m_observerMutex{"WeaponBase::m_observerMutex"};
+    AccountedVector<std::weak_ptr<IStateObserver>, MemoryAccountId::OBSERVERS> m_observers;
     
-    mutable std::mutex m_stateMutex;
+    mutable ProfiledMutex m_stateMutex{"WeaponBase::m_stateMutex"};
     std::chrono::steady_clock::time_point m_stateStartTime;
     
     // 현재 작업의 취소 토큰
@@ -1,5 +1,7 @@
 #include "IWeapon.h"
 #include "../../Infrastructure/Configuration/SystemConfig.h"
+#include "../../Infrastructure/Diagnostics/StageProfiler.h"
+#include "../../Infrastructure/Diagnostics/TraceRecorder.h"
 #include <iostream>
 #include <algorithm>
 #include <thread>
@@ -45,7 +47,7 @@ EN_WPN_CTRL_STATE WeaponBase::getCurrentState() const {
 }
 
 Result<void> WeaponBase::requestStateChange(EN_WPN_CTRL_STATE newState, const CancellationToken& token) {
-    std::lock_guard<std::mutex> lock(m_stateMutex);
+    auto lock = lockState();
     
     EN_WPN_CTRL_STATE currentState = m_currentState.load();
     
@@ -56,10 +58,8 @@ Result<void> WeaponBase::requestStateChange(EN_WPN_CTRL_STATE newState, const Ca
     }
     
     if (!isValidTransition(currentState, newState)) {
-        return Result<void>::failure(
-            "Invalid transition from " + StateToString(currentState) + 
-            " to " + StateToString(newState)
-        );
+        return Result<void>::failure(formatFixed<ERROR_MESSAGE_CAPACITY>(
+            "Invalid transition from ", StateToString(currentState), " to ", StateToString(newState)));
     }
     
     // 취소 토큰 업데이트
@@ -101,11 +101,22 @@ Result<void> WeaponBase::requestStateChange(EN_WPN_CTRL_STATE newState, const Ca
 }
 
 bool WeaponBase::isValidTransition(EN_WPN_CTRL_STATE from, EN_WPN_CTRL_STATE to) const {
-    auto transitionMap = getValidTransitionMap();
+    const auto& transitionMap = getValidTransitionMap();
     auto it = transitionMap.find(from);
     return it != transitionMap.end() && it->second.count(to) > 0;
 }
 
+void WeaponBase::restoreState(EN_WPN_CTRL_STATE state, bool launched) {
+    auto lock = lockState();
+    
+    // 발사 여부는 통지하지 않음 (발사 통지/집계는 최초 발사 시 한 번)
+    m_launched.store(launched);
+    setState(state);
+    
+    std::cout << "Weapon " << WeaponKindToString(m_weaponKind)
+              << " state restored: " << StateToString(state) << std::endl;
+}
+
 void WeaponBase::setLaunched(bool launched) {
     bool oldValue = m_launched.exchange(launched);
     if (oldValue != launched) {
@@ -133,13 +144,13 @@ Result<void> WeaponBase::initialize(uint16_t tubeNumber) {
 }
 
 void WeaponBase::reset() {
-    std::lock_guard<std::mutex> lock(m_stateMutex);
+    auto lock = lockState();
     
     m_currentState.store(EN_WPN_CTRL_STATE::WPN_CTRL_STATE_OFF);
     m_launched.store(false);
     m_fireSolutionReady.store(false);
     m_currentCancellationToken.cancel(); // 진행 중인 작업 취소
-    m_stateStartTime = std::chrono::steady_clock::now();
+    m_stateStartTime = ClockProvider::get().now();
     
     std::cout << "Weapon " << WeaponKindToString(m_weaponKind) << " reset" << std::endl;
 }
@@ -166,12 +177,25 @@ void WeaponBase::update() {
 }
 
 void WeaponBase::addStateObserver(std::shared_ptr<IStateObserver> observer) {
-    std::lock_guard<std::mutex> lock(m_observerMutex);
+    std::lock_guard<ProfiledMutex> lock(m_observerMutex);
     m_observers.push_back(observer);
 }
 
+MemoryFootprint WeaponBase::getMemoryFootprint() const {
+    MemoryFootprint footprint;
+    {
+        std::lock_guard<ProfiledMutex> lock(m_observerMutex);
+        footprint.observerBytes = ContainerCapacityBytes(m_observers);
+    }
+    footprint.otherBytes = ContainerCapacityBytes(m_launchSteps);
+    for (const auto& step : m_launchSteps) {
+        footprint.otherBytes += step.description.capacity();
+    }
+    return footprint;
+}
+
 void WeaponBase::removeStateObserver(std::shared_ptr<IStateObserver> observer) {
-    std::lock_guard<std::mutex> lock(m_observerMutex);
+    std::lock_guard<ProfiledMutex> lock(m_observerMutex);
     m_observers.erase(
         std::remove_if(m_observers.begin(), m_observers.end(),
             [&](const std::weak_ptr<IStateObserver>& wp) {
@@ -180,7 +204,7 @@ void WeaponBase::removeStateObserver(std::shared_ptr<IStateObserver> observer) {
         m_observers.end());
 }
 
-std::map<EN_WPN_CTRL_STATE, std::set<EN_WPN_CTRL_STATE>> WeaponBase::getValidTransitionMap() const {
+const std::map<EN_WPN_CTRL_STATE, std::set<EN_WPN_CTRL_STATE>>& WeaponBase::getValidTransitionMap() const {
     return s_defaultTransitionMap;
 }
 
@@ -234,6 +258,7 @@ Result<void> WeaponBase::processLaunch(const CancellationToken& token) {
         
         std::cout << "Step: " << step.description << " (Duration: " << step.duration << " seconds)" << std::endl;
         
+        ScopedTrace stepTrace(TraceCategory::LAUNCH_STEP, step.description.c_str(), m_tubeNumber, TraceTrack::TUBE);
         if (!sleepWithCancellationCheck(step.duration, token)) {
             setState(EN_WPN_CTRL_STATE::WPN_CTRL_STATE_ABORT);
             onStateEnter(EN_WPN_CTRL_STATE::WPN_CTRL_STATE_ABORT);
@@ -262,29 +287,49 @@ Result<void> WeaponBase::processAbort() {
 bool WeaponBase::sleepWithCancellationCheck(float duration, const CancellationToken& token) {
     const int interval_ms = 50;  // 더 짧은 간격으로 취소 확인
     int total_intervals = static_cast<int>(duration * 1000 / interval_ms);
+    auto& clock = ClockProvider::get();
     
+    // 대기 동안 명령이 잡은 스냅샷 잠금을 양보 (주기 갱신이 전이 시간만큼 멈추지 않도록)
+    ScopedBlockingWait wait;
     for (int i = 0; i < total_intervals; ++i) {
         if (token.isCancelled() || m_currentCancellationToken.isCancelled()) {
             std::cout << "Operation cancelled." << std::endl;
             return false;
         }
-        std::this_thread::sleep_for(std::chrono::milliseconds(interval_ms));
+        clock.sleepFor(std::chrono::milliseconds(interval_ms));
     }
     
     return true;
 }
 
+std::unique_lock<ProfiledMutex> WeaponBase::lockState() {
+    // 다른 명령의 전이(POC 지연, 발사 단계)가 진행 중이면 끝날 때까지 기다려야 하므로 그때만
+    // 명령이 잡은 스냅샷 잠금을 양보한 채 획득한다 (기다리는 획득은 항상 전이 잠금 → 스냅샷 잠금)
+    std::unique_lock<ProfiledMutex> lock(m_stateMutex, std::try_to_lock);
+    if (!lock.owns_lock()) {
+        ScopedBlockingWait wait;
+        lock.lock();
+    }
+    return lock;
+}
+
 void WeaponBase::setState(EN_WPN_CTRL_STATE newState) {
     EN_WPN_CTRL_STATE oldState = m_currentState.exchange(newState);
-    m_stateStartTime = std::chrono::steady_clock::now();
+    m_stateStartTime = ClockProvider::get().now();
     
     if (oldState != newState) {
+        auto& tracer = TraceRecorder::getInstance();
+        if (tracer.isEnabled()) {
+            tracer.end(TraceCategory::STATE, StateToString(oldState).data(), m_tubeNumber, TraceTrack::TUBE);
+            tracer.begin(TraceCategory::STATE, StateToString(newState).data(), m_tubeNumber, TraceTrack::TUBE);
+        }
         notifyStateChanged(oldState, newState);
     }
 }
 
 void WeaponBase::notifyStateChanged(EN_WPN_CTRL_STATE oldState, EN_WPN_CTRL_STATE newState) {
-    std::lock_guard<std::mutex> lock(m_observerMutex);
+    ScopedStageTimer stageTimer(ProfileStage::OBSERVER_NOTIFY);
+    std::lock_guard<ProfiledMutex> lock(m_observerMutex);
     
     // 만료된 weak_ptr 제거
     m_observers.erase(
@@ -301,7 +346,8 @@ void WeaponBase::notifyStateChanged(EN_WPN_CTRL_STATE oldState, EN_WPN_CTRL_STAT
 }
 
 void WeaponBase::notifyLaunchStatusChanged(bool launched) {
-    std::lock_guard<std::mutex> lock(m_observerMutex);
+    ScopedStageTimer stageTimer(ProfileStage::OBSERVER_NOTIFY);
+    std::lock_guard<ProfiledMutex> lock(m_observerMutex);
     
     for (auto& weakObserver : m_observers) {
         if (auto observer = weakObserver.lock()) {
@@ -0,0 +1,291 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <type_traits>
+
+namespace WeaponControl {
+
+// =============================================================================
+// 설정 키 스키마
+//
+// SystemConfig 가 아는 키의 이름, 타입, 기본값, 허용 범위를 한 곳에 둔다.
+// 이 목록에서 ConfigKey 열거형, 키별 타입(ConfigKeyTraits), 스키마 표
+// (CONFIG_SCHEMA), 이름 → 슬롯 완전 해시가 생성된다.
+// SystemConfig::get<ConfigKey::X>() 는 적재 시 변환/범위 검사를 마친 슬롯을
+// 읽기만 하며, 없는 키 이름은 컴파일 오류가 된다. 범위는 수치 키에만
+// 적용된다 (bool/문자열 키는 0, 0).
+// =============================================================================
+
+#define WEAPONCONTROL_CONFIG_SCHEMA(X) \
+    /* 식별자                   키                                 타입          기본값             최소   최대 */ \
+    X(MAX_LAUNCH_TUBES,         "System.MaxLaunchTubes",           uint16_t,     6,                 1,     256) \
+    X(UPDATE_INTERVAL_MS,       "System.UpdateIntervalMs",         int,          100,               1,     60000) \
+    X(ENGAGEMENT_PLAN_INTERVAL_MS, "System.EngagementPlanIntervalMs", int,       1000,              1,     600000) \
+    X(STATUS_REPORT_INTERVAL_MS, "System.StatusReportIntervalMs",  int,          1000,              1,     600000) \
+    X(ENGAGEMENT_PLAN_BATCHING, "System.EngagementPlanBatching",   bool,         false,             0,     0) \
+    X(ENGAGEMENT_PLAN_SUMMARY_COMPARE, "System.EngagementPlanSummaryCompare", bool,   false,           0,     0) \
+    X(MINE_DATA_PATH,           "Paths.MineDataPath",              std::string,  "data/mine_plans", 0,     0) \
+    X(LOG_PATH,                 "Paths.LogPath",                   std::string,  "logs",            0,     0) \
+    X(CONFIG_PATH,              "Paths.ConfigPath",                std::string,  "config",          0,     0) \
+    X(DDS_DOMAIN_ID,            "DDS.DomainId",                    int,          83,                0,     232) \
+    X(DDS_QOS_PROFILE,          "DDS.QosProfile",                  std::string,  "reliable",        0,     0) \
+    X(MAX_PLAN_LISTS,           "MineDropPlan.MaxPlanLists",       uint32_t,     15,                1,     1000) \
+    X(MAX_PLANS_PER_LIST,       "MineDropPlan.MaxPlansPerList",    uint32_t,     15,                1,     1000) \
+    X(MINE_SPEED,               "Weapon.MineSpeed",                double,       5.0,               0.1,   100.0) \
+    X(ALM_MAX_RANGE,            "Weapon.ALMMaxRange",              double,       50.0,              0.1,   10000.0) \
+    X(ASM_MAX_RANGE,            "Weapon.ASMMaxRange",              double,       100.0,             0.1,   10000.0) \
+    X(ALM_SPEED,                "Weapon.ALMSpeed",                 double,       300.0,             1.0,   5000.0) \
+    X(ASM_SPEED,                "Weapon.ASMSpeed",                 double,       400.0,             1.0,   5000.0) \
+    X(DEFAULT_LAUNCH_DELAY,     "Weapon.DefaultLaunchDelay",       double,       3.0,               0.0,   600.0) \
+    X(REALTIME_ENABLED,         "RealTime.Enabled",                bool,         false,             0,     0) \
+    X(REALTIME_LOCK_MEMORY,     "RealTime.LockMemory",             bool,         true,              0,     0) \
+    X(REALTIME_STACK_PREFAULT_KB, "RealTime.StackPrefaultKb",      uint32_t,     512,               0,     65536) \
+    X(REALTIME_HEAP_PREFAULT_MB, "RealTime.HeapPrefaultMb",        uint32_t,     32,                0,     4096) \
+    X(REALTIME_MAX_TARGETS,     "RealTime.MaxTargets",             uint32_t,     256,               1,     65536) \
+    X(CHECKPOINT_ENABLED,       "Checkpoint.Enabled",              bool,         false,             0,     0) \
+    X(CHECKPOINT_PATH,          "Checkpoint.Path",                 std::string,  "state/weapon_control.ckpt", 0, 0) \
+    X(CHECKPOINT_MAX_TARGETS,   "Checkpoint.MaxTargets",           uint32_t,     256,               1,     65536) \
+    X(CHECKPOINT_SYNC_WRITES,   "Checkpoint.SyncWrites",           bool,         false,             0,     0) \
+    X(REPLICATION_ROLE,         "Replication.Role",                std::string,  "none",            0,     0) \
+    X(REPLICATION_CHANNEL,      "Replication.Channel",             std::string,  "/weapon_control_replication", 0, 0) \
+    X(REPLICATION_CAPACITY,     "Replication.Capacity",            uint32_t,     2048,              64,    65536) \
+    X(REPLICATION_HEARTBEAT_TIMEOUT_MS, "Replication.HeartbeatTimeoutMs", uint32_t, 300,            10,    60000)
+
+enum class ConfigKey : uint8_t {
+#define WEAPONCONTROL_CONFIG_KEY_ID(id, name, type, defaultValue, minValue, maxValue) id,
+    WEAPONCONTROL_CONFIG_SCHEMA(WEAPONCONTROL_CONFIG_KEY_ID)
+#undef WEAPONCONTROL_CONFIG_KEY_ID
+    COUNT
+};
+
+constexpr size_t CONFIG_KEY_COUNT = static_cast<size_t>(ConfigKey::COUNT);
+
+// 키별 값 타입
+template <ConfigKey Key>
+struct ConfigKeyTraits;
+
+#define WEAPONCONTROL_CONFIG_KEY_TRAITS(id, name, type, defaultValue, minValue, maxValue) \
+    template <> struct ConfigKeyTraits<ConfigKey::id> { using Type = type; };
+WEAPONCONTROL_CONFIG_SCHEMA(WEAPONCONTROL_CONFIG_KEY_TRAITS)
+#undef WEAPONCONTROL_CONFIG_KEY_TRAITS
+
+enum class ConfigValueType : uint8_t {
+    BOOL,
+    INT,
+    UINT,
+    DOUBLE,
+    STRING
+};
+
+template <typename T>
+constexpr ConfigValueType ConfigValueTypeOf() {
+    if constexpr (std::is_same_v<T, bool>) {
+        return ConfigValueType::BOOL;
+    } else if constexpr (std::is_same_v<T, std::string>) {
+        return ConfigValueType::STRING;
+    } else if constexpr (std::is_floating_point_v<T>) {
+        return ConfigValueType::DOUBLE;
+    } else if constexpr (std::is_signed_v<T>) {
+        return ConfigValueType::INT;
+    } else {
+        return ConfigValueType::UINT;
+    }
+}
+
+struct ConfigKeySpec {
+    std::string_view name;
+    ConfigValueType type;
+    double defaultNumber;           // BOOL/INT/UINT/DOUBLE
+    std::string_view defaultText;   // STRING
+    double minValue;
+    double maxValue;
+};
+
+namespace ConfigSchemaDetail {
+
+template <typename T>
+constexpr double numericDefault(T value) {
+    if constexpr (std::is_arithmetic_v<T>) {
+        return static_cast<double>(value);
+    } else {
+        return 0.0;
+    }
+}
+
+template <typename T>
+constexpr std::string_view textDefault(T value) {
+    if constexpr (std::is_arithmetic_v<T>) {
+        return std::string_view();
+    } else {
+        return std::string_view(value);
+    }
+}
+
+} // namespace ConfigSchemaDetail
+
+constexpr ConfigKeySpec CONFIG_SCHEMA[] = {
+#define WEAPONCONTROL_CONFIG_KEY_SPEC(id, name, type, defaultValue, minValue, maxValue) \
+    { name, ConfigValueTypeOf<type>(), ConfigSchemaDetail::numericDefault(defaultValue), \
+      ConfigSchemaDetail::textDefault(defaultValue), minValue, maxValue },
+    WEAPONCONTROL_CONFIG_SCHEMA(WEAPONCONTROL_CONFIG_KEY_SPEC)
+#undef WEAPONCONTROL_CONFIG_KEY_SPEC
+};
+
+constexpr const ConfigKeySpec& configKeySpec(ConfigKey key) {
+    return CONFIG_SCHEMA[static_cast<size_t>(key)];
+}
+
+// 이름 목록 (슬롯 번호 = ConfigKey 값)
+constexpr std::string_view KNOWN_CONFIG_KEYS[] = {
+#define WEAPONCONTROL_CONFIG_KEY_NAME(id, name, type, defaultValue, minValue, maxValue) name,
+    WEAPONCONTROL_CONFIG_SCHEMA(WEAPONCONTROL_CONFIG_KEY_NAME)
+#undef WEAPONCONTROL_CONFIG_KEY_NAME
+};
+
+constexpr size_t KNOWN_CONFIG_KEY_COUNT = sizeof(KNOWN_CONFIG_KEYS) / sizeof(KNOWN_CONFIG_KEYS[0]);
+constexpr int UNKNOWN_CONFIG_KEY = -1;
+
+namespace ConfigSchemaDetail {
+
+constexpr bool defaultsWithinRange() {
+    for (const auto& spec : CONFIG_SCHEMA) {
+        bool numeric = spec.type != ConfigValueType::BOOL && spec.type != ConfigValueType::STRING;
+        if (numeric && (spec.defaultNumber < spec.minValue || spec.defaultNumber > spec.maxValue)) {
+            return false;
+        }
+    }
+    return true;
+}
+
+constexpr bool namesUnique() {
+    for (size_t i = 0; i < KNOWN_CONFIG_KEY_COUNT; ++i) {
+        for (size_t j = i + 1; j < KNOWN_CONFIG_KEY_COUNT; ++j) {
+            if (KNOWN_CONFIG_KEYS[i] == KNOWN_CONFIG_KEYS[j]) {
+                return false;
+            }
+        }
+    }
+    return true;
+}
+
+static_assert(KNOWN_CONFIG_KEY_COUNT == CONFIG_KEY_COUNT, "Schema tables must cover every ConfigKey");
+static_assert(defaultsWithinRange(), "Schema default outside its range");
+static_assert(namesUnique(), "Duplicate key name in WEAPONCONTROL_CONFIG_SCHEMA");
+
+} // namespace ConfigSchemaDetail
+
+// =============================================================================
+// 이름 → 슬롯 완전 해시 (파서와 문자열 키 get/set 용)
+//
+// 컴파일 시간에 충돌 없는 시드를 찾아 만든 표를 사용하므로 조회 비용은
+// 해시 1회 + 문자열 비교 1회이다. 스키마에 없는 키는 UNKNOWN_CONFIG_KEY.
+// =============================================================================
+
+namespace ConfigKeyHashDetail {
+
+// FNV-1a (시드 혼합). "섹션.키" 를 이어 붙이지 않고 조각 단위로 누적한다.
+constexpr uint32_t mix(uint32_t hash, std::string_view text) {
+    for (char c : text) {
+        hash ^= static_cast<uint8_t>(c);
+        hash *= 16777619u;
+    }
+    return hash;
+}
+
+constexpr uint32_t hashKey(std::string_view key, uint32_t seed) {
+    return mix(2166136261u ^ seed, key);
+}
+
+constexpr uint32_t hashKey(std::string_view section, std::string_view name, uint32_t seed) {
+    return mix(mix(mix(2166136261u ^ seed, section), "."), name);
+}
+
+// 키 수의 4배 이상인 2의 거듭제곱 (시드 탐색이 컴파일 시간 연산 한도 안에서 끝나도록)
+constexpr size_t tableSizeFor(size_t count) {
+    size_t size = 1;
+    while (size < count * 4) {
+        size <<= 1;
+    }
+    return size;
+}
+
+constexpr size_t TABLE_SIZE = tableSizeFor(KNOWN_CONFIG_KEY_COUNT);
+
+struct Table {
+    uint32_t seed = 0;
+    int8_t slots[TABLE_SIZE] = {};
+};
+
+constexpr bool tryBuild(uint32_t seed, Table& table) {
+    table.seed = seed;
+    for (size_t i = 0; i < TABLE_SIZE; ++i) {
+        table.slots[i] = UNKNOWN_CONFIG_KEY;
+    }
+    for (size_t i = 0; i < KNOWN_CONFIG_KEY_COUNT; ++i) {
+        size_t bucket = hashKey(KNOWN_CONFIG_KEYS[i], seed) & (TABLE_SIZE - 1);
+        if (table.slots[bucket] != UNKNOWN_CONFIG_KEY) {
+            return false;
+        }
+        table.slots[bucket] = static_cast<int8_t>(i);
+    }
+    return true;
+}
+
+constexpr Table build() {
+    Table table;
+    for (uint32_t seed = 0; seed < 100000; ++seed) {
+        if (tryBuild(seed, table)) {
+            return table;
+        }
+    }
+    table.seed = UINT32_MAX;
+    return table;
+}
+
+constexpr Table TABLE = build();
+static_assert(TABLE.seed != UINT32_MAX, "No collision-free seed for KNOWN_CONFIG_KEYS");
+static_assert(KNOWN_CONFIG_KEY_COUNT < 128, "Slot index must fit in int8_t");
+
+} // namespace ConfigKeyHashDetail
+
+// 전체 키("섹션.키") → 슬롯, 없으면 UNKNOWN_CONFIG_KEY
+constexpr int findKnownConfigKey(std::string_view key) {
+    using namespace ConfigKeyHashDetail;
+    int slot = TABLE.slots[hashKey(key, TABLE.seed) & (TABLE_SIZE - 1)];
+    return (slot != UNKNOWN_CONFIG_KEY && KNOWN_CONFIG_KEYS[slot] == key) ? slot : UNKNOWN_CONFIG_KEY;
+}
+
+// 섹션/키 조각 → 슬롯 (파서용, 문자열 연결 없음)
+constexpr int findKnownConfigKey(std::string_view section, std::string_view name) {
+    using namespace ConfigKeyHashDetail;
+    int slot = TABLE.slots[hashKey(section, name, TABLE.seed) & (TABLE_SIZE - 1)];
+    if (slot == UNKNOWN_CONFIG_KEY) {
+        return UNKNOWN_CONFIG_KEY;
+    }
+
+    std::string_view known = KNOWN_CONFIG_KEYS[slot];
+    bool matches = known.size() == section.size() + 1 + name.size()
+                && known.substr(0, section.size()) == section
+                && known[section.size()] == '.'
+                && known.substr(section.size() + 1) == name;
+    return matches ? slot : UNKNOWN_CONFIG_KEY;
+}
+
+constexpr bool allKnownConfigKeysResolve() {
+    for (size_t i = 0; i < KNOWN_CONFIG_KEY_COUNT; ++i) {
+        if (findKnownConfigKey(KNOWN_CONFIG_KEYS[i]) != static_cast<int>(i)) {
+            return false;
+        }
+    }
+    return true;
+}
+
+static_assert(allKnownConfigKeysResolve(), "Perfect hash must resolve every known key");
+static_assert(findKnownConfigKey("Weapon", "ALMSpeed") == static_cast<int>(ConfigKey::ALM_SPEED),
+              "Split lookup must match full-key lookup");
+static_assert(findKnownConfigKey("Weapon.Unknown") == UNKNOWN_CONFIG_KEY, "Unknown keys must not resolve");
+
+} // namespace WeaponControl
@@ -0,0 +1,150 @@
+#include "IniParser.h"
+#include <algorithm>
+#include <cerrno>
+#include <cstdlib>
+#include <fstream>
+#include <sstream>
+
+#ifdef __linux__
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace WeaponControl {
+
+// =============================================================================
+// MappedFile 구현
+// =============================================================================
+
+Result<void> MappedFile::open(const std::string& path) {
+    close();
+
+#ifdef __linux__
+    int fd = ::open(path.c_str(), O_RDONLY | O_CLOEXEC);
+    if (fd < 0) {
+        return Result<void>::failure("Cannot open file: " + path + ": " + std::strerror(errno));
+    }
+
+    struct stat info;
+    if (fstat(fd, &info) != 0) {
+        int error = errno;
+        ::close(fd);
+        return Result<void>::failure("Cannot stat file: " + path + ": " + std::strerror(error));
+    }
+
+    m_size = static_cast<size_t>(info.st_size);
+    if (m_size == 0) {
+        ::close(fd);
+        return Result<void>::success();
+    }
+
+    void* mapped = mmap(nullptr, m_size, PROT_READ, MAP_PRIVATE, fd, 0);
+    ::close(fd);
+    if (mapped != MAP_FAILED) {
+        // 한 번 순차 접근
+        madvise(mapped, m_size, MADV_SEQUENTIAL);
+        m_data = static_cast<const char*>(mapped);
+        m_mapped = true;
+        return Result<void>::success();
+    }
+    m_size = 0;
+#endif
+
+    // 매핑할 수 없으면 (특수 파일, 비 Linux) 전체를 읽어 보관
+    std::ifstream file(path, std::ios::binary);
+    if (!file.is_open()) {
+        return Result<void>::failure("Cannot open file: " + path);
+    }
+
+    std::ostringstream contents;
+    contents << file.rdbuf();
+    m_fallback = contents.str();
+    m_data = m_fallback.data();
+    m_size = m_fallback.size();
+    return Result<void>::success();
+}
+
+void MappedFile::close() {
+#ifdef __linux__
+    if (m_mapped) {
+        munmap(const_cast<char*>(m_data), m_size);
+    }
+#endif
+    m_data = nullptr;
+    m_size = 0;
+    m_mapped = false;
+    m_fallback.clear();
+}
+
+// =============================================================================
+// StringArena 구현
+// =============================================================================
+
+std::string_view StringArena::store(std::string_view a, std::string_view b, std::string_view c) {
+    size_t length = a.size() + b.size() + c.size();
+    size_t required = length + 1;
+
+    if (m_chunks.empty() || m_used + required > m_chunks.back().size()) {
+        m_chunks.emplace_back(std::max(m_chunkSize, required));
+        m_used = 0;
+    }
+
+    char* out = m_chunks.back().data() + m_used;
+    a.copy(out, a.size());
+    b.copy(out + a.size(), b.size());
+    c.copy(out + a.size() + b.size(), c.size());
+    out[length] = '\0';
+    m_used += required;
+
+    return std::string_view(out, length);
+}
+
+// =============================================================================
+// ParsedConfigValue 구현
+// =============================================================================
+
+namespace {
+
+bool equalsIgnoreCase(std::string_view lhs, std::string_view rhs) {
+    if (lhs.size() != rhs.size()) {
+        return false;
+    }
+    for (size_t i = 0; i < lhs.size(); ++i) {
+        char c = lhs[i];
+        if (c >= 'A' && c <= 'Z') {
+            c = static_cast<char>(c - 'A' + 'a');
+        }
+        if (c != rhs[i]) {
+            return false;
+        }
+    }
+    return true;
+}
+
+} // namespace
+
+void ParsedConfigValue::parse(std::string_view storedText) {
+    text = storedText;
+    present = true;
+
+    // std::stoi/stod 와 같이 앞부분만 변환되면 유효 (범위 초과는 무효)
+    const char* begin = text.data();
+    char* end = nullptr;
+
+    errno = 0;
+    long long parsedInteger = std::strtoll(begin, &end, 10);
+    hasInteger = end != begin && errno != ERANGE;
+    integer = hasInteger ? parsedInteger : 0;
+
+    errno = 0;
+    double parsedNumber = std::strtod(begin, &end);
+    hasNumber = end != begin && errno != ERANGE;
+    number = hasNumber ? parsedNumber : 0.0;
+
+    boolean = equalsIgnoreCase(text, "true") || text == "1" || equalsIgnoreCase(text, "yes");
+    hasBoolean = boolean || equalsIgnoreCase(text, "false") || text == "0" || equalsIgnoreCase(text, "no");
+}
+
+} // namespace WeaponControl
@@ -0,0 +1,160 @@
+#pragma once
+
+#include "../../Common/Types/CommonTypes.h"
+#include "../Diagnostics/MemoryAccounting.h"
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace WeaponControl {
+
+// =============================================================================
+// 읽기 전용 파일 매핑 (Linux mmap, 그 외 플랫폼은 전체 읽기)
+// =============================================================================
+
+class MappedFile {
+public:
+    MappedFile() = default;
+    ~MappedFile() { close(); }
+
+    MappedFile(const MappedFile&) = delete;
+    MappedFile& operator=(const MappedFile&) = delete;
+
+    Result<void> open(const std::string& path);
+    void close();
+
+    std::string_view view() const { return std::string_view(m_data, m_size); }
+    size_t size() const { return m_size; }
+
+private:
+    const char* m_data = nullptr;
+    size_t m_size = 0;
+    bool m_mapped = false;
+    std::string m_fallback;     // 매핑 불가 시 읽은 내용
+};
+
+// =============================================================================
+// 단일 패스 INI 토크나이저
+//
+// 원본 버퍼를 한 번 훑으며 handler(section, key, value) 를 호출한다. 세 인자
+// 모두 원본을 가리키는 string_view 이므로 파싱 중 복사/할당이 없다.
+// 규칙은 기존 SystemConfig 파서와 같다 (앞뒤 공백 제거, ';'/'#' 주석 줄,
+// [섹션], 첫 '=' 기준 분리). 추가로 값 뒤의 공백 + ';'/'#' 인라인 주석을
+// 제거한다.
+// =============================================================================
+
+class IniParser {
+public:
+    template <typename Handler>
+    static size_t parse(std::string_view text, Handler&& handler) {
+        std::string_view section;
+        size_t entries = 0;
+        size_t pos = 0;
+
+        while (pos < text.size()) {
+            const char* lineStart = text.data() + pos;
+            const void* newline = std::memchr(lineStart, '\n', text.size() - pos);
+            size_t lineLength = newline ? static_cast<const char*>(newline) - lineStart : text.size() - pos;
+            pos += lineLength + 1;
+
+            std::string_view line = trim(std::string_view(lineStart, lineLength));
+
+            // 빈 줄이나 주석 스킵
+            if (line.empty() || line[0] == ';' || line[0] == '#') {
+                continue;
+            }
+
+            // 섹션 처리
+            if (line[0] == '[' && line.back() == ']') {
+                section = line.substr(1, line.size() - 2);
+                continue;
+            }
+
+            // 키=값 처리
+            size_t equalPos = line.find('=');
+            if (equalPos != std::string_view::npos) {
+                handler(section, trim(line.substr(0, equalPos)), stripInlineComment(trim(line.substr(equalPos + 1))));
+                ++entries;
+            }
+        }
+
+        return entries;
+    }
+
+    static std::string_view trim(std::string_view text) {
+        size_t start = text.find_first_not_of(" \t\r\n");
+        if (start == std::string_view::npos) {
+            return std::string_view();
+        }
+
+        size_t end = text.find_last_not_of(" \t\r\n");
+        return text.substr(start, end - start + 1);
+    }
+
+    // "값   ; 설명" → "값" (값 안의 ';' 는 앞에 공백이 없으면 유지)
+    static std::string_view stripInlineComment(std::string_view value) {
+        for (size_t i = 1; i < value.size(); ++i) {
+            if ((value[i] == ';' || value[i] == '#') && (value[i - 1] == ' ' || value[i - 1] == '\t')) {
+                return trim(value.substr(0, i));
+            }
+        }
+        return value;
+    }
+};
+
+// =============================================================================
+// 설정 문자열 보관소
+//
+// 키/값 문자열을 큰 덩어리(기본 64KB)에 이어 붙여 보관한다. 항목마다
+// std::string 을 만들지 않으므로 적재 시 할당은 덩어리 수만큼이다.
+// 보관한 문자열은 널 종료되며 clear() 전까지 주소가 바뀌지 않는다.
+// 덮어쓴 값의 공간은 clear() 때 함께 회수한다.
+// =============================================================================
+
+class StringArena {
+public:
+    explicit StringArena(size_t chunkSize = 64 * 1024) : m_chunkSize(chunkSize) {}
+
+    // a + b + c 를 이어 붙여 보관
+    std::string_view store(std::string_view a, std::string_view b = {}, std::string_view c = {});
+
+    void clear() {
+        m_chunks.clear();
+        m_used = 0;
+    }
+
+    size_t chunkCount() const { return m_chunks.size(); }
+
+private:
+    size_t m_chunkSize;
+    std::vector<AccountedVector<char, MemoryAccountId::CONFIG>> m_chunks;
+    size_t m_used = 0;      // 마지막 덩어리 사용량
+};
+
+// =============================================================================
+// 한 번만 변환해 두는 설정 값
+// =============================================================================
+
+struct ParsedConfigValue {
+    std::string_view text;      // StringArena 에 보관된 널 종료 문자열
+    double number = 0.0;
+    int64_t integer = 0;
+    bool present = false;
+    bool hasNumber = false;
+    bool hasInteger = false;
+    bool boolean = false;
+    bool hasBoolean = false;    // true/false, yes/no, 1/0 중 하나
+
+    // 보관소에 복사한 뒤 변환
+    void assign(StringArena& arena, std::string_view value) { parse(arena.store(value)); }
+
+    // 널 종료된 보관 문자열을 변환
+    void parse(std::string_view storedText);
+
+    void clear() { *this = ParsedConfigValue(); }
+};
+
+} // namespace WeaponControl
@@ -1,6 +1,19 @@
 #pragma once
 
 #include "../../Common/Types/CommonTypes.h"
+#include "../Diagnostics/LockProfiler.h"
+#include "../Diagnostics/MemoryAccounting.h"
+#include "../RealTime/RealTimeMemory.h"
+#include "../Persistence/StateCheckpoint.h"
+#include "../Replication/ReplicationChannel.h"
+#include "ConfigKeys.h"
+#include "IniParser.h"
+#include <array>
+#include <atomic>
+#include <bitset>
+#include <climits>
+#include <cstring>
+#include <iostream>
 #include <map>
 #include <string>
 #include <memory>
@@ -9,23 +22,39 @@
 #include <sstream>
 #include <filesystem>
 #include <mutex>
+#include <string_view>
 
 namespace WeaponControl {
 
 class SystemConfig {
 private:
-    static std::unique_ptr<SystemConfig> s_instance;
-    static std::mutex s_mutex;
+    inline static std::unique_ptr<SystemConfig> s_instance;
+    inline static ProfiledMutex s_mutex{"SystemConfig::s_mutex"};
     
-    std::map<std::string, std::string> m_config;
-    mutable std::mutex m_configMutex;
+    // 그 외 키 ("섹션.키" 순 정렬, 문자열은 m_strings 보관)
+    struct ConfigEntry {
+        std::string_view key;
+        std::string_view value;
+    };
+    
+    // 스키마 키는 원문(m_knownValues)과 검사를 통과한 타입 값(슬롯)으로,
+    // 그 외 키는 정렬 배열에 보관
+    std::array<ParsedConfigValue, KNOWN_CONFIG_KEY_COUNT> m_knownValues;
+    std::array<std::atomic<uint64_t>, CONFIG_KEY_COUNT> m_slotBits;    // 수치/bool (double 은 비트 그대로)
+    std::array<std::string_view, CONFIG_KEY_COUNT> m_slotText;          // 문자열 키 (m_configMutex 보호)
+    AccountedVector<ConfigEntry, MemoryAccountId::CONFIG> m_config;
+    StringArena m_strings;
+    std::vector<std::string> m_validationErrors;
+    mutable ProfiledMutex m_configMutex{"SystemConfig::m_configMutex"};
     bool m_loaded;
     
-    SystemConfig() : m_loaded(false) {}
+    SystemConfig() : m_loaded(false) {
+        resetSlotsToDefaults();
+    }
     
 public:
     static SystemConfig& getInstance() {
-        std::lock_guard<std::mutex> lock(s_mutex);
+        std::lock_guard<ProfiledMutex> lock(s_mutex);
         if (!s_instance) {
             s_instance = std::unique_ptr<SystemConfig>(new SystemConfig());
         }
@@ -38,46 +67,38 @@ public:
     SystemConfig(SystemConfig&&) = delete;
     SystemConfig& operator=(SystemConfig&&) = delete;
     
+    // 파일을 매핑하여 한 번에 파싱 (알려진 키는 슬롯에 변환 값 저장)
     Result<void> loadFromFile(const std::string& filename) {
-        std::lock_guard<std::mutex> lock(m_configMutex);
-        
         if (!std::filesystem::exists(filename)) {
             return Result<void>::failure("Config file not found: " + filename);
         }
         
-        std::ifstream file(filename);
-        if (!file.is_open()) {
+        MappedFile file;
+        if (!file.open(filename)) {
             return Result<void>::failure("Cannot open config file: " + filename);
         }
         
-        std::string line;
-        std::string currentSection = "";
+        std::lock_guard<ProfiledMutex> lock(m_configMutex);
         
-        while (std::getline(file, line)) {
-            line = trim(line);
-            
-            // 빈 줄이나 주석 스킵
-            if (line.empty() || line[0] == ';' || line[0] == '#') {
-                continue;
+        size_t previousCount = m_config.size();
+        std::bitset<CONFIG_KEY_COUNT> loadedKeys;
+        IniParser::parse(file.view(), [&](std::string_view section, std::string_view key, std::string_view value) {
+            int slot = section.empty() ? findKnownConfigKey(key) : findKnownConfigKey(section, key);
+            if (slot != UNKNOWN_CONFIG_KEY) {
+                m_knownValues[slot].assign(m_strings, value);
+                loadedKeys.set(static_cast<size_t>(slot));
+                return;
             }
             
-            // 섹션 처리
-            if (line[0] == '[' && line.back() == ']') {
-                currentSection = line.substr(1, line.length() - 2);
-                continue;
-            }
-            
-            // 키=값 처리
-            auto equalPos = line.find('=');
-            if (equalPos != std::string::npos) {
-                std::string key = trim(line.substr(0, equalPos));
-                std::string value = trim(line.substr(equalPos + 1));
-                
-                if (!currentSection.empty()) {
-                    key = currentSection + "." + key;
-                }
-                
-                m_config[key] = value;
+            std::string_view separator = section.empty() ? std::string_view() : std::string_view(".");
+            m_config.push_back({ m_strings.store(section, separator, key), m_strings.store(value) });
+        });
+        mergeLoadedEntries(previousCount);
+        
+        // 스키마 키 변환/범위 검사는 적재 시 한 번
+        for (size_t slot = 0; slot < CONFIG_KEY_COUNT; ++slot) {
+            if (loadedKeys.test(slot)) {
+                applySlot(slot, filename);
             }
         }
         
@@ -98,103 +119,216 @@ public:
         return Result<void>::success();
     }
     
+    // 스키마 키 조회 (검사를 마친 슬롯 읽기, 문자열 키만 잠금)
+    template<ConfigKey Key>
+    typename ConfigKeyTraits<Key>::Type get() const {
+        using Type = typename ConfigKeyTraits<Key>::Type;
+        constexpr size_t slot = static_cast<size_t>(Key);
+        
+        if constexpr (std::is_same_v<Type, std::string>) {
+            std::lock_guard<ProfiledMutex> lock(m_configMutex);
+            return std::string(m_slotText[slot]);
+        } else {
+            uint64_t bits = m_slotBits[slot].load(std::memory_order_relaxed);
+            if constexpr (std::is_floating_point_v<Type>) {
+                double value;
+                std::memcpy(&value, &bits, sizeof(value));
+                return static_cast<Type>(value);
+            } else {
+                return static_cast<Type>(static_cast<int64_t>(bits));
+            }
+        }
+    }
+    
+    // 문자열 키 조회. 스키마 키는 get<ConfigKey>() 와 같은 슬롯(범위 검사를 거친
+    // 값, 없으면 스키마 기본값)을 읽고, 스키마 외 키만 원문을 변환한다.
     template<typename T>
-    T get(const std::string& key, const T& defaultValue = T{}) const {
-        std::lock_guard<std::mutex> lock(m_configMutex);
+    T get(std::string_view key, const T& defaultValue = T{}) const {
+        int slot = findKnownConfigKey(key);
         
-        auto it = m_config.find(key);
+        std::lock_guard<ProfiledMutex> lock(m_configMutex);
+        
+        if (slot != UNKNOWN_CONFIG_KEY) {
+            return slotValue<T>(static_cast<size_t>(slot), defaultValue);
+        }
+        
+        auto it = findEntry(key);
         if (it == m_config.end()) {
             return defaultValue;
         }
         
-        return convertValue<T>(it->second, defaultValue);
+        ParsedConfigValue value;
+        value.parse(it->value);
+        return typedValue<T>(value, defaultValue);
     }
     
     // 편의 함수들
     uint16_t getMaxLaunchTubes() const {
-        return get<uint16_t>("System.MaxLaunchTubes", 6);
+        return get<ConfigKey::MAX_LAUNCH_TUBES>();
     }
     
     std::chrono::milliseconds getUpdateInterval() const {
-        auto ms = get<int>("System.UpdateIntervalMs", 100);
-        return std::chrono::milliseconds(ms);
+        return std::chrono::milliseconds(get<ConfigKey::UPDATE_INTERVAL_MS>());
     }
     
     std::chrono::milliseconds getEngagementPlanInterval() const {
-        auto ms = get<int>("System.EngagementPlanIntervalMs", 1000);
-        return std::chrono::milliseconds(ms);
+        return std::chrono::milliseconds(get<ConfigKey::ENGAGEMENT_PLAN_INTERVAL_MS>());
     }
     
     std::chrono::milliseconds getStatusReportInterval() const {
-        auto ms = get<int>("System.StatusReportIntervalMs", 1000);
-        return std::chrono::milliseconds(ms);
+        return std::chrono::milliseconds(get<ConfigKey::STATUS_REPORT_INTERVAL_MS>());
     }
     
     std::string getMineDataPath() const {
-        return get<std::string>("Paths.MineDataPath", "data/mine_plans");
+        return get<ConfigKey::MINE_DATA_PATH>();
     }
     
     std::string getLogPath() const {
-        return get<std::string>("Paths.LogPath", "logs");
+        return get<ConfigKey::LOG_PATH>();
     }
     
     std::string getConfigPath() const {
-        return get<std::string>("Paths.ConfigPath", "config");
+        return get<ConfigKey::CONFIG_PATH>();
     }
     
     int getDdsDomainId() const {
-        return get<int>("DDS.DomainId", 83);
+        return get<ConfigKey::DDS_DOMAIN_ID>();
     }
     
     std::string getDdsQosProfile() const {
-        return get<std::string>("DDS.QosProfile", "reliable");
+        return get<ConfigKey::DDS_QOS_PROFILE>();
     }
     
     uint32_t getMaxPlanLists() const {
-        return get<uint32_t>("MineDropPlan.MaxPlanLists", 15);
+        return get<ConfigKey::MAX_PLAN_LISTS>();
     }
     
     uint32_t getMaxPlansPerList() const {
-        return get<uint32_t>("MineDropPlan.MaxPlansPerList", 15);
+        return get<ConfigKey::MAX_PLANS_PER_LIST>();
     }
     
     double getMineSpeed() const {
-        return get<double>("Weapon.MineSpeed", 5.0);
+        return get<ConfigKey::MINE_SPEED>();
     }
     
     double getALMMaxRange() const {
-        return get<double>("Weapon.ALMMaxRange", 50.0);
+        return get<ConfigKey::ALM_MAX_RANGE>();
     }
     
     double getASMMaxRange() const {
-        return get<double>("Weapon.ASMMaxRange", 100.0);
+        return get<ConfigKey::ASM_MAX_RANGE>();
     }
     
     double getALMSpeed() const {
-        return get<double>("Weapon.ALMSpeed", 300.0);
+        return get<ConfigKey::ALM_SPEED>();
     }
     
     double getASMSpeed() const {
-        return get<double>("Weapon.ASMSpeed", 400.0);
+        return get<ConfigKey::ASM_SPEED>();
     }
     
     double getDefaultLaunchDelay() const {
-        return get<double>("Weapon.DefaultLaunchDelay", 3.0);
+        return get<ConfigKey::DEFAULT_LAUNCH_DELAY>();
+    }
+    
+    // 교전계획 갱신을 주기마다 한 번 묶어서 전달 (꺼져 있으면 발사관별 즉시 전달)
+    bool isEngagementPlanBatchingEnabled() const {
+        return get<ConfigKey::ENGAGEMENT_PLAN_BATCHING>();
+    }
+    
+    // 교전계획 변경을 궤적 전체 대신 요약으로 판정 (기본은 꺼짐: 전체 내용 해시 비교)
+    bool isEngagementPlanSummaryCompareEnabled() const {
+        return get<ConfigKey::ENGAGEMENT_PLAN_SUMMARY_COMPARE>();
+    }
+    
+    // 실시간 메모리 모드 (초기화 시 메모리 고정/선점, 정상 상태 할당 감시)
+    bool isRealTimeModeEnabled() const {
+        return get<ConfigKey::REALTIME_ENABLED>();
+    }
+    
+    RealTimeMemoryConfig getRealTimeMemoryConfig() const {
+        RealTimeMemoryConfig config;
+        config.lockMemory = get<ConfigKey::REALTIME_LOCK_MEMORY>();
+        config.stackPrefaultBytes = static_cast<size_t>(get<ConfigKey::REALTIME_STACK_PREFAULT_KB>()) * 1024;
+        config.heapPrefaultBytes = static_cast<size_t>(get<ConfigKey::REALTIME_HEAP_PREFAULT_MB>()) * 1024 * 1024;
+        config.maxTargets = get<ConfigKey::REALTIME_MAX_TARGETS>();
+        return config;
+    }
+    
+    // 재시작 복구용 상태 체크포인트 (initialize 시 복원, 이후 상태 변경마다 기록)
+    bool isStateCheckpointEnabled() const {
+        return get<ConfigKey::CHECKPOINT_ENABLED>();
+    }
+    
+    StateCheckpointConfig getStateCheckpointConfig() const {
+        StateCheckpointConfig config;
+        config.path = get<ConfigKey::CHECKPOINT_PATH>();
+        config.maxTargets = get<ConfigKey::CHECKPOINT_MAX_TARGETS>();
+        config.syncWrites = get<ConfigKey::CHECKPOINT_SYNC_WRITES>();
+        return config;
+    }
+    
+    // 상시 대기 이중화 (Role: none | primary | standby, 그 외 값은 none)
+    ReplicationConfig getReplicationConfig() const {
+        ReplicationConfig config;
+        const std::string role = get<ConfigKey::REPLICATION_ROLE>();
+        if (role == "primary") {
+            config.role = ReplicationRole::PRIMARY;
+        } else if (role == "standby") {
+            config.role = ReplicationRole::STANDBY;
+        }
+        config.channelName = get<ConfigKey::REPLICATION_CHANNEL>();
+        config.capacity = get<ConfigKey::REPLICATION_CAPACITY>();
+        config.heartbeatTimeoutMs = get<ConfigKey::REPLICATION_HEARTBEAT_TIMEOUT_MS>();
+        return config;
+    }
+    
+    // 스키마 검사에서 거부된 값 (적재/set 순서)
+    std::vector<std::string> getValidationErrors() const {
+        std::lock_guard<ProfiledMutex> lock(m_configMutex);
+        return m_validationErrors;
     }
     
     bool isLoaded() const {
-        std::lock_guard<std::mutex> lock(m_configMutex);
+        std::lock_guard<ProfiledMutex> lock(m_configMutex);
         return m_loaded;
     }
     
     void set(const std::string& key, const std::string& value) {
-        std::lock_guard<std::mutex> lock(m_configMutex);
-        m_config[key] = value;
+        int slot = findKnownConfigKey(key);
+        
+        std::lock_guard<ProfiledMutex> lock(m_configMutex);
+        if (slot != UNKNOWN_CONFIG_KEY) {
+            m_knownValues[slot].assign(m_strings, value);
+            applySlot(static_cast<size_t>(slot), "set");
+            return;
+        }
+        
+        auto it = findEntry(key);
+        if (it != m_config.end()) {
+            it->value = m_strings.store(value);
+        } else {
+            auto position = std::lower_bound(m_config.begin(), m_config.end(), std::string_view(key), EntryKeyLess());
+            m_config.insert(position, { m_strings.store(key), m_strings.store(value) });
+        }
+    }
+    
+    // 모든 설정 제거 (재적재 전)
+    void clear() {
+        std::lock_guard<ProfiledMutex> lock(m_configMutex);
+        for (auto& value : m_knownValues) {
+            value.clear();
+        }
+        m_config.clear();
+        m_validationErrors.clear();
+        resetSlotsToDefaults();
+        m_strings.clear();
+        m_loaded = false;
     }
     
     // 설정 저장
     Result<void> saveToFile(const std::string& filename) const {
-        std::lock_guard<std::mutex> lock(m_configMutex);
+        std::lock_guard<ProfiledMutex> lock(m_configMutex);
         
         std::ofstream file(filename);
         if (!file.is_open()) {
@@ -204,15 +338,24 @@ public:
         std::map<std::string, std::map<std::string, std::string>> sections;
         
         // 섹션별로 그룹화
-        for (const auto& [key, value] : m_config) {
+        auto addEntry = [&sections](std::string_view key, std::string_view value) {
             auto dotPos = key.find('.');
-            if (dotPos != std::string::npos) {
-                std::string section = key.substr(0, dotPos);
-                std::string keyName = key.substr(dotPos + 1);
-                sections[section][keyName] = value;
+            if (dotPos != std::string_view::npos) {
+                std::string section(key.substr(0, dotPos));
+                std::string keyName(key.substr(dotPos + 1));
+                sections[section][keyName] = std::string(value);
             } else {
-                sections[""][key] = value;
+                sections[""][std::string(key)] = std::string(value);
             }
+        };
+        
+        for (size_t slot = 0; slot < KNOWN_CONFIG_KEY_COUNT; ++slot) {
+            if (m_knownValues[slot].present) {
+                addEntry(KNOWN_CONFIG_KEYS[slot], m_knownValues[slot].text);
+            }
+        }
+        for (const auto& entry : m_config) {
+            addEntry(entry.key, entry.value);
         }
         
         // 파일에 쓰기
@@ -232,44 +375,160 @@ public:
     }
     
 private:
-    std::string trim(const std::string& str) const {
-        size_t start = str.find_first_not_of(" \t\r\n");
-        if (start == std::string::npos) return "";
+    struct EntryKeyLess {
+        bool operator()(const ConfigEntry& lhs, const ConfigEntry& rhs) const { return lhs.key < rhs.key; }
+        bool operator()(const ConfigEntry& lhs, std::string_view rhs) const { return lhs.key < rhs; }
+    };
+    
+    AccountedVector<ConfigEntry, MemoryAccountId::CONFIG>::iterator findEntry(std::string_view key) {
+        auto it = std::lower_bound(m_config.begin(), m_config.end(), key, EntryKeyLess());
+        return (it != m_config.end() && it->key == key) ? it : m_config.end();
+    }
+    
+    AccountedVector<ConfigEntry, MemoryAccountId::CONFIG>::const_iterator findEntry(std::string_view key) const {
+        auto it = std::lower_bound(m_config.begin(), m_config.end(), key, EntryKeyLess());
+        return (it != m_config.end() && it->key == key) ? it : m_config.end();
+    }
+    
+    // previousCount 이후에 추가된 항목을 정렬하여 기존 항목과 병합.
+    // 같은 키는 나중 항목(새 파일, 파일 안에서는 뒤쪽 줄)만 남긴다.
+    void mergeLoadedEntries(size_t previousCount) {
+        auto middle = m_config.begin() + static_cast<std::ptrdiff_t>(previousCount);
+        std::stable_sort(middle, m_config.end(), EntryKeyLess());
+        std::inplace_merge(m_config.begin(), middle, m_config.end(), EntryKeyLess());
+        
+        auto out = m_config.begin();
+        for (auto it = m_config.begin(); it != m_config.end(); ++it) {
+            auto next = it + 1;
+            if (next != m_config.end() && next->key == it->key) {
+                continue;
+            }
+            *out++ = *it;
+        }
+        m_config.erase(out, m_config.end());
+    }
+    
+    void resetSlotsToDefaults() {
+        for (size_t slot = 0; slot < CONFIG_KEY_COUNT; ++slot) {
+            const auto& spec = CONFIG_SCHEMA[slot];
+            m_slotText[slot] = spec.defaultText;
+            storeSlotNumber(slot, spec.type, spec.defaultNumber);
+        }
+    }
+    
+    void storeSlotNumber(size_t slot, ConfigValueType type, double number) {
+        uint64_t bits = 0;
+        if (type == ConfigValueType::DOUBLE) {
+            std::memcpy(&bits, &number, sizeof(bits));
+        } else {
+            bits = static_cast<uint64_t>(static_cast<int64_t>(number));
+        }
+        m_slotBits[slot].store(bits, std::memory_order_relaxed);
+    }
+    
+    // 원문을 스키마 타입/범위로 검사하여 슬롯에 기록. 거부하면 이전 값 유지.
+    void applySlot(size_t slot, std::string_view source) {
+        const auto& spec = CONFIG_SCHEMA[slot];
+        const auto& raw = m_knownValues[slot];
+        
+        bool valid = false;
+        double number = 0.0;
+        switch (spec.type) {
+            case ConfigValueType::STRING:
+                m_slotText[slot] = raw.text;
+                return;
+            case ConfigValueType::BOOL:
+                valid = raw.hasBoolean;
+                number = raw.boolean ? 1.0 : 0.0;
+                break;
+            case ConfigValueType::INT:
+            case ConfigValueType::UINT:
+                valid = raw.hasInteger;
+                number = static_cast<double>(raw.integer);
+                break;
+            case ConfigValueType::DOUBLE:
+                valid = raw.hasNumber;
+                number = raw.number;
+                break;
+        }
+        
+        bool needsRange = spec.type != ConfigValueType::BOOL;
+        if (valid && (!needsRange || (number >= spec.minValue && number <= spec.maxValue))) {
+            storeSlotNumber(slot, spec.type, number);
+            return;
+        }
         
-        size_t end = str.find_last_not_of(" \t\r\n");
-        return str.substr(start, end - start + 1);
+        std::ostringstream message;
+        message << source << ": " << spec.name << "=" << raw.text << " rejected (";
+        if (!valid) {
+            message << "not a valid value";
+        } else {
+            message << "allowed " << spec.minValue << " .. " << spec.maxValue;
+        }
+        message << "), keeping previous value";
+        m_validationErrors.push_back(message.str());
+        std::cout << "Config " << m_validationErrors.back() << std::endl;
     }
     
+    // 슬롯 값을 요청 타입으로 변환 (m_configMutex 보유 상태에서 호출).
+    // 문자열 스키마 키를 다른 타입으로 읽을 때만 변환 실패 시 defaultValue.
     template<typename T>
-    T convertValue(const std::string& value, const T& defaultValue) const {
-        try {
+    T slotValue(size_t slot, const T& defaultValue) const {
+        const auto& spec = CONFIG_SCHEMA[slot];
+        if (spec.type == ConfigValueType::STRING) {
             if constexpr (std::is_same_v<T, std::string>) {
-                return value;
-            } else if constexpr (std::is_same_v<T, int>) {
-                return std::stoi(value);
-            } else if constexpr (std::is_same_v<T, uint16_t>) {
-                return static_cast<uint16_t>(std::stoul(value));
-            } else if constexpr (std::is_same_v<T, uint32_t>) {
-                return static_cast<uint32_t>(std::stoul(value));
-            } else if constexpr (std::is_same_v<T, double>) {
-                return std::stod(value);
-            } else if constexpr (std::is_same_v<T, float>) {
-                return std::stof(value);
-            } else if constexpr (std::is_same_v<T, bool>) {
-                std::string lowerValue = value;
-                std::transform(lowerValue.begin(), lowerValue.end(), lowerValue.begin(), ::tolower);
-                return (lowerValue == "true" || lowerValue == "1" || lowerValue == "yes");
+                return std::string(m_slotText[slot]);
+            } else {
+                ParsedConfigValue value;
+                value.parse(m_slotText[slot]);
+                return typedValue<T>(value, defaultValue);
+            }
+        }
+        
+        uint64_t bits = m_slotBits[slot].load(std::memory_order_relaxed);
+        double number;
+        if (spec.type == ConfigValueType::DOUBLE) {
+            std::memcpy(&number, &bits, sizeof(number));
+        } else {
+            number = static_cast<double>(static_cast<int64_t>(bits));
+        }
+        
+        if constexpr (std::is_same_v<T, std::string>) {
+            if (spec.type == ConfigValueType::BOOL) {
+                return number != 0.0 ? "true" : "false";
             }
-        } catch (const std::exception&) {
+            std::ostringstream text;
+            text << number;
+            return text.str();
+        } else if constexpr (std::is_same_v<T, bool>) {
+            return number != 0.0;
+        } else {
+            return static_cast<T>(number);
+        }
+    }
+    
+    // 변환해 둔 값 사용 (변환 실패 시 기본값)
+    template<typename T>
+    T typedValue(const ParsedConfigValue& value, const T& defaultValue) const {
+        if (!value.present) {
             return defaultValue;
         }
         
+        if constexpr (std::is_same_v<T, std::string>) {
+            return std::string(value.text);
+        } else if constexpr (std::is_same_v<T, int>) {
+            bool inRange = value.integer >= INT_MIN && value.integer <= INT_MAX;
+            return (value.hasInteger && inRange) ? static_cast<int>(value.integer) : defaultValue;
+        } else if constexpr (std::is_same_v<T, uint16_t> || std::is_same_v<T, uint32_t>) {
+            return value.hasInteger ? static_cast<T>(value.integer) : defaultValue;
+        } else if constexpr (std::is_same_v<T, double> || std::is_same_v<T, float>) {
+            return value.hasNumber ? static_cast<T>(value.number) : defaultValue;
+        } else if constexpr (std::is_same_v<T, bool>) {
+            return value.boolean;
+        }
+        
         return defaultValue;
     }
 };
 
-// 정적 멤버 초기화
-std::unique_ptr<SystemConfig> SystemConfig::s_instance = nullptr;
-std::mutex SystemConfig::s_mutex;
-
 } // namespace WeaponControl
@@ -0,0 +1,214 @@
+#include "LockProfiler.h"
+#include <algorithm>
+#include <cstring>
+#include <iomanip>
+#include <iostream>
+#include <sstream>
+
+namespace WeaponControl {
+
+// =============================================================================
+// LockProfiler 구현
+// =============================================================================
+
+uint16_t LockProfiler::registerClass(const char* name) {
+    std::lock_guard<std::mutex> lock(m_registryMutex);
+
+    size_t count = m_classCount.load(std::memory_order_relaxed);
+    for (size_t i = 0; i < count; ++i) {
+        if (m_classNames[i] == name) {
+            return static_cast<uint16_t>(i);
+        }
+    }
+
+    if (count == MAX_LOCK_CLASSES) {
+        // 초과분은 마지막 클래스에 합산
+        m_classNames[MAX_LOCK_CLASSES - 1] = "(other)";
+        return static_cast<uint16_t>(MAX_LOCK_CLASSES - 1);
+    }
+
+    m_classNames[count] = name;
+    m_classCount.store(count + 1, std::memory_order_release);
+    return static_cast<uint16_t>(count);
+}
+
+void LockProfiler::beforeAcquire(uint16_t classId, const void* instance, bool blocking) {
+    HeldLocks& held = heldLocks();
+
+    for (size_t i = 0; i < held.count; ++i) {
+        const HeldLock& entry = held.entries[i];
+        if (entry.instance == instance) {
+            // 표준 뮤텍스에서는 교착 또는 예외로 이어지므로 즉시 알림
+            m_counters[classId].recursiveAcquisitions.fetch_add(1, std::memory_order_relaxed);
+            std::cerr << "LockProfiler: recursive acquisition of " << m_classNames[classId] << std::endl;
+        }
+        if (blocking) {
+            m_edges[entry.classId][classId].fetch_add(1, std::memory_order_relaxed);
+        }
+    }
+}
+
+void LockProfiler::onAcquired(uint16_t classId, const void* instance, bool shared, uint64_t waitNs, bool contended) {
+    auto& counters = m_counters[classId];
+    counters.acquisitions.fetch_add(1, std::memory_order_relaxed);
+    if (shared) {
+        counters.sharedAcquisitions.fetch_add(1, std::memory_order_relaxed);
+    }
+    if (contended) {
+        counters.contentions.fetch_add(1, std::memory_order_relaxed);
+        counters.waitTotalNs.fetch_add(waitNs, std::memory_order_relaxed);
+        updateMax(counters.waitMaxNs, waitNs);
+    }
+
+    HeldLocks& held = heldLocks();
+    if (held.count < MAX_HELD_LOCKS) {
+        held.entries[held.count++] = HeldLock{instance, classId, nowNs()};
+    }
+}
+
+void LockProfiler::onReleased(uint16_t classId, const void* instance) {
+    HeldLocks& held = heldLocks();
+
+    // 해제 순서가 획득의 역순이 아닐 수 있으므로 위에서부터 검색
+    for (size_t i = held.count; i > 0; --i) {
+        HeldLock& entry = held.entries[i - 1];
+        if (entry.instance != instance) {
+            continue;
+        }
+
+        uint64_t holdNs = nowNs() - entry.acquiredNs;
+        auto& counters = m_counters[classId];
+        counters.holdTotalNs.fetch_add(holdNs, std::memory_order_relaxed);
+        updateMax(counters.holdMaxNs, holdNs);
+
+        std::copy(held.entries.begin() + i, held.entries.begin() + held.count, held.entries.begin() + (i - 1));
+        --held.count;
+        return;
+    }
+}
+
+std::vector<LockClassStats> LockProfiler::snapshot() const {
+    std::lock_guard<std::mutex> lock(m_registryMutex);
+    std::vector<LockClassStats> result;
+
+    size_t count = m_classCount.load(std::memory_order_acquire);
+    for (size_t i = 0; i < count; ++i) {
+        const auto& counters = m_counters[i];
+        LockClassStats stats;
+        stats.name = m_classNames[i];
+        stats.acquisitions = counters.acquisitions.load(std::memory_order_relaxed);
+        stats.sharedAcquisitions = counters.sharedAcquisitions.load(std::memory_order_relaxed);
+        stats.contentions = counters.contentions.load(std::memory_order_relaxed);
+        stats.recursiveAcquisitions = counters.recursiveAcquisitions.load(std::memory_order_relaxed);
+        stats.waitTotalMs = counters.waitTotalNs.load(std::memory_order_relaxed) / 1e6;
+        stats.waitMaxUs = counters.waitMaxNs.load(std::memory_order_relaxed) / 1e3;
+        stats.holdTotalMs = counters.holdTotalNs.load(std::memory_order_relaxed) / 1e6;
+        stats.holdMaxUs = counters.holdMaxNs.load(std::memory_order_relaxed) / 1e3;
+        result.push_back(stats);
+    }
+
+    // 대기 시간이 긴 잠금부터
+    std::sort(result.begin(), result.end(), [](const LockClassStats& a, const LockClassStats& b) {
+        return a.waitTotalMs > b.waitTotalMs;
+    });
+    return result;
+}
+
+std::vector<LockOrderEdge> LockProfiler::orderEdges() const {
+    std::lock_guard<std::mutex> lock(m_registryMutex);
+    std::vector<LockOrderEdge> result;
+
+    size_t count = m_classCount.load(std::memory_order_acquire);
+    for (size_t from = 0; from < count; ++from) {
+        for (size_t to = 0; to < count; ++to) {
+            uint64_t edgeCount = m_edges[from][to].load(std::memory_order_relaxed);
+            if (edgeCount > 0) {
+                result.push_back(LockOrderEdge{m_classNames[from], m_classNames[to], edgeCount});
+            }
+        }
+    }
+
+    return result;
+}
+
+std::vector<std::string> LockProfiler::findInversions() const {
+    std::lock_guard<std::mutex> lock(m_registryMutex);
+    std::vector<std::string> result;
+
+    size_t count = m_classCount.load(std::memory_order_acquire);
+    for (size_t a = 0; a < count; ++a) {
+        // 같은 클래스의 서로 다른 인스턴스를 중첩 획득 (예: 발사관 A 후 B) 도 순서에 따라 교착 가능
+        if (m_edges[a][a].load(std::memory_order_relaxed) > 0) {
+            result.push_back(m_classNames[a] + " nested within another " + m_classNames[a]);
+        }
+        for (size_t b = a + 1; b < count; ++b) {
+            if (m_edges[a][b].load(std::memory_order_relaxed) > 0 &&
+                m_edges[b][a].load(std::memory_order_relaxed) > 0) {
+                result.push_back(m_classNames[a] + " <-> " + m_classNames[b]);
+            }
+        }
+    }
+
+    return result;
+}
+
+std::string LockProfiler::formatReport() const {
+    std::ostringstream out;
+
+    if (!isCompiledIn()) {
+        out << "Lock profiling not compiled in (define WEAPONCONTROL_LOCK_PROFILING)\n";
+        return out.str();
+    }
+
+    out << std::left << std::setw(36) << "lock" << std::right
+        << std::setw(12) << "acquire" << std::setw(10) << "shared"
+        << std::setw(10) << "contend" << std::setw(12) << "wait ms" << std::setw(12) << "wait max us"
+        << std::setw(12) << "hold ms" << std::setw(12) << "hold max us" << "\n";
+    out << std::fixed << std::setprecision(2);
+
+    for (const auto& stats : snapshot()) {
+        out << std::left << std::setw(36) << stats.name << std::right
+            << std::setw(12) << stats.acquisitions << std::setw(10) << stats.sharedAcquisitions
+            << std::setw(10) << stats.contentions << std::setw(12) << stats.waitTotalMs
+            << std::setw(12) << stats.waitMaxUs << std::setw(12) << stats.holdTotalMs
+            << std::setw(12) << stats.holdMaxUs << "\n";
+        if (stats.recursiveAcquisitions > 0) {
+            out << "  !! recursive acquisitions: " << stats.recursiveAcquisitions << "\n";
+        }
+    }
+
+    out << "Lock order edges (held -> acquired)\n";
+    for (const auto& edge : orderEdges()) {
+        out << "  " << edge.from << " -> " << edge.to << "  x" << edge.count << "\n";
+    }
+
+    auto inversions = findInversions();
+    out << "Lock order inversions: " << (inversions.empty() ? "none" : "") << "\n";
+    for (const auto& inversion : inversions) {
+        out << "  !! " << inversion << "\n";
+    }
+
+    return out.str();
+}
+
+void LockProfiler::reset() {
+    std::lock_guard<std::mutex> lock(m_registryMutex);
+
+    for (auto& counters : m_counters) {
+        counters.acquisitions.store(0, std::memory_order_relaxed);
+        counters.sharedAcquisitions.store(0, std::memory_order_relaxed);
+        counters.contentions.store(0, std::memory_order_relaxed);
+        counters.recursiveAcquisitions.store(0, std::memory_order_relaxed);
+        counters.waitTotalNs.store(0, std::memory_order_relaxed);
+        counters.waitMaxNs.store(0, std::memory_order_relaxed);
+        counters.holdTotalNs.store(0, std::memory_order_relaxed);
+        counters.holdMaxNs.store(0, std::memory_order_relaxed);
+    }
+    for (auto& row : m_edges) {
+        for (auto& edge : row) {
+            edge.store(0, std::memory_order_relaxed);
+        }
+    }
+}
+
+} // namespace WeaponControl
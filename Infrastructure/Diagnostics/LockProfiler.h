@@ -0,0 +1,290 @@
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <mutex>
+#include <shared_mutex>
+#include <string>
+#include <vector>
+
+namespace WeaponControl {
+
+// =============================================================================
+// 잠금별 집계 결과
+// =============================================================================
+
+struct LockClassStats {
+    std::string name;
+    uint64_t acquisitions;          // 배타 + 공유
+    uint64_t sharedAcquisitions;
+    uint64_t contentions;           // 즉시 획득하지 못한 횟수
+    uint64_t recursiveAcquisitions; // 같은 스레드가 이미 보유한 잠금을 다시 획득
+    double waitTotalMs;
+    double waitMaxUs;
+    double holdTotalMs;
+    double holdMaxUs;
+
+    LockClassStats()
+        : acquisitions(0), sharedAcquisitions(0), contentions(0), recursiveAcquisitions(0)
+        , waitTotalMs(0.0), waitMaxUs(0.0), holdTotalMs(0.0), holdMaxUs(0.0) {}
+};
+
+// 잠금 순서 간선: from 을 보유한 채 to 를 획득
+struct LockOrderEdge {
+    std::string from;
+    std::string to;
+    uint64_t count;
+};
+
+// =============================================================================
+// 잠금 경합 계측기
+//
+// 같은 이름의 잠금(예: 무장별 m_stateMutex)은 하나의 잠금 클래스로 집계한다.
+// 스레드별 보유 목록으로 보유 시간과 잠금 순서 간선을 기록하며, 양방향
+// 간선(순서 역전)과 재귀 획득을 보고한다. 계측은 WEAPONCONTROL_LOCK_PROFILING
+// 을 정의하여 빌드한 경우에만 동작하며, 그 외에는 ProfiledMutex 가 표준
+// 뮤텍스와 동일하다.
+// =============================================================================
+
+class LockProfiler {
+public:
+    static constexpr size_t MAX_LOCK_CLASSES = 32;
+    static constexpr size_t MAX_HELD_LOCKS = 16;
+
+    static LockProfiler& getInstance() {
+        static LockProfiler instance;
+        return instance;
+    }
+
+    static constexpr bool isCompiledIn() {
+#ifdef WEAPONCONTROL_LOCK_PROFILING
+        return true;
+#else
+        return false;
+#endif
+    }
+
+    static uint64_t nowNs() {
+        return static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(
+            std::chrono::steady_clock::now().time_since_epoch()).count());
+    }
+
+    // 같은 이름은 같은 ID 반환
+    uint16_t registerClass(const char* name);
+
+    // blocking=false (try_lock): 기다리지 않으므로 교착이 될 수 없어 순서 간선을 남기지 않는다
+    void beforeAcquire(uint16_t classId, const void* instance, bool blocking = true);
+    void onAcquired(uint16_t classId, const void* instance, bool shared, uint64_t waitNs, bool contended);
+    void onReleased(uint16_t classId, const void* instance);
+
+    std::vector<LockClassStats> snapshot() const;
+    std::vector<LockOrderEdge> orderEdges() const;
+    std::vector<std::string> findInversions() const;
+    std::string formatReport() const;
+    void reset();
+
+private:
+    struct ClassCounters {
+        std::atomic<uint64_t> acquisitions{0};
+        std::atomic<uint64_t> sharedAcquisitions{0};
+        std::atomic<uint64_t> contentions{0};
+        std::atomic<uint64_t> recursiveAcquisitions{0};
+        std::atomic<uint64_t> waitTotalNs{0};
+        std::atomic<uint64_t> waitMaxNs{0};
+        std::atomic<uint64_t> holdTotalNs{0};
+        std::atomic<uint64_t> holdMaxNs{0};
+    };
+
+    struct HeldLock {
+        const void* instance;
+        uint16_t classId;
+        uint64_t acquiredNs;
+    };
+
+    struct HeldLocks {
+        std::array<HeldLock, MAX_HELD_LOCKS> entries;
+        size_t count = 0;
+    };
+
+    LockProfiler() : m_classCount(0) {}
+
+    static void updateMax(std::atomic<uint64_t>& target, uint64_t value) {
+        uint64_t current = target.load(std::memory_order_relaxed);
+        while (value > current && !target.compare_exchange_weak(current, value, std::memory_order_relaxed)) {
+        }
+    }
+
+    static HeldLocks& heldLocks() {
+        thread_local HeldLocks held;
+        return held;
+    }
+
+    mutable std::mutex m_registryMutex;
+    std::array<std::string, MAX_LOCK_CLASSES> m_classNames;
+    std::atomic<size_t> m_classCount;
+    std::array<ClassCounters, MAX_LOCK_CLASSES> m_counters;
+    std::array<std::array<std::atomic<uint64_t>, MAX_LOCK_CLASSES>, MAX_LOCK_CLASSES> m_edges{};
+};
+
+// =============================================================================
+// 이름 있는 뮤텍스
+// =============================================================================
+
+#ifdef WEAPONCONTROL_LOCK_PROFILING
+
+template <typename Base>
+class InstrumentedMutexBase {
+public:
+    explicit InstrumentedMutexBase(const char* name)
+        : m_classId(LockProfiler::getInstance().registerClass(name)) {}
+
+    InstrumentedMutexBase(const InstrumentedMutexBase&) = delete;
+    InstrumentedMutexBase& operator=(const InstrumentedMutexBase&) = delete;
+
+    void lock() {
+        auto& profiler = LockProfiler::getInstance();
+        profiler.beforeAcquire(m_classId, this);
+        if (m_mutex.try_lock()) {
+            profiler.onAcquired(m_classId, this, false, 0, false);
+            return;
+        }
+        uint64_t start = LockProfiler::nowNs();
+        m_mutex.lock();
+        profiler.onAcquired(m_classId, this, false, LockProfiler::nowNs() - start, true);
+    }
+
+    bool try_lock() {
+        auto& profiler = LockProfiler::getInstance();
+        profiler.beforeAcquire(m_classId, this, false);
+        if (!m_mutex.try_lock()) {
+            return false;
+        }
+        profiler.onAcquired(m_classId, this, false, 0, false);
+        return true;
+    }
+
+    void unlock() {
+        LockProfiler::getInstance().onReleased(m_classId, this);
+        m_mutex.unlock();
+    }
+
+protected:
+    Base m_mutex;
+    uint16_t m_classId;
+};
+
+class ProfiledMutex : public InstrumentedMutexBase<std::mutex> {
+public:
+    using InstrumentedMutexBase::InstrumentedMutexBase;
+};
+
+class ProfiledSharedMutex : public InstrumentedMutexBase<std::shared_mutex> {
+public:
+    using InstrumentedMutexBase::InstrumentedMutexBase;
+
+    void lock_shared() {
+        auto& profiler = LockProfiler::getInstance();
+        profiler.beforeAcquire(m_classId, this);
+        if (m_mutex.try_lock_shared()) {
+            profiler.onAcquired(m_classId, this, true, 0, false);
+            return;
+        }
+        uint64_t start = LockProfiler::nowNs();
+        m_mutex.lock_shared();
+        profiler.onAcquired(m_classId, this, true, LockProfiler::nowNs() - start, true);
+    }
+
+    bool try_lock_shared() {
+        auto& profiler = LockProfiler::getInstance();
+        profiler.beforeAcquire(m_classId, this, false);
+        if (!m_mutex.try_lock_shared()) {
+            return false;
+        }
+        profiler.onAcquired(m_classId, this, true, 0, false);
+        return true;
+    }
+
+    void unlock_shared() {
+        LockProfiler::getInstance().onReleased(m_classId, this);
+        m_mutex.unlock_shared();
+    }
+};
+
+#else
+
+class ProfiledMutex : public std::mutex {
+public:
+    explicit ProfiledMutex(const char*) {}
+};
+
+class ProfiledSharedMutex : public std::shared_mutex {
+public:
+    explicit ProfiledSharedMutex(const char*) {}
+};
+
+#endif
+
+// =============================================================================
+// 대기 중 잠금 양보
+//
+// 공유 잠금을 잡은 명령이 무장 전이(POC 지연, 발사 단계)나 다른 명령의 전이가
+// 끝나기를 기다리는 동안 잠금을 계속 잡으면, 같은 잠금을 배타로 잡는 주기 갱신이
+// 대기 시간만큼 멈춘다. 잠금을 잡은 쪽이 ScopedWaitYield 로 현재 스레드에
+// 등록해 두면 ScopedBlockingWait 구간 동안 그 잠금을 풀었다가 구간이 끝나면 다시
+// 잡는다. 등록이 없는 스레드(주기 스레드 등)에서는 아무 일도 하지 않는다.
+// =============================================================================
+
+struct WaitYieldEntry {
+    void* lock = nullptr;
+    void (*release)(void*) = nullptr;
+    void (*reacquire)(void*) = nullptr;
+};
+
+inline WaitYieldEntry& currentWaitYield() {
+    thread_local WaitYieldEntry entry;
+    return entry;
+}
+
+template <typename Lock>
+class ScopedWaitYield {
+public:
+    explicit ScopedWaitYield(Lock& lock) : m_previous(currentWaitYield()) {
+        currentWaitYield() = WaitYieldEntry{
+            &lock,
+            [](void* held) { static_cast<Lock*>(held)->unlock(); },
+            [](void* held) { static_cast<Lock*>(held)->lock(); }};
+    }
+    ~ScopedWaitYield() { currentWaitYield() = m_previous; }
+
+    ScopedWaitYield(const ScopedWaitYield&) = delete;
+    ScopedWaitYield& operator=(const ScopedWaitYield&) = delete;
+
+private:
+    WaitYieldEntry m_previous;
+};
+
+class ScopedBlockingWait {
+public:
+    ScopedBlockingWait() : m_entry(currentWaitYield()) {
+        if (m_entry.lock) {
+            currentWaitYield() = WaitYieldEntry{};     // 중첩 대기에서 두 번 풀지 않도록
+            m_entry.release(m_entry.lock);
+        }
+    }
+    ~ScopedBlockingWait() {
+        if (m_entry.lock) {
+            m_entry.reacquire(m_entry.lock);
+            currentWaitYield() = m_entry;
+        }
+    }
+
+    ScopedBlockingWait(const ScopedBlockingWait&) = delete;
+    ScopedBlockingWait& operator=(const ScopedBlockingWait&) = delete;
+
+private:
+    WaitYieldEntry m_entry;
+};
+
+} // namespace WeaponControl
@@ -0,0 +1,184 @@
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <map>
+#include <memory>
+#include <new>
+#include <string>
+#include <vector>
+
+namespace WeaponControl {
+
+// =============================================================================
+// 메모리 계정 정의
+// =============================================================================
+
+enum class MemoryAccountId : uint8_t {
+    TARGET_STORE = 0,       // TargetTrackingService::m_targets
+    TUBE_TARGET_CACHE,      // LaunchTubeManager::m_targetInfoMap
+    PLAN_CACHE,             // MineDropPlanService::m_cachedPlans
+    CONFIG,                 // SystemConfig::m_config, m_strings
+    OBSERVERS,              // WeaponBase::m_observers
+    LOGGING_BUFFERS,        // EventRecorder / TraceRecorder 버퍼
+    COUNT
+};
+
+constexpr size_t MEMORY_ACCOUNT_COUNT = static_cast<size_t>(MemoryAccountId::COUNT);
+
+inline const char* MemoryAccountName(MemoryAccountId id) {
+    switch (id) {
+        case MemoryAccountId::TARGET_STORE: return "target store";
+        case MemoryAccountId::TUBE_TARGET_CACHE: return "tube target cache";
+        case MemoryAccountId::PLAN_CACHE: return "mine plan cache";
+        case MemoryAccountId::CONFIG: return "config";
+        case MemoryAccountId::OBSERVERS: return "state observers";
+        case MemoryAccountId::LOGGING_BUFFERS: return "logging buffers";
+        default: return "unknown";
+    }
+}
+
+struct MemoryAccountStats {
+    MemoryAccountId id;
+    const char* name;
+    int64_t liveBytes;
+    int64_t peakBytes;
+    uint64_t allocations;
+    uint64_t deallocations;
+
+    MemoryAccountStats()
+        : id(MemoryAccountId::COUNT), name(""), liveBytes(0), peakBytes(0), allocations(0), deallocations(0) {}
+};
+
+// 발사관 할당별 동적 메모리 (컨테이너 용량 기준)
+struct MemoryFootprint {
+    size_t trajectoryBytes = 0;
+    size_t waypointBytes = 0;
+    size_t observerBytes = 0;
+    size_t otherBytes = 0;
+
+    size_t total() const { return trajectoryBytes + waypointBytes + observerBytes + otherBytes; }
+
+    MemoryFootprint& operator+=(const MemoryFootprint& other) {
+        trajectoryBytes += other.trajectoryBytes;
+        waypointBytes += other.waypointBytes;
+        observerBytes += other.observerBytes;
+        otherBytes += other.otherBytes;
+        return *this;
+    }
+};
+
+template <typename Container>
+size_t ContainerCapacityBytes(const Container& container) {
+    return container.capacity() * sizeof(typename Container::value_type);
+}
+
+// =============================================================================
+// 메모리 계정 집계기
+//
+// 장기 보관 컨테이너는 AccountedAllocator 로 할당/해제를 계정별로 집계한다.
+// 컨테이너 자체의 할당(노드, 배열)만 집계하며 원소 내부의 문자열 등은
+// 포함하지 않는다. 발사관별 궤적/경로점은 LaunchTube::getMemoryFootprint()
+// 로 조회 시점에 용량을 합산한다.
+// =============================================================================
+
+class MemoryAccounting {
+public:
+    static MemoryAccounting& getInstance() {
+        static MemoryAccounting instance;
+        return instance;
+    }
+
+    void onAllocate(MemoryAccountId id, size_t bytes) {
+        auto& account = m_accounts[static_cast<size_t>(id)];
+        account.allocations.fetch_add(1, std::memory_order_relaxed);
+        int64_t live = account.liveBytes.fetch_add(static_cast<int64_t>(bytes), std::memory_order_relaxed)
+                     + static_cast<int64_t>(bytes);
+        int64_t peak = account.peakBytes.load(std::memory_order_relaxed);
+        while (live > peak && !account.peakBytes.compare_exchange_weak(peak, live, std::memory_order_relaxed)) {
+        }
+    }
+
+    void onDeallocate(MemoryAccountId id, size_t bytes) {
+        auto& account = m_accounts[static_cast<size_t>(id)];
+        account.deallocations.fetch_add(1, std::memory_order_relaxed);
+        account.liveBytes.fetch_sub(static_cast<int64_t>(bytes), std::memory_order_relaxed);
+    }
+
+    std::vector<MemoryAccountStats> snapshot() const {
+        std::vector<MemoryAccountStats> result(MEMORY_ACCOUNT_COUNT);
+        for (size_t i = 0; i < MEMORY_ACCOUNT_COUNT; ++i) {
+            const auto& account = m_accounts[i];
+            auto& stats = result[i];
+            stats.id = static_cast<MemoryAccountId>(i);
+            stats.name = MemoryAccountName(stats.id);
+            stats.liveBytes = account.liveBytes.load(std::memory_order_relaxed);
+            stats.peakBytes = account.peakBytes.load(std::memory_order_relaxed);
+            stats.allocations = account.allocations.load(std::memory_order_relaxed);
+            stats.deallocations = account.deallocations.load(std::memory_order_relaxed);
+        }
+        return result;
+    }
+
+private:
+    struct alignas(64) Account {
+        std::atomic<int64_t> liveBytes{0};
+        std::atomic<int64_t> peakBytes{0};
+        std::atomic<uint64_t> allocations{0};
+        std::atomic<uint64_t> deallocations{0};
+    };
+
+    MemoryAccounting() = default;
+
+    std::array<Account, MEMORY_ACCOUNT_COUNT> m_accounts;
+};
+
+// =============================================================================
+// 계정 지정 할당자 - 표준 할당자와 같은 상태 없는 형태
+// =============================================================================
+
+template <typename T, MemoryAccountId Account>
+class AccountedAllocator {
+public:
+    using value_type = T;
+
+    template <typename U>
+    struct rebind {
+        using other = AccountedAllocator<U, Account>;
+    };
+
+    AccountedAllocator() noexcept = default;
+
+    template <typename U>
+    AccountedAllocator(const AccountedAllocator<U, Account>&) noexcept {}
+
+    T* allocate(size_t count) {
+        size_t bytes = count * sizeof(T);
+        T* ptr = std::allocator<T>().allocate(count);
+        MemoryAccounting::getInstance().onAllocate(Account, bytes);
+        return ptr;
+    }
+
+    void deallocate(T* ptr, size_t count) noexcept {
+        MemoryAccounting::getInstance().onDeallocate(Account, count * sizeof(T));
+        std::allocator<T>().deallocate(ptr, count);
+    }
+
+    template <typename U>
+    bool operator==(const AccountedAllocator<U, Account>&) const noexcept { return true; }
+
+    template <typename U>
+    bool operator!=(const AccountedAllocator<U, Account>&) const noexcept { return false; }
+};
+
+// 계정 지정 컨테이너 별칭
+template <typename Key, typename Value, MemoryAccountId Account, typename Compare = std::less<Key>>
+using AccountedMap = std::map<Key, Value, Compare, AccountedAllocator<std::pair<const Key, Value>, Account>>;
+
+template <typename T, MemoryAccountId Account>
+using AccountedVector = std::vector<T, AccountedAllocator<T, Account>>;
+
+} // namespace WeaponControl
@@ -0,0 +1,362 @@
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <cstdio>
+#include <fstream>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <sstream>
+#include <string>
+#include <thread>
+
+namespace WeaponControl {
+
+// =============================================================================
+// 카운터 - 스레드별 샤드로 분산 (쓰기 경합 없음, 조회 시 합산)
+// =============================================================================
+
+constexpr size_t METRIC_SHARD_COUNT = 16;
+
+inline size_t metricShardIndex() {
+    static std::atomic<size_t> nextShard{0};
+    thread_local size_t shard = nextShard.fetch_add(1, std::memory_order_relaxed) % METRIC_SHARD_COUNT;
+    return shard;
+}
+
+class MetricCounter {
+public:
+    void increment(uint64_t delta = 1) {
+        m_shards[metricShardIndex()].value.fetch_add(delta, std::memory_order_relaxed);
+    }
+
+    uint64_t value() const {
+        uint64_t total = 0;
+        for (const auto& shard : m_shards) {
+            total += shard.value.load(std::memory_order_relaxed);
+        }
+        return total;
+    }
+
+    void reset() {
+        for (auto& shard : m_shards) {
+            shard.value.store(0, std::memory_order_relaxed);
+        }
+    }
+
+private:
+    struct alignas(64) Shard {
+        std::atomic<uint64_t> value{0};
+    };
+
+    std::array<Shard, METRIC_SHARD_COUNT> m_shards;
+};
+
+// =============================================================================
+// 게이지 - 현재값 (큐 깊이, 할당 발사관 수 등)
+// =============================================================================
+
+class MetricGauge {
+public:
+    void set(int64_t value) { m_value.store(value, std::memory_order_relaxed); }
+    void add(int64_t delta) { m_value.fetch_add(delta, std::memory_order_relaxed); }
+    int64_t value() const { return m_value.load(std::memory_order_relaxed); }
+    void reset() { set(0); }
+
+private:
+    alignas(64) std::atomic<int64_t> m_value{0};
+};
+
+// =============================================================================
+// 히스토그램 - HDR 방식 로그-선형 버킷 (상대 오차 ~12.5%)
+// =============================================================================
+
+class MetricHistogram {
+public:
+    void record(uint64_t value) {
+        m_buckets[bucketIndex(value)].fetch_add(1, std::memory_order_relaxed);
+        m_count.fetch_add(1, std::memory_order_relaxed);
+        m_sum.fetch_add(value, std::memory_order_relaxed);
+
+        uint64_t currentMax = m_max.load(std::memory_order_relaxed);
+        while (value > currentMax &&
+               !m_max.compare_exchange_weak(currentMax, value, std::memory_order_relaxed)) {
+        }
+    }
+
+    uint64_t count() const { return m_count.load(std::memory_order_relaxed); }
+    uint64_t sum() const { return m_sum.load(std::memory_order_relaxed); }
+    uint64_t max() const { return m_max.load(std::memory_order_relaxed); }
+
+    // q 분위수 (버킷 상한값, 최대값 이하로 제한)
+    uint64_t quantile(double q) const {
+        uint64_t total = count();
+        if (total == 0) {
+            return 0;
+        }
+
+        uint64_t rank = static_cast<uint64_t>(q * (total - 1)) + 1;
+        uint64_t seen = 0;
+        for (size_t b = 0; b < BUCKET_COUNT; ++b) {
+            seen += m_buckets[b].load(std::memory_order_relaxed);
+            if (seen >= rank) {
+                return std::min(bucketUpperBound(b), max());
+            }
+        }
+        return max();
+    }
+
+    void reset() {
+        for (auto& bucket : m_buckets) {
+            bucket.store(0, std::memory_order_relaxed);
+        }
+        m_count.store(0, std::memory_order_relaxed);
+        m_sum.store(0, std::memory_order_relaxed);
+        m_max.store(0, std::memory_order_relaxed);
+    }
+
+private:
+    static constexpr size_t SUB_BUCKET_BITS = 3;
+    static constexpr size_t BUCKET_COUNT = 64 << SUB_BUCKET_BITS;
+
+    static size_t bucketIndex(uint64_t value) {
+        if (value < (1u << SUB_BUCKET_BITS)) {
+            return static_cast<size_t>(value);
+        }
+        size_t msb = 63 - static_cast<size_t>(__builtin_clzll(value));
+        size_t sub = static_cast<size_t>(value >> (msb - SUB_BUCKET_BITS)) & ((1u << SUB_BUCKET_BITS) - 1);
+        return ((msb - SUB_BUCKET_BITS + 1) << SUB_BUCKET_BITS) + sub;
+    }
+
+    static uint64_t bucketUpperBound(size_t index) {
+        if (index < (1u << SUB_BUCKET_BITS)) {
+            return index;
+        }
+        size_t msb = (index >> SUB_BUCKET_BITS) + SUB_BUCKET_BITS - 1;
+        uint64_t sub = index & ((1u << SUB_BUCKET_BITS) - 1);
+        return (uint64_t(1) << msb) + ((sub + 1) << (msb - SUB_BUCKET_BITS)) - 1;
+    }
+
+    std::array<std::atomic<uint64_t>, BUCKET_COUNT> m_buckets{};
+    alignas(64) std::atomic<uint64_t> m_count{0};
+    std::atomic<uint64_t> m_sum{0};
+    std::atomic<uint64_t> m_max{0};
+};
+
+// =============================================================================
+// 지표 레지스트리 - 이름+레이블 단위 등록, Prometheus 텍스트 형식 내보내기
+//
+// 등록(counter/gauge/histogram)은 잠금을 사용하므로 호출자는 반환된 참조를
+// 초기화 시점에 보관하고 핫패스에서는 참조만 사용한다. 반환된 참조는
+// 프로세스 종료 시까지 유효하다.
+// =============================================================================
+
+class MetricsRegistry {
+public:
+    static MetricsRegistry& getInstance() {
+        static MetricsRegistry instance;
+        return instance;
+    }
+
+    // labels 예: "tube=\"3\",state=\"ON\""
+    MetricCounter& counter(const std::string& name, const std::string& help, const std::string& labels = "") {
+        return getOrCreate(m_counters, name, help, labels, "counter");
+    }
+
+    MetricGauge& gauge(const std::string& name, const std::string& help, const std::string& labels = "") {
+        return getOrCreate(m_gauges, name, help, labels, "gauge");
+    }
+
+    MetricHistogram& histogram(const std::string& name, const std::string& help, const std::string& labels = "") {
+        return getOrCreate(m_histograms, name, help, labels, "summary");
+    }
+
+    // 전체 지표 스냅샷 (Prometheus text exposition format 0.0.4)
+    std::string exportPrometheus() const {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        std::ostringstream out;
+
+        for (const auto& family : m_families) {
+            const std::string& name = family.first;
+            out << "# HELP " << name << " " << family.second.help << "\n";
+            out << "# TYPE " << name << " " << family.second.type << "\n";
+
+            if (family.second.type == "counter") {
+                forEachSeries(m_counters, name, [&](const std::string& labels, const MetricCounter& c) {
+                    out << name << formatLabels(labels) << " " << c.value() << "\n";
+                });
+            } else if (family.second.type == "gauge") {
+                forEachSeries(m_gauges, name, [&](const std::string& labels, const MetricGauge& g) {
+                    out << name << formatLabels(labels) << " " << g.value() << "\n";
+                });
+            } else {
+                forEachSeries(m_histograms, name, [&](const std::string& labels, const MetricHistogram& h) {
+                    for (double q : {0.5, 0.9, 0.99, 0.999}) {
+                        std::string quantileLabel = "quantile=\"" + formatQuantile(q) + "\"";
+                        out << name << formatLabels(labels.empty() ? quantileLabel : labels + "," + quantileLabel)
+                            << " " << h.quantile(q) << "\n";
+                    }
+                    out << name << "_sum" << formatLabels(labels) << " " << h.sum() << "\n";
+                    out << name << "_count" << formatLabels(labels) << " " << h.count() << "\n";
+                });
+            }
+        }
+
+        return out.str();
+    }
+
+    // 레이블 무관 카운터 합계 (SystemStatistics 집계용)
+    uint64_t counterTotal(const std::string& name, const std::string& labelFilter = "") const {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        uint64_t total = 0;
+        forEachSeries(m_counters, name, [&](const std::string& labels, const MetricCounter& c) {
+            if (labelFilter.empty() || labels.find(labelFilter) != std::string::npos) {
+                total += c.value();
+            }
+        });
+        return total;
+    }
+
+    void reset() {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        for (auto& entry : m_counters) entry.second->reset();
+        for (auto& entry : m_gauges) entry.second->reset();
+        for (auto& entry : m_histograms) entry.second->reset();
+    }
+
+private:
+    struct Family {
+        std::string help;
+        std::string type;
+    };
+
+    MetricsRegistry() = default;
+    MetricsRegistry(const MetricsRegistry&) = delete;
+    MetricsRegistry& operator=(const MetricsRegistry&) = delete;
+
+    static std::string seriesKey(const std::string& name, const std::string& labels) {
+        return name + "{" + labels + "}";
+    }
+
+    static std::string formatLabels(const std::string& labels) {
+        return labels.empty() ? std::string() : "{" + labels + "}";
+    }
+
+    static std::string formatQuantile(double q) {
+        std::ostringstream out;
+        out << q;
+        return out.str();
+    }
+
+    template<typename Metric>
+    Metric& getOrCreate(std::map<std::string, std::unique_ptr<Metric>>& series,
+                        const std::string& name, const std::string& help,
+                        const std::string& labels, const char* type) {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_families.emplace(name, Family{help, type});
+
+        auto& slot = series[seriesKey(name, labels)];
+        if (!slot) {
+            slot = std::make_unique<Metric>();
+        }
+        return *slot;
+    }
+
+    // 같은 이름의 시계열은 "name{" 접두사로 연속 배치됨
+    template<typename Metric, typename Fn>
+    static void forEachSeries(const std::map<std::string, std::unique_ptr<Metric>>& series,
+                              const std::string& name, Fn&& fn) {
+        std::string prefix = name + "{";
+        for (auto it = series.lower_bound(prefix);
+             it != series.end() && it->first.compare(0, prefix.size(), prefix) == 0; ++it) {
+            std::string labels = it->first.substr(prefix.size(), it->first.size() - prefix.size() - 1);
+            fn(labels, *it->second);
+        }
+    }
+
+    mutable std::mutex m_mutex;
+    std::map<std::string, Family> m_families;
+    std::map<std::string, std::unique_ptr<MetricCounter>> m_counters;
+    std::map<std::string, std::unique_ptr<MetricGauge>> m_gauges;
+    std::map<std::string, std::unique_ptr<MetricHistogram>> m_histograms;
+};
+
+// =============================================================================
+// 주기적 파일 덤프 (node_exporter textfile collector 등에서 수집)
+// =============================================================================
+
+class MetricsFileDumper {
+public:
+    MetricsFileDumper() : m_running(false) {}
+    ~MetricsFileDumper() { stop(); }
+
+    MetricsFileDumper(const MetricsFileDumper&) = delete;
+    MetricsFileDumper& operator=(const MetricsFileDumper&) = delete;
+
+    void start(const std::string& path, std::chrono::milliseconds interval) {
+        stop();
+        m_path = path;
+        m_interval = interval;
+        m_running = true;
+        m_thread = std::thread([this]() { run(); });
+    }
+
+    void stop() {
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            if (!m_running) {
+                return;
+            }
+            m_running = false;
+        }
+        m_wakeup.notify_all();
+        if (m_thread.joinable()) {
+            m_thread.join();
+        }
+        dumpOnce();
+    }
+
+    // 임시 파일에 쓴 후 rename 하여 수집기가 중간 상태를 읽지 않도록 함
+    bool dumpOnce() const {
+        if (m_path.empty()) {
+            return false;
+        }
+
+        std::string tempPath = m_path + ".tmp";
+        {
+            std::ofstream file(tempPath, std::ios::trunc);
+            if (!file.is_open()) {
+                return false;
+            }
+            file << MetricsRegistry::getInstance().exportPrometheus();
+        }
+        return std::rename(tempPath.c_str(), m_path.c_str()) == 0;
+    }
+
+private:
+    void run() {
+        std::unique_lock<std::mutex> lock(m_mutex);
+        while (m_running) {
+            m_wakeup.wait_for(lock, m_interval, [this]() { return !m_running; });
+            if (m_running) {
+                lock.unlock();
+                dumpOnce();
+                lock.lock();
+            }
+        }
+    }
+
+    std::string m_path;
+    std::chrono::milliseconds m_interval{1000};
+    bool m_running;
+    std::mutex m_mutex;
+    std::condition_variable m_wakeup;
+    std::thread m_thread;
+};
+
+} // namespace WeaponControl
@@ -0,0 +1,270 @@
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#endif
+
+namespace WeaponControl {
+
+// =============================================================================
+// 계측 구간 정의
+// =============================================================================
+
+enum class ProfileStage : uint8_t {
+    TUBE_MANAGER_UPDATE = 0,    // LaunchTubeManager::update (주기 전체)
+    TUBE_UPDATE,                // LaunchTube::update
+    ENGAGEMENT_PLAN,            // LaunchTube::calculateEngagementPlan
+    TRAJECTORY,                 // calculateTrajectory
+    OBSERVER_NOTIFY,            // 무장 상태 관찰자 통지
+    MINE_PLAN_IO,               // MineDropPlanService 파일 I/O
+    TARGET_INGEST,              // TargetTrackingService 표적 수신
+    POST_LAUNCH_TRACKING,       // PostLaunchTracker 일괄 위치 계산
+    COUNT
+};
+
+constexpr size_t PROFILE_STAGE_COUNT = static_cast<size_t>(ProfileStage::COUNT);
+
+inline const char* ProfileStageName(ProfileStage stage) {
+    switch (stage) {
+        case ProfileStage::TUBE_MANAGER_UPDATE: return "LaunchTubeManager::update";
+        case ProfileStage::TUBE_UPDATE: return "LaunchTube::update";
+        case ProfileStage::ENGAGEMENT_PLAN: return "calculateEngagementPlan";
+        case ProfileStage::TRAJECTORY: return "calculateTrajectory";
+        case ProfileStage::OBSERVER_NOTIFY: return "observerNotify";
+        case ProfileStage::MINE_PLAN_IO: return "MineDropPlanService I/O";
+        case ProfileStage::TARGET_INGEST: return "TargetTrackingService ingest";
+        case ProfileStage::POST_LAUNCH_TRACKING: return "postLaunchTracking";
+        default: return "unknown";
+    }
+}
+
+// =============================================================================
+// 구간별 집계 결과
+// =============================================================================
+
+struct StageTimingStats {
+    ProfileStage stage;
+    const char* name;
+    uint64_t count;
+    double totalMs;
+    double meanUs;
+    double p50Us;
+    double p99Us;
+    double maxUs;
+
+    StageTimingStats()
+        : stage(ProfileStage::COUNT), name(""), count(0), totalMs(0.0)
+        , meanUs(0.0), p50Us(0.0), p99Us(0.0), maxUs(0.0) {}
+};
+
+// =============================================================================
+// 구간 계측기 - 스레드별 히스토그램, 조회 시 합산
+//
+// 기록 경로는 스레드 전용 슬롯에 relaxed 저장만 수행하므로 (잠금/원자적
+// RMW 없음) 샘플당 비용은 타임스탬프 2회 읽기 수준이다. x86 에서는 TSC,
+// 그 외에는 steady_clock 을 사용하며 TSC 는 조회 시점에 ns 로 환산한다.
+// =============================================================================
+
+class StageProfiler {
+public:
+    static StageProfiler& getInstance() {
+        static StageProfiler instance;
+        return instance;
+    }
+
+    static uint64_t readTicks() {
+#if defined(__x86_64__) || defined(__i386__)
+        return __rdtsc();
+#else
+        return static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(
+            std::chrono::steady_clock::now().time_since_epoch()).count());
+#endif
+    }
+
+    bool isEnabled() const { return m_enabled.load(std::memory_order_relaxed); }
+    void setEnabled(bool enabled) { m_enabled.store(enabled, std::memory_order_relaxed); }
+
+    void record(ProfileStage stage, uint64_t ticks) {
+        auto& histogram = localBlock().stages[static_cast<size_t>(stage)];
+        bump(histogram.count, 1);
+        bump(histogram.totalTicks, ticks);
+        if (ticks > histogram.maxTicks.load(std::memory_order_relaxed)) {
+            histogram.maxTicks.store(ticks, std::memory_order_relaxed);
+        }
+        bump(histogram.buckets[bucketIndex(ticks)], 1);
+    }
+
+    std::vector<StageTimingStats> snapshot() const {
+        double nsPerTick = calibrateNsPerTick();
+        std::vector<StageTimingStats> result(PROFILE_STAGE_COUNT);
+
+        std::lock_guard<std::mutex> lock(m_blocksMutex);
+        for (size_t s = 0; s < PROFILE_STAGE_COUNT; ++s) {
+            uint64_t count = 0;
+            uint64_t totalTicks = 0;
+            uint64_t maxTicks = 0;
+            std::array<uint64_t, BUCKET_COUNT> buckets{};
+
+            for (const auto& block : m_blocks) {
+                const auto& h = block->stages[s];
+                count += h.count.load(std::memory_order_relaxed);
+                totalTicks += h.totalTicks.load(std::memory_order_relaxed);
+                maxTicks = std::max(maxTicks, h.maxTicks.load(std::memory_order_relaxed));
+                for (size_t b = 0; b < BUCKET_COUNT; ++b) {
+                    buckets[b] += h.buckets[b].load(std::memory_order_relaxed);
+                }
+            }
+
+            auto& stats = result[s];
+            stats.stage = static_cast<ProfileStage>(s);
+            stats.name = ProfileStageName(stats.stage);
+            stats.count = count;
+            stats.totalMs = totalTicks * nsPerTick / 1e6;
+            stats.meanUs = count ? totalTicks * nsPerTick / count / 1e3 : 0.0;
+            // 버킷 상한값은 실제 최대값을 넘지 않도록 제한
+            double maxTicksValue = static_cast<double>(maxTicks);
+            stats.p50Us = std::min(percentileTicks(buckets, count, 0.50), maxTicksValue) * nsPerTick / 1e3;
+            stats.p99Us = std::min(percentileTicks(buckets, count, 0.99), maxTicksValue) * nsPerTick / 1e3;
+            stats.maxUs = maxTicks * nsPerTick / 1e3;
+        }
+
+        return result;
+    }
+
+    void reset() {
+        std::lock_guard<std::mutex> lock(m_blocksMutex);
+        for (auto& block : m_blocks) {
+            for (auto& h : block->stages) {
+                h.count.store(0, std::memory_order_relaxed);
+                h.totalTicks.store(0, std::memory_order_relaxed);
+                h.maxTicks.store(0, std::memory_order_relaxed);
+                for (auto& b : h.buckets) {
+                    b.store(0, std::memory_order_relaxed);
+                }
+            }
+        }
+    }
+
+private:
+    // 로그 스케일 버킷: 2의 거듭제곱 구간을 4개로 세분 (상대 오차 ~25%)
+    static constexpr size_t SUB_BUCKET_BITS = 2;
+    static constexpr size_t BUCKET_COUNT = 64 << SUB_BUCKET_BITS;
+
+    struct StageHistogram {
+        std::atomic<uint64_t> count{0};
+        std::atomic<uint64_t> totalTicks{0};
+        std::atomic<uint64_t> maxTicks{0};
+        std::array<std::atomic<uint64_t>, BUCKET_COUNT> buckets{};
+    };
+
+    struct alignas(64) ThreadBlock {
+        std::array<StageHistogram, PROFILE_STAGE_COUNT> stages;
+    };
+
+    StageProfiler()
+        : m_enabled(true)
+        , m_originTicks(readTicks())
+        , m_originTime(std::chrono::steady_clock::now()) {}
+
+    // 단일 기록자이므로 RMW 대신 load/store
+    static void bump(std::atomic<uint64_t>& value, uint64_t delta) {
+        value.store(value.load(std::memory_order_relaxed) + delta, std::memory_order_relaxed);
+    }
+
+    static size_t bucketIndex(uint64_t ticks) {
+        if (ticks < (1u << SUB_BUCKET_BITS)) {
+            return static_cast<size_t>(ticks);
+        }
+        size_t msb = 63 - static_cast<size_t>(__builtin_clzll(ticks));
+        size_t sub = static_cast<size_t>(ticks >> (msb - SUB_BUCKET_BITS)) & ((1u << SUB_BUCKET_BITS) - 1);
+        return ((msb - SUB_BUCKET_BITS + 1) << SUB_BUCKET_BITS) + sub;
+    }
+
+    static uint64_t bucketUpperBound(size_t index) {
+        if (index < (1u << SUB_BUCKET_BITS)) {
+            return index;
+        }
+        size_t msb = (index >> SUB_BUCKET_BITS) + SUB_BUCKET_BITS - 1;
+        uint64_t sub = index & ((1u << SUB_BUCKET_BITS) - 1);
+        uint64_t base = uint64_t(1) << msb;
+        return base + ((sub + 1) << (msb - SUB_BUCKET_BITS)) - 1;
+    }
+
+    static double percentileTicks(const std::array<uint64_t, BUCKET_COUNT>& buckets, uint64_t count, double p) {
+        if (count == 0) {
+            return 0.0;
+        }
+        uint64_t rank = static_cast<uint64_t>(p * (count - 1)) + 1;
+        uint64_t seen = 0;
+        for (size_t b = 0; b < BUCKET_COUNT; ++b) {
+            seen += buckets[b];
+            if (seen >= rank) {
+                return static_cast<double>(bucketUpperBound(b));
+            }
+        }
+        return 0.0;
+    }
+
+    double calibrateNsPerTick() const {
+#if defined(__x86_64__) || defined(__i386__)
+        uint64_t ticks = readTicks() - m_originTicks;
+        double ns = std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - m_originTime).count();
+        return (ticks > 0 && ns > 0.0) ? ns / ticks : 1.0;
+#else
+        return 1.0;
+#endif
+    }
+
+    ThreadBlock& localBlock() {
+        thread_local ThreadBlock* block = nullptr;
+        if (!block) {
+            auto owned = std::make_unique<ThreadBlock>();
+            block = owned.get();
+            std::lock_guard<std::mutex> lock(m_blocksMutex);
+            m_blocks.push_back(std::move(owned));   // 스레드 종료 후에도 집계 유지
+        }
+        return *block;
+    }
+
+    std::atomic<bool> m_enabled;
+    uint64_t m_originTicks;
+    std::chrono::steady_clock::time_point m_originTime;
+
+    mutable std::mutex m_blocksMutex;
+    std::vector<std::unique_ptr<ThreadBlock>> m_blocks;
+};
+
+// =============================================================================
+// 구간 계측 RAII
+// =============================================================================
+
+class ScopedStageTimer {
+public:
+    explicit ScopedStageTimer(ProfileStage stage)
+        : m_stage(stage)
+        , m_start(StageProfiler::getInstance().isEnabled() ? StageProfiler::readTicks() : 0) {}
+
+    ~ScopedStageTimer() {
+        if (m_start != 0) {
+            StageProfiler::getInstance().record(m_stage, StageProfiler::readTicks() - m_start);
+        }
+    }
+
+    ScopedStageTimer(const ScopedStageTimer&) = delete;
+    ScopedStageTimer& operator=(const ScopedStageTimer&) = delete;
+
+private:
+    ProfileStage m_stage;
+    uint64_t m_start;
+};
+
+} // namespace WeaponControl
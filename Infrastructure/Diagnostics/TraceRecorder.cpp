@@ -0,0 +1,203 @@
+#include "TraceRecorder.h"
+#include "MemoryAccounting.h"
+#include <algorithm>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <set>
+
+namespace WeaponControl {
+
+// =============================================================================
+// TraceRecorder 구현
+// =============================================================================
+
+namespace {
+
+constexpr int THREAD_PROCESS_ID = 1;
+constexpr int TUBE_PROCESS_ID = 2;
+
+size_t roundUpToPowerOfTwo(size_t value) {
+    size_t result = 2;
+    while (result < value) {
+        result <<= 1;
+    }
+    return result;
+}
+
+void writeEscaped(std::ostream& out, const char* text) {
+    for (const char* p = text; *p; ++p) {
+        char c = *p;
+        if (c == '"' || c == '\\') {
+            out << '\\' << c;
+        } else if (static_cast<unsigned char>(c) < 0x20) {
+            out << ' ';
+        } else {
+            out << c;
+        }
+    }
+}
+
+void writeMetadata(std::ostream& out, bool& first, const char* kind, int pid, uint32_t tid, const std::string& name) {
+    out << (first ? "\n" : ",\n");
+    first = false;
+    out << "{\"name\":\"" << kind << "\",\"ph\":\"M\",\"pid\":" << pid << ",\"tid\":" << tid
+        << ",\"args\":{\"name\":\"";
+    writeEscaped(out, name.c_str());
+    out << "\"}}";
+}
+
+} // namespace
+
+void TraceRecorder::start(size_t eventsPerThread) {
+    m_enabled.store(false, std::memory_order_relaxed);
+    m_eventsPerThread.store(roundUpToPowerOfTwo(std::max<size_t>(eventsPerThread, 2)), std::memory_order_relaxed);
+
+    {
+        std::lock_guard<std::mutex> lock(m_buffersMutex);
+        for (auto& buffer : m_buffers) {
+            buffer->head.store(0, std::memory_order_relaxed);
+        }
+        m_originTicks.store(StageProfiler::readTicks(), std::memory_order_relaxed);
+        m_originTime = std::chrono::steady_clock::now();
+    }
+
+    m_enabled.store(true, std::memory_order_release);
+    std::cout << "Tracing started" << std::endl;
+}
+
+void TraceRecorder::stop() {
+    if (m_enabled.exchange(false, std::memory_order_acq_rel)) {
+        std::cout << "Tracing stopped: " << eventCount() << " events" << std::endl;
+    }
+}
+
+void TraceRecorder::setCurrentThreadName(const std::string& name) {
+    ThreadBuffer& buffer = localBuffer();
+    std::lock_guard<std::mutex> lock(m_buffersMutex);
+    buffer.threadName = name;
+}
+
+TraceRecorder::ThreadBuffer& TraceRecorder::localBuffer() {
+    thread_local ThreadBuffer* buffer = nullptr;
+    if (!buffer) {
+        auto owned = std::make_unique<ThreadBuffer>();
+        owned->threadId = m_nextThreadId.fetch_add(1, std::memory_order_relaxed);
+        owned->threadName = "thread " + std::to_string(owned->threadId);
+        owned->capacity = m_eventsPerThread.load(std::memory_order_relaxed);
+        owned->events.reset(new TraceEvent[owned->capacity]);
+        buffer = owned.get();
+        // 스레드 버퍼는 프로세스 종료까지 유지되므로 해제는 집계하지 않음
+        MemoryAccounting::getInstance().onAllocate(MemoryAccountId::LOGGING_BUFFERS,
+                                                   owned->capacity * sizeof(TraceEvent));
+
+        std::lock_guard<std::mutex> lock(m_buffersMutex);
+        m_buffers.push_back(std::move(owned));   // 스레드 종료 후에도 덤프 가능하도록 유지
+    }
+    return *buffer;
+}
+
+double TraceRecorder::calibrateNsPerTick() const {
+#if defined(__x86_64__) || defined(__i386__)
+    uint64_t ticks = StageProfiler::readTicks() - m_originTicks.load(std::memory_order_relaxed);
+    double ns = std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - m_originTime).count();
+    return (ticks > 0 && ns > 0.0) ? ns / ticks : 1.0;
+#else
+    return 1.0;
+#endif
+}
+
+uint64_t TraceRecorder::eventCount() const {
+    std::lock_guard<std::mutex> lock(m_buffersMutex);
+    uint64_t total = 0;
+    for (const auto& buffer : m_buffers) {
+        total += std::min<uint64_t>(buffer->head.load(std::memory_order_acquire), buffer->capacity);
+    }
+    return total;
+}
+
+uint64_t TraceRecorder::overwrittenCount() const {
+    std::lock_guard<std::mutex> lock(m_buffersMutex);
+    uint64_t total = 0;
+    for (const auto& buffer : m_buffers) {
+        uint64_t head = buffer->head.load(std::memory_order_acquire);
+        total += head > buffer->capacity ? head - buffer->capacity : 0;
+    }
+    return total;
+}
+
+Result<void> TraceRecorder::writeChromeTrace(const std::string& path) const {
+    std::ofstream out(path, std::ios::trunc);
+    if (!out.is_open()) {
+        return Result<void>::failure("Cannot open trace file for writing: " + path);
+    }
+
+    std::lock_guard<std::mutex> lock(m_buffersMutex);
+
+    double nsPerTick = calibrateNsPerTick();
+    uint64_t originTicks = m_originTicks.load(std::memory_order_relaxed);
+    std::set<uint16_t> tubeTracks;
+    std::vector<TraceEvent> events;
+    bool first = true;
+
+    out << "{\"displayTimeUnit\":\"ns\",\"traceEvents\":[";
+    writeMetadata(out, first, "process_name", THREAD_PROCESS_ID, 0, "Threads");
+    writeMetadata(out, first, "process_name", TUBE_PROCESS_ID, 0, "Launch tubes");
+    out << std::fixed << std::setprecision(3);
+
+    for (const auto& buffer : m_buffers) {
+        writeMetadata(out, first, "thread_name", THREAD_PROCESS_ID, buffer->threadId, buffer->threadName);
+
+        // 복사 중 덮어써진 이벤트는 복사 후 head 를 다시 읽어 제외
+        uint64_t head = buffer->head.load(std::memory_order_acquire);
+        uint64_t begin = head > buffer->capacity ? head - buffer->capacity : 0;
+        events.clear();
+        for (uint64_t i = begin; i < head; ++i) {
+            events.push_back(buffer->events[i & (buffer->capacity - 1)]);
+        }
+        uint64_t headAfter = buffer->head.load(std::memory_order_acquire);
+        uint64_t validFrom = headAfter > buffer->capacity ? headAfter - buffer->capacity : 0;
+        size_t skip = validFrom > begin ? static_cast<size_t>(std::min(validFrom - begin, head - begin)) : 0;
+
+        for (size_t i = skip; i < events.size(); ++i) {
+            const TraceEvent& event = events[i];
+            if (event.ticks < originTicks) {
+                continue;       // start() 이전 기록
+            }
+
+            bool tubeTrack = event.track == TraceTrack::TUBE;
+            if (tubeTrack) {
+                tubeTracks.insert(event.tubeNumber);
+            }
+
+            out << ",\n{\"name\":\"";
+            writeEscaped(out, event.name);
+            out << "\",\"cat\":\"" << TraceCategoryName(event.category)
+                << "\",\"ph\":\"" << event.phase
+                << "\",\"ts\":" << (event.ticks - originTicks) * nsPerTick / 1e3
+                << ",\"pid\":" << (tubeTrack ? TUBE_PROCESS_ID : THREAD_PROCESS_ID)
+                << ",\"tid\":" << (tubeTrack ? event.tubeNumber : buffer->threadId);
+            if (event.phase == 'i') {
+                out << ",\"s\":\"t\"";
+            }
+            if (!tubeTrack && event.tubeNumber != 0) {
+                out << ",\"args\":{\"tube\":" << event.tubeNumber << "}";
+            }
+            out << "}";
+        }
+    }
+
+    for (uint16_t tubeNumber : tubeTracks) {
+        writeMetadata(out, first, "thread_name", TUBE_PROCESS_ID, tubeNumber, "Tube " + std::to_string(tubeNumber));
+    }
+
+    out << "\n]}\n";
+    out.flush();
+    if (!out) {
+        return Result<void>::failure("Failed to write trace file: " + path);
+    }
+
+    return Result<void>::success();
+}
+
+} // namespace WeaponControl
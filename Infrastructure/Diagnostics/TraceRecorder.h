@@ -0,0 +1,218 @@
+#pragma once
+
+#include "StageProfiler.h"
+#include "../../Common/Types/CommonTypes.h"
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+namespace WeaponControl {
+
+// =============================================================================
+// 추적 이벤트 정의
+// =============================================================================
+
+enum class TraceCategory : uint8_t {
+    TICK = 0,       // 제어 주기
+    STATE,          // 무장 통제 상태
+    LAUNCH_STEP,    // 발사 단계
+    PLAN,           // 교전계획/궤적 계산
+    LOCK            // 잠금 대기 (경합 시에만)
+};
+
+inline const char* TraceCategoryName(TraceCategory category) {
+    switch (category) {
+        case TraceCategory::TICK: return "tick";
+        case TraceCategory::STATE: return "state";
+        case TraceCategory::LAUNCH_STEP: return "launch";
+        case TraceCategory::PLAN: return "plan";
+        case TraceCategory::LOCK: return "lock";
+        default: return "unknown";
+    }
+}
+
+// 이벤트 트랙: 기록한 스레드 또는 발사관별 타임라인
+enum class TraceTrack : uint8_t {
+    THREAD = 0,
+    TUBE
+};
+
+constexpr size_t TRACE_NAME_LENGTH = 51;
+
+struct TraceEvent {
+    uint64_t ticks;
+    uint16_t tubeNumber;            // 0 이면 발사관 무관
+    TraceCategory category;
+    TraceTrack track;
+    char phase;                     // 'B' 시작, 'E' 종료, 'i' 순간
+    char name[TRACE_NAME_LENGTH];
+};
+
+static_assert(sizeof(TraceEvent) == 64, "TraceEvent should occupy one cache line");
+
+// =============================================================================
+// 타임라인 추적기 - 스레드별 링 버퍼, Chrome trace JSON 출력
+//
+// 비활성 상태의 비용은 relaxed load 1회이다. 활성 시 각 스레드는 자신의
+// 링 버퍼에만 쓰며 (잠금 없음) 가득 차면 가장 오래된 이벤트를 덮어써
+// 최근 구간을 유지한다. writeChromeTrace() 는 stop() 이후 호출하는 것을
+// 권장하며, 기록 중 호출하면 덮어쓰기와 겹친 이벤트는 버린다.
+// 결과 파일은 chrome://tracing 또는 ui.perfetto.dev 에서 연다.
+// =============================================================================
+
+class TraceRecorder {
+public:
+    static TraceRecorder& getInstance() {
+        static TraceRecorder instance;
+        return instance;
+    }
+
+    bool isEnabled() const { return m_enabled.load(std::memory_order_relaxed); }
+
+    // 기존 이벤트를 지우고 기록 시작. 버퍼 크기는 스레드가 처음 기록할 때 결정된다.
+    void start(size_t eventsPerThread = DEFAULT_EVENTS_PER_THREAD);
+    void stop();
+
+    void begin(TraceCategory category, const char* name, uint16_t tubeNumber = 0,
+               TraceTrack track = TraceTrack::THREAD) {
+        push('B', category, name, tubeNumber, track, StageProfiler::readTicks());
+    }
+
+    void end(TraceCategory category, const char* name, uint16_t tubeNumber = 0,
+             TraceTrack track = TraceTrack::THREAD) {
+        push('E', category, name, tubeNumber, track, StageProfiler::readTicks());
+    }
+
+    void instant(TraceCategory category, const char* name, uint16_t tubeNumber = 0,
+                 TraceTrack track = TraceTrack::THREAD) {
+        push('i', category, name, tubeNumber, track, StageProfiler::readTicks());
+    }
+
+    // 이미 측정한 구간을 기록 (잠금 대기 등)
+    void complete(TraceCategory category, const char* name, uint64_t startTicks, uint64_t endTicks,
+                  uint16_t tubeNumber = 0) {
+        push('B', category, name, tubeNumber, TraceTrack::THREAD, startTicks);
+        push('E', category, name, tubeNumber, TraceTrack::THREAD, endTicks);
+    }
+
+    // 현재 스레드의 트랙 이름 지정
+    void setCurrentThreadName(const std::string& name);
+
+    Result<void> writeChromeTrace(const std::string& path) const;
+
+    uint64_t eventCount() const;
+    uint64_t overwrittenCount() const;
+
+    static constexpr size_t DEFAULT_EVENTS_PER_THREAD = 1 << 16;
+
+private:
+    struct ThreadBuffer {
+        uint32_t threadId;
+        std::string threadName;
+        size_t capacity;
+        std::unique_ptr<TraceEvent[]> events;
+        std::atomic<uint64_t> head{0};      // 누적 기록 수
+    };
+
+    TraceRecorder()
+        : m_enabled(false)
+        , m_eventsPerThread(DEFAULT_EVENTS_PER_THREAD)
+        , m_nextThreadId(1)
+        , m_originTicks(StageProfiler::readTicks())
+        , m_originTime(std::chrono::steady_clock::now()) {}
+
+    void push(char phase, TraceCategory category, const char* name, uint16_t tubeNumber,
+              TraceTrack track, uint64_t ticks) {
+        if (!isEnabled()) {
+            return;
+        }
+
+        ThreadBuffer& buffer = localBuffer();
+        uint64_t index = buffer.head.load(std::memory_order_relaxed);
+        TraceEvent& event = buffer.events[index & (buffer.capacity - 1)];
+        event.ticks = ticks;
+        event.tubeNumber = tubeNumber;
+        event.category = category;
+        event.track = track;
+        event.phase = phase;
+        std::strncpy(event.name, name, TRACE_NAME_LENGTH - 1);
+        event.name[TRACE_NAME_LENGTH - 1] = '\0';
+        buffer.head.store(index + 1, std::memory_order_release);
+    }
+
+    ThreadBuffer& localBuffer();
+    double calibrateNsPerTick() const;
+
+    std::atomic<bool> m_enabled;
+    std::atomic<size_t> m_eventsPerThread;
+    std::atomic<uint32_t> m_nextThreadId;
+    std::atomic<uint64_t> m_originTicks;
+    std::chrono::steady_clock::time_point m_originTime;
+
+    mutable std::mutex m_buffersMutex;
+    std::vector<std::unique_ptr<ThreadBuffer>> m_buffers;
+};
+
+// =============================================================================
+// 추적 구간 RAII
+// =============================================================================
+
+class ScopedTrace {
+public:
+    ScopedTrace(TraceCategory category, const char* name, uint16_t tubeNumber = 0,
+                TraceTrack track = TraceTrack::THREAD)
+        : m_category(category)
+        , m_name(name)
+        , m_tubeNumber(tubeNumber)
+        , m_track(track)
+        , m_active(TraceRecorder::getInstance().isEnabled())
+    {
+        if (m_active) {
+            TraceRecorder::getInstance().begin(m_category, m_name, m_tubeNumber, m_track);
+        }
+    }
+
+    ~ScopedTrace() {
+        if (m_active) {
+            TraceRecorder::getInstance().end(m_category, m_name, m_tubeNumber, m_track);
+        }
+    }
+
+    ScopedTrace(const ScopedTrace&) = delete;
+    ScopedTrace& operator=(const ScopedTrace&) = delete;
+
+private:
+    TraceCategory m_category;
+    const char* m_name;
+    uint16_t m_tubeNumber;
+    TraceTrack m_track;
+    bool m_active;
+};
+
+// =============================================================================
+// 잠금 획득 - 추적 중 경합이 발생하면 대기 구간을 기록
+// =============================================================================
+
+template <typename Lock>
+inline void lockTraced(Lock& lock, const char* name, uint16_t tubeNumber = 0) {
+    auto& tracer = TraceRecorder::getInstance();
+    if (!tracer.isEnabled()) {
+        lock.lock();
+        return;
+    }
+
+    if (lock.try_lock()) {
+        return;     // 경합 없음
+    }
+
+    uint64_t start = StageProfiler::readTicks();
+    lock.lock();
+    tracer.complete(TraceCategory::LOCK, name, start, StageProfiler::readTicks(), tubeNumber);
+}
+
+} // namespace WeaponControl
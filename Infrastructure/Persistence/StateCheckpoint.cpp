@@ -0,0 +1,493 @@
+#include "StateCheckpoint.h"
+#include <atomic>
+#include <cerrno>
+#include <filesystem>
+#include <iostream>
+#include <mutex>
+
+#ifdef __linux__
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace WeaponControl {
+
+namespace {
+
+using TargetIdType = std::remove_reference_t<decltype(std::declval<TRKMGR_SYSTEMTARGET_INFO&>().unTargetSystemID())>;
+
+constexpr size_t alignUp(size_t value, size_t alignment) {
+    return (value + alignment - 1) / alignment * alignment;
+}
+
+constexpr size_t TUBE_REGION_OFFSET = alignUp(sizeof(CheckpointFileHeader), 64);
+constexpr size_t SERVICE_RECORD_OFFSET = offsetof(CheckpointFileHeader, serviceHeader);
+constexpr size_t SERVICE_RECORD_SIZE = sizeof(CheckpointRecordHeader) + sizeof(CheckpointFileHeader::servicePayload);
+
+// FNV-1a
+uint64_t checksumOf(const uint8_t* data, size_t size) {
+    uint64_t hash = 1469598103934665603ull;
+    for (size_t i = 0; i < size; ++i) {
+        hash = (hash ^ data[i]) * 1099511628211ull;
+    }
+    return hash;
+}
+
+uint32_t targetSlotCountFor(size_t maxTargets) {
+    uint32_t slots = 1;
+    while (slots < maxTargets * 2) {
+        slots <<= 1;
+    }
+    return slots;
+}
+
+} // namespace
+
+// =============================================================================
+// StateCheckpoint 구현
+// =============================================================================
+
+StateCheckpoint::StateCheckpoint()
+    : m_base(nullptr)
+    , m_size(0)
+    , m_tubeCount(0)
+    , m_targetRegionOffset(0)
+    , m_targetSlotCount(0)
+    , m_maxTargets(0)
+    , m_targetCount(0)
+    , m_syncWrites(false)
+    , m_pageSize(4096)
+    , m_writeCounter(MetricsRegistry::getInstance().counter(
+          "state_checkpoint_writes_total", "State checkpoint record writes"))
+    , m_overflowCounter(MetricsRegistry::getInstance().counter(
+          "state_checkpoint_overflow_total", "State changes not checkpointed because a region was full"))
+{
+}
+
+StateCheckpoint::~StateCheckpoint() {
+    close();
+}
+
+Result<void> StateCheckpoint::open(const StateCheckpointConfig& config, uint16_t tubeCount) {
+    close();
+
+#ifdef __linux__
+    std::error_code error;
+    auto parent = std::filesystem::path(config.path).parent_path();
+    if (!parent.empty()) {
+        std::filesystem::create_directories(parent, error);
+    }
+
+    int fd = ::open(config.path.c_str(), O_RDWR | O_CREAT | O_CLOEXEC, 0644);
+    if (fd < 0) {
+        return Result<void>::failure("Cannot open state checkpoint: " + config.path + ": " + std::strerror(errno));
+    }
+
+    m_tubeCount = tubeCount;
+    m_maxTargets = config.maxTargets;
+    m_targetSlotCount = targetSlotCountFor(config.maxTargets);
+    m_targetRegionOffset = TUBE_REGION_OFFSET + static_cast<size_t>(tubeCount) * CHECKPOINT_TUBE_REGION_SIZE;
+    m_syncWrites = config.syncWrites;
+    m_pageSize = static_cast<size_t>(sysconf(_SC_PAGESIZE));
+
+    size_t expectedSize = alignUp(m_targetRegionOffset + m_targetSlotCount * CHECKPOINT_TARGET_RECORD_SIZE, m_pageSize);
+
+    struct stat info;
+    bool sizeMatches = fstat(fd, &info) == 0 && static_cast<size_t>(info.st_size) == expectedSize;
+    if (!sizeMatches) {
+        // 배치가 다르면 (발사관 수/표적 수 변경, 새 파일) 0 으로 채운 새 파일
+        if (ftruncate(fd, 0) != 0 || ftruncate(fd, static_cast<off_t>(expectedSize)) != 0) {
+            int truncateError = errno;
+            ::close(fd);
+            return Result<void>::failure("Cannot size state checkpoint: " + config.path + ": " + std::strerror(truncateError));
+        }
+    }
+
+    void* mapped = mmap(nullptr, expectedSize, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    int mapError = errno;
+    ::close(fd);
+    if (mapped == MAP_FAILED) {
+        return Result<void>::failure("Cannot map state checkpoint: " + config.path + ": " + std::strerror(mapError));
+    }
+
+    m_base = static_cast<uint8_t*>(mapped);
+    m_size = expectedSize;
+
+    CheckpointFileHeader header;
+    std::memcpy(&header, m_base, sizeof(header));
+    bool compatible = std::memcmp(header.magic, STATE_CHECKPOINT_MAGIC, sizeof(header.magic)) == 0
+                   && header.version == STATE_CHECKPOINT_VERSION
+                   && header.tubeCount == tubeCount
+                   && header.targetSlotCount == m_targetSlotCount;
+    if (!compatible) {
+        if (sizeMatches) {
+            std::memset(m_base, 0, m_size);
+        }
+        initializeFile();
+    }
+
+    // 사용 중인 표적 슬롯 수 (기록 중단된 슬롯도 ID 는 유효하므로 포함)
+    m_targetCount = 0;
+    for (size_t slot = 0; slot < m_targetSlotCount; ++slot) {
+        uint32_t sequence;
+        std::memcpy(&sequence, targetRecord(slot), sizeof(sequence));
+        if (sequence != 0) {
+            ++m_targetCount;
+        }
+    }
+
+    return Result<void>::success();
+#else
+    (void)config;
+    (void)tubeCount;
+    return Result<void>::failure("State checkpoint requires mmap support");
+#endif
+}
+
+void StateCheckpoint::close() {
+#ifdef __linux__
+    if (m_base) {
+        flush();
+        munmap(m_base, m_size);
+    }
+#endif
+    m_base = nullptr;
+    m_size = 0;
+}
+
+void StateCheckpoint::initializeFile() {
+    CheckpointFileHeader header{};
+    std::memcpy(header.magic, STATE_CHECKPOINT_MAGIC, sizeof(header.magic));
+    header.version = STATE_CHECKPOINT_VERSION;
+    header.tubeCount = m_tubeCount;
+    header.targetSlotCount = m_targetSlotCount;
+    std::memcpy(m_base, &header, sizeof(header));
+}
+
+void StateCheckpoint::reset() {
+    if (!isOpen()) {
+        return;
+    }
+
+    std::lock_guard<ProfiledMutex> lock(m_writeMutex);
+    std::memset(m_base, 0, m_size);
+    initializeFile();
+    m_targetCount = 0;
+    syncRange(m_base, m_size);
+}
+
+void StateCheckpoint::flush() {
+#ifdef __linux__
+    if (m_base) {
+        msync(m_base, m_size, MS_SYNC);
+    }
+#endif
+}
+
+// =============================================================================
+// 복원
+// =============================================================================
+
+CheckpointContents StateCheckpoint::load() const {
+    CheckpointContents contents;
+    if (!isOpen()) {
+        return contents;
+    }
+
+    std::lock_guard<ProfiledMutex> lock(m_writeMutex);
+    const uint8_t* payload = nullptr;
+    size_t payloadSize = 0;
+
+    // 서비스 레코드
+    switch (readRecord(m_base + SERVICE_RECORD_OFFSET, SERVICE_RECORD_SIZE, payload, payloadSize)) {
+        case RecordStatus::VALID: {
+            EventDecoder decoder(payload, payloadSize);
+            decodeField(decoder, contents.selectedPlanListNumber);
+            break;
+        }
+        case RecordStatus::TORN:
+            ++contents.discardedRecords;
+            break;
+        case RecordStatus::EMPTY:
+            break;
+    }
+
+    // 발사관 (상태 레코드가 있는 발사관만 할당된 것으로 봄)
+    for (uint16_t tubeNumber = 1; tubeNumber <= m_tubeCount; ++tubeNumber) {
+        auto status = readRecord(tubeStateRecord(tubeNumber), CHECKPOINT_TUBE_STATE_RECORD_SIZE, payload, payloadSize);
+        if (status != RecordStatus::VALID) {
+            contents.discardedRecords += status == RecordStatus::TORN ? 1 : 0;
+            continue;
+        }
+
+        CheckpointTubeState tube;
+        EventDecoder decoder(payload, payloadSize);
+        decode(decoder, tube.assignment);
+        decodeField(decoder, tube.state);
+        tube.launched = decoder.get<uint8_t>() != 0;
+        if (!decoder.ok() || tube.assignment.tubeNumber != tubeNumber) {
+            ++contents.discardedRecords;
+            continue;
+        }
+
+        status = readRecord(waypointRecord(tubeNumber), CHECKPOINT_WAYPOINT_RECORD_SIZE, payload, payloadSize);
+        if (status == RecordStatus::VALID) {
+            EventDecoder waypointDecoder(payload, payloadSize);
+            uint16_t count = waypointDecoder.get<uint16_t>();
+            tube.waypoints.resize(std::min<size_t>(count, CHECKPOINT_MAX_WAYPOINTS));
+            for (auto& wp : tube.waypoints) {
+                decode(waypointDecoder, wp);
+            }
+            tube.hasWaypoints = waypointDecoder.ok();
+            if (!tube.hasWaypoints) {
+                tube.waypoints.clear();
+                ++contents.discardedRecords;
+            }
+        } else if (status == RecordStatus::TORN) {
+            ++contents.discardedRecords;
+        }
+
+        contents.tubes.push_back(std::move(tube));
+    }
+
+    // 표적
+    contents.targets.reserve(m_targetCount);
+    for (size_t slot = 0; slot < m_targetSlotCount; ++slot) {
+        auto status = readRecord(targetRecord(slot), CHECKPOINT_TARGET_RECORD_SIZE, payload, payloadSize);
+        if (status == RecordStatus::VALID) {
+            TRKMGR_SYSTEMTARGET_INFO target;
+            EventDecoder decoder(payload, payloadSize);
+            decode(decoder, target);
+            if (decoder.ok()) {
+                contents.targets.push_back(target);
+                continue;
+            }
+        }
+        contents.discardedRecords += status != RecordStatus::EMPTY ? 1 : 0;
+    }
+
+    return contents;
+}
+
+// =============================================================================
+// 변경 기록
+// =============================================================================
+
+void StateCheckpoint::writeTubeState(const WeaponAssignmentRequest& assignment, EN_WPN_CTRL_STATE state, bool launched) {
+    if (!isOpen() || !isValidTube(assignment.tubeNumber)) {
+        return;
+    }
+
+    uint8_t payload[TUBE_STATE_PAYLOAD_CAPACITY];
+    EventEncoder encoder(payload, sizeof(payload));
+    encode(encoder, assignment);
+    encoder.put(state);
+    encoder.put(static_cast<uint8_t>(launched));
+
+    std::lock_guard<ProfiledMutex> lock(m_writeMutex);
+    writeRecord(tubeStateRecord(assignment.tubeNumber), payload, encoder.size());
+}
+
+void StateCheckpoint::updateTubeState(uint16_t tubeNumber, EN_WPN_CTRL_STATE state, bool launched) {
+    if (!isOpen() || !isValidTube(tubeNumber)) {
+        return;
+    }
+
+    std::lock_guard<ProfiledMutex> lock(m_writeMutex);
+    uint8_t* record = tubeStateRecord(tubeNumber);
+    const uint8_t* stored = nullptr;
+    size_t storedSize = 0;
+    if (readRecord(record, CHECKPOINT_TUBE_STATE_RECORD_SIZE, stored, storedSize) != RecordStatus::VALID
+        || storedSize < sizeof(state) + sizeof(uint8_t)) {
+        return;     // 할당 기록이 없는 발사관
+    }
+
+    // 할당 요청 부분은 그대로 두고 끝의 상태/발사 여부만 교체
+    uint8_t payload[TUBE_STATE_PAYLOAD_CAPACITY];
+    std::memcpy(payload, stored, storedSize);
+    uint8_t launchedByte = launched ? 1 : 0;
+    std::memcpy(payload + storedSize - sizeof(launchedByte) - sizeof(state), &state, sizeof(state));
+    std::memcpy(payload + storedSize - sizeof(launchedByte), &launchedByte, sizeof(launchedByte));
+    writeRecord(record, payload, storedSize);
+}
+
+void StateCheckpoint::writeWaypoints(uint16_t tubeNumber, const std::vector<ST_WEAPON_WAYPOINT>& waypoints) {
+    if (!isOpen() || !isValidTube(tubeNumber)) {
+        return;
+    }
+
+    std::lock_guard<ProfiledMutex> lock(m_writeMutex);
+    uint8_t* record = waypointRecord(tubeNumber);
+    if (waypoints.size() > CHECKPOINT_MAX_WAYPOINTS) {
+        // 일부만 복원하면 경로가 달라지므로 기록하지 않음 (복원 시 할당 계획 경로 사용)
+        eraseRecord(record);
+        m_overflowCounter.increment();
+        std::cout << "State checkpoint: tube " << tubeNumber << " has " << waypoints.size()
+                  << " waypoints (max " << CHECKPOINT_MAX_WAYPOINTS << "), not checkpointed" << std::endl;
+        return;
+    }
+
+    uint8_t payload[CHECKPOINT_WAYPOINT_RECORD_SIZE - sizeof(CheckpointRecordHeader)];
+    EventEncoder encoder(payload, sizeof(payload));
+    encoder.put(static_cast<uint16_t>(waypoints.size()));
+    for (const auto& wp : waypoints) {
+        encode(encoder, wp);
+    }
+    writeRecord(record, payload, encoder.size());
+}
+
+void StateCheckpoint::clearTube(uint16_t tubeNumber) {
+    if (!isOpen() || !isValidTube(tubeNumber)) {
+        return;
+    }
+
+    std::lock_guard<ProfiledMutex> lock(m_writeMutex);
+    eraseRecord(tubeStateRecord(tubeNumber));
+    eraseRecord(waypointRecord(tubeNumber));
+}
+
+void StateCheckpoint::writeTarget(const TRKMGR_SYSTEMTARGET_INFO& target) {
+    if (!isOpen()) {
+        return;
+    }
+
+    uint8_t payload[CHECKPOINT_TARGET_RECORD_SIZE - sizeof(CheckpointRecordHeader)];
+    EventEncoder encoder(payload, sizeof(payload));
+    encode(encoder, target);
+
+    std::lock_guard<ProfiledMutex> lock(m_writeMutex);
+    bool found = false;
+    size_t slot = findTargetSlot(target.unTargetSystemID(), found);
+    if (!found && (slot == NO_TARGET_SLOT || m_targetCount >= m_maxTargets)) {
+        m_overflowCounter.increment();
+        return;
+    }
+
+    writeRecord(targetRecord(slot), payload, encoder.size());
+    if (!found) {
+        ++m_targetCount;
+    }
+}
+
+void StateCheckpoint::writeSelectedPlanList(uint32_t planListNumber) {
+    if (!isOpen()) {
+        return;
+    }
+
+    uint8_t payload[sizeof(CheckpointFileHeader::servicePayload)];
+    EventEncoder encoder(payload, sizeof(payload));
+    encoder.put(planListNumber);
+
+    std::lock_guard<ProfiledMutex> lock(m_writeMutex);
+    writeRecord(m_base + SERVICE_RECORD_OFFSET, payload, encoder.size());
+}
+
+// =============================================================================
+// Private 메서드들
+// =============================================================================
+
+uint8_t* StateCheckpoint::tubeStateRecord(uint16_t tubeNumber) const {
+    return m_base + TUBE_REGION_OFFSET + static_cast<size_t>(tubeNumber - 1) * CHECKPOINT_TUBE_REGION_SIZE;
+}
+
+uint8_t* StateCheckpoint::waypointRecord(uint16_t tubeNumber) const {
+    return tubeStateRecord(tubeNumber) + CHECKPOINT_TUBE_STATE_RECORD_SIZE;
+}
+
+uint8_t* StateCheckpoint::targetRecord(size_t slot) const {
+    return m_base + m_targetRegionOffset + slot * CHECKPOINT_TARGET_RECORD_SIZE;
+}
+
+void StateCheckpoint::writeRecord(uint8_t* record, const uint8_t* payload, size_t payloadSize) {
+    CheckpointRecordHeader header;
+    std::memcpy(&header, record, sizeof(header));
+
+    // 1) 홀수 sequence 로 기록 중 표시 → 2) 페이로드 → 3) 크기/체크섬 → 4) 짝수 sequence
+    uint32_t writing = (header.sequence + 1) | 1u;
+    std::memcpy(record, &writing, sizeof(writing));
+    std::atomic_thread_fence(std::memory_order_release);
+
+    std::memcpy(record + sizeof(header), payload, payloadSize);
+    header.payloadSize = static_cast<uint16_t>(payloadSize);
+    header.flags = 0;
+    header.checksum = checksumOf(payload, payloadSize);
+    std::memcpy(record + sizeof(header.sequence), &header.payloadSize,
+                sizeof(header) - sizeof(header.sequence));
+    std::atomic_thread_fence(std::memory_order_release);
+
+    uint32_t complete = writing + 1;
+    std::memcpy(record, &complete, sizeof(complete));
+
+    syncRange(record, sizeof(header) + payloadSize);
+    m_writeCounter.increment();
+}
+
+void StateCheckpoint::eraseRecord(uint8_t* record) {
+    // sequence 0 = 빈 레코드 (4바이트 한 번으로 제거)
+    uint32_t empty = 0;
+    std::memcpy(record, &empty, sizeof(empty));
+    syncRange(record, sizeof(empty));
+    m_writeCounter.increment();
+}
+
+void StateCheckpoint::syncRange(const void* address, size_t size) {
+#ifdef __linux__
+    if (!m_syncWrites) {
+        return;
+    }
+
+    // 변경된 페이지만 비동기 반영
+    auto begin = reinterpret_cast<uintptr_t>(address) & ~(static_cast<uintptr_t>(m_pageSize) - 1);
+    auto end = reinterpret_cast<uintptr_t>(address) + size;
+    msync(reinterpret_cast<void*>(begin), end - begin, MS_ASYNC);
+#else
+    (void)address;
+    (void)size;
+#endif
+}
+
+StateCheckpoint::RecordStatus StateCheckpoint::readRecord(const uint8_t* record, size_t recordSize,
+                                                          const uint8_t*& payload, size_t& payloadSize) {
+    CheckpointRecordHeader header;
+    std::memcpy(&header, record, sizeof(header));
+
+    if (header.sequence == 0) {
+        return RecordStatus::EMPTY;
+    }
+    if ((header.sequence & 1u) != 0 || header.payloadSize > recordSize - sizeof(header)) {
+        return RecordStatus::TORN;
+    }
+
+    payload = record + sizeof(header);
+    payloadSize = header.payloadSize;
+    return checksumOf(payload, payloadSize) == header.checksum ? RecordStatus::VALID : RecordStatus::TORN;
+}
+
+size_t StateCheckpoint::findTargetSlot(uint32_t targetId, bool& found) const {
+    found = false;
+    size_t mask = m_targetSlotCount - 1;
+    size_t slot = (static_cast<uint64_t>(targetId) * 2654435761ull) & mask;
+
+    // 선형 탐사 (표적 ID 는 페이로드 첫 필드)
+    for (size_t probe = 0; probe < m_targetSlotCount; ++probe, slot = (slot + 1) & mask) {
+        const uint8_t* record = targetRecord(slot);
+        uint32_t sequence;
+        std::memcpy(&sequence, record, sizeof(sequence));
+        if (sequence == 0) {
+            return slot;
+        }
+
+        TargetIdType storedId;
+        std::memcpy(&storedId, record + sizeof(CheckpointRecordHeader), sizeof(storedId));
+        if (static_cast<uint32_t>(storedId) == targetId) {
+            found = true;
+            return slot;
+        }
+    }
+
+    return NO_TARGET_SLOT;
+}
+
+} // namespace WeaponControl
@@ -0,0 +1,177 @@
+#pragma once
+
+#include "../../Common/Types/CommonTypes.h"
+#include "../Diagnostics/LockProfiler.h"
+#include "../Diagnostics/MetricsRegistry.h"
+#include "../Recording/EventLog.h"
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace WeaponControl {
+
+// =============================================================================
+// 상태 체크포인트 설정 (SystemConfig::getStateCheckpointConfig 로 생성)
+// =============================================================================
+
+struct StateCheckpointConfig {
+    std::string path = "state/weapon_control.ckpt";
+    size_t maxTargets = 256;        // 표적 영역 크기 (초과분은 기록하지 않음)
+    bool syncWrites = false;        // 기록마다 변경 페이지 msync(MS_ASYNC)
+};
+
+// =============================================================================
+// 체크포인트 파일 형식
+//
+// [파일 헤더 64B] magic "WCCKPT01" | version | 발사관 수 | 표적 슬롯 수 | 서비스 레코드
+// [발사관 영역] 발사관마다 상태 레코드(128B) + 경로점 레코드(1024B)
+// [표적 영역] 표적 ID 기준 개방 주소 해시 (슬롯 64B, 슬롯 수는 2의 거듭제곱)
+//
+// 모든 레코드는 같은 헤더를 가진다. sequence 는 기록 시작 시 홀수, 완료 시
+// 짝수가 되므로 기록 도중 중단된 레코드는 홀수로 남고, checksum(FNV-1a)은
+// 페이지 일부만 디스크에 반영된 경우를 걸러낸다. 둘 중 하나라도 맞지 않는
+// 레코드는 복원하지 않는다. 페이로드는 EventLog.h 의 인코딩을 그대로 쓴다.
+// =============================================================================
+
+constexpr char STATE_CHECKPOINT_MAGIC[8] = {'W', 'C', 'C', 'K', 'P', 'T', '0', '1'};
+constexpr uint32_t STATE_CHECKPOINT_VERSION = 1;
+
+#pragma pack(push, 1)
+struct CheckpointRecordHeader {
+    uint32_t sequence;      // 기록 횟수 × 2 (홀수 = 기록 중)
+    uint16_t payloadSize;
+    uint16_t flags;
+    uint64_t checksum;
+};
+
+struct CheckpointFileHeader {
+    char magic[8];
+    uint32_t version;
+    uint16_t tubeCount;
+    uint16_t reserved;
+    uint32_t targetSlotCount;
+    uint32_t reserved2;
+    CheckpointRecordHeader serviceHeader;
+    uint8_t servicePayload[24];
+};
+#pragma pack(pop)
+
+static_assert(sizeof(CheckpointRecordHeader) == 16, "CheckpointRecordHeader must be 16 bytes");
+static_assert(sizeof(CheckpointFileHeader) == 64, "CheckpointFileHeader must be 64 bytes");
+
+constexpr size_t CHECKPOINT_TUBE_STATE_RECORD_SIZE = 128;
+constexpr size_t CHECKPOINT_WAYPOINT_RECORD_SIZE = 1024;
+constexpr size_t CHECKPOINT_TUBE_REGION_SIZE = CHECKPOINT_TUBE_STATE_RECORD_SIZE + CHECKPOINT_WAYPOINT_RECORD_SIZE;
+constexpr size_t CHECKPOINT_TARGET_RECORD_SIZE = 64;
+
+// 경로점 레코드: 개수(u16) + 경로점(위도/경도 f64, 깊이 f32)
+constexpr size_t CHECKPOINT_MAX_WAYPOINTS =
+    (CHECKPOINT_WAYPOINT_RECORD_SIZE - sizeof(CheckpointRecordHeader) - sizeof(uint16_t)) / 20;
+
+// =============================================================================
+// 복원 내용
+// =============================================================================
+
+struct CheckpointTubeState {
+    WeaponAssignmentRequest assignment;
+    EN_WPN_CTRL_STATE state = EN_WPN_CTRL_STATE::WPN_CTRL_STATE_OFF;
+    bool launched = false;
+    bool hasWaypoints = false;                  // 경로점 편집 이력이 있는 경우만
+    std::vector<ST_WEAPON_WAYPOINT> waypoints;
+};
+
+struct CheckpointContents {
+    uint32_t selectedPlanListNumber = 0;
+    std::vector<CheckpointTubeState> tubes;                 // 할당된 발사관 (번호 순)
+    std::vector<TRKMGR_SYSTEMTARGET_INFO> targets;
+    size_t discardedRecords = 0;                            // 기록 중단/체크섬 불일치로 버린 레코드
+};
+
+// =============================================================================
+// 상태 체크포인트
+//
+// 고정 배치의 파일을 MAP_SHARED 로 매핑해 두고, 상태가 바뀔 때 해당
+// 레코드(발사관 상태, 경로점, 표적 1개, 서비스)만 덮어쓴다. 기록은
+// 매핑된 메모리에 대한 복사이므로 시스템 호출과 힙 할당이 없고, 프로세스가
+// 비정상 종료되어도 페이지 캐시에 남은 내용으로 복원할 수 있다. 전원
+// 차단까지 대비하려면 syncWrites 로 변경 페이지를 비동기 반영하거나
+// flush() 를 호출한다. 기록 함수는 여러 스레드에서 호출할 수 있다.
+// =============================================================================
+
+class StateCheckpoint {
+public:
+    StateCheckpoint();
+    ~StateCheckpoint();
+
+    StateCheckpoint(const StateCheckpoint&) = delete;
+    StateCheckpoint& operator=(const StateCheckpoint&) = delete;
+
+    // 파일을 열어 매핑 (없거나 형식/크기가 다르면 빈 체크포인트로 초기화)
+    Result<void> open(const StateCheckpointConfig& config, uint16_t tubeCount);
+    void close();   // flush 후 매핑 해제
+
+    bool isOpen() const { return m_base != nullptr; }
+
+    // 유효한 레코드 읽기 (open 직후 복원용)
+    CheckpointContents load() const;
+
+    // 전체 초기화 (복원 후 정규화된 상태를 다시 기록하기 전)
+    void reset();
+
+    // ==========================================================================
+    // 변경 기록 (해당 레코드만 갱신)
+    // ==========================================================================
+    void writeTubeState(const WeaponAssignmentRequest& assignment, EN_WPN_CTRL_STATE state, bool launched);
+    void updateTubeState(uint16_t tubeNumber, EN_WPN_CTRL_STATE state, bool launched);
+    void writeWaypoints(uint16_t tubeNumber, const std::vector<ST_WEAPON_WAYPOINT>& waypoints);
+    void clearTube(uint16_t tubeNumber);
+    void writeTarget(const TRKMGR_SYSTEMTARGET_INFO& target);
+    void writeSelectedPlanList(uint32_t planListNumber);
+
+    // 매핑 전체를 디스크에 동기 반영
+    void flush();
+
+    size_t fileSize() const { return m_size; }
+    uint64_t writeCount() const { return m_writeCounter.value(); }
+
+private:
+    // 발사관 상태 레코드 페이로드 (할당 요청 인코딩 + 상태 + 발사 여부)
+    static constexpr size_t TUBE_STATE_PAYLOAD_CAPACITY = CHECKPOINT_TUBE_STATE_RECORD_SIZE - sizeof(CheckpointRecordHeader);
+
+    uint8_t* tubeStateRecord(uint16_t tubeNumber) const;
+    uint8_t* waypointRecord(uint16_t tubeNumber) const;
+    uint8_t* targetRecord(size_t slot) const;
+    bool isValidTube(uint16_t tubeNumber) const { return tubeNumber >= 1 && tubeNumber <= m_tubeCount; }
+
+    // m_writeMutex 를 보유한 상태에서 호출
+    void writeRecord(uint8_t* record, const uint8_t* payload, size_t payloadSize);
+    void eraseRecord(uint8_t* record);
+    void syncRange(const void* address, size_t size);
+
+    enum class RecordStatus : uint8_t { EMPTY, VALID, TORN };
+
+    // 레코드가 완결되어 있으면 페이로드 위치/크기 반환
+    static RecordStatus readRecord(const uint8_t* record, size_t recordSize, const uint8_t*& payload, size_t& payloadSize);
+
+    void initializeFile();
+    static constexpr size_t NO_TARGET_SLOT = static_cast<size_t>(-1);
+    size_t findTargetSlot(uint32_t targetId, bool& found) const;    // 같은 ID 슬롯 또는 빈 슬롯
+
+    uint8_t* m_base;
+    size_t m_size;
+    uint16_t m_tubeCount;
+    size_t m_targetRegionOffset;
+    uint32_t m_targetSlotCount;     // 2의 거듭제곱, 최대 표적 수의 2배 이상
+    size_t m_maxTargets;
+    size_t m_targetCount;           // 사용 중인 표적 슬롯
+    bool m_syncWrites;
+    size_t m_pageSize;
+
+    mutable ProfiledMutex m_writeMutex{"StateCheckpoint::m_writeMutex"};
+
+    MetricCounter& m_writeCounter;
+    MetricCounter& m_overflowCounter;   // 표적 영역 초과, 경로점 수 초과
+};
+
+} // namespace WeaponControl
@@ -0,0 +1,370 @@
+#include "StatusDeltaPublisher.h"
+#include <algorithm>
+#include <cstring>
+#include <utility>
+
+namespace WeaponControl {
+
+namespace {
+
+template<typename T>
+bool sameValue(const T& a, const T& b) {
+    return std::memcmp(&a, &b, sizeof(T)) == 0;
+}
+
+bool samePosition(const ST_3D_GEODETIC_POSITION& a, const ST_3D_GEODETIC_POSITION& b) {
+    return sameValue(a.dLatitude(), b.dLatitude())
+        && sameValue(a.dLongitude(), b.dLongitude())
+        && sameValue(a.fDepth(), b.fDepth());
+}
+
+bool sameWaypoint(const ST_WEAPON_WAYPOINT& a, const ST_WEAPON_WAYPOINT& b) {
+    return sameValue(a.dLatitude(), b.dLatitude())
+        && sameValue(a.dLongitude(), b.dLongitude())
+        && sameValue(a.fDepth(), b.fDepth());
+}
+
+constexpr size_t POSITION_BYTES = sizeof(std::declval<ST_3D_GEODETIC_POSITION&>().dLatitude())
+                                + sizeof(std::declval<ST_3D_GEODETIC_POSITION&>().dLongitude())
+                                + sizeof(std::declval<ST_3D_GEODETIC_POSITION&>().fDepth());
+constexpr size_t WAYPOINT_BYTES = sizeof(std::declval<ST_WEAPON_WAYPOINT&>().dLatitude())
+                                + sizeof(std::declval<ST_WEAPON_WAYPOINT&>().dLongitude())
+                                + sizeof(std::declval<ST_WEAPON_WAYPOINT&>().fDepth());
+constexpr size_t STATUS_BYTES = 3 + sizeof(EN_WPN_KIND) + sizeof(EN_WPN_CTRL_STATE);
+constexpr size_t PLAN_BYTES = sizeof(EN_WPN_KIND) + 1 + 3 * sizeof(float) + sizeof(uint32_t);
+
+// 필드 개수 상한 (u16)
+size_t clampCount(size_t count) {
+    return std::min<size_t>(count, UINT16_MAX);
+}
+
+} // namespace
+
+// =============================================================================
+// StatusDeltaPublisher 구현
+// =============================================================================
+
+StatusDeltaPublisher::StatusDeltaPublisher(const StatusDeltaConfig& config)
+    : m_config(config)
+    , m_sequence(0)
+    , m_reportsSinceKeyframe(0)
+    , m_keyframeRequested(true)
+    , m_frames(0)
+    , m_keyframes(0)
+    , m_bytes(0)
+    , m_fullBytes(0)
+    , m_keyframeBytesCounter(MetricsRegistry::getInstance().counter(
+          "status_publication_bytes_total", "Encoded status/engagement publication bytes by frame kind", "kind=\"keyframe\""))
+    , m_deltaBytesCounter(MetricsRegistry::getInstance().counter(
+          "status_publication_bytes_total", "Encoded status/engagement publication bytes by frame kind", "kind=\"delta\""))
+    , m_fullBytesCounter(MetricsRegistry::getInstance().counter(
+          "status_publication_full_bytes_total", "Bytes a full frame every report interval would have taken"))
+{
+    if (m_config.keyframeInterval == 0) {
+        m_config.keyframeInterval = 1;
+    }
+}
+
+size_t StatusDeltaPublisher::fullFrameSize(const std::vector<EngagementPlanResult>& results) {
+    size_t size = sizeof(StatusFrameHeader);
+    for (const auto& result : results) {
+        size += sizeof(StatusTubeRecordHeader) + STATUS_BYTES + PLAN_BYTES + 3 * POSITION_BYTES
+              + 3 * sizeof(uint16_t) + clampCount(result.trajectory.size()) * POSITION_BYTES
+              + sizeof(uint16_t) + clampCount(result.waypoints.size()) * WAYPOINT_BYTES;
+    }
+    return size;
+}
+
+void StatusDeltaPublisher::reserveFrame(size_t size) {
+    // 가장 큰 키프레임 크기로만 늘림 (변경분 프레임은 키프레임보다 작음)
+    if (m_frame.size() < size) {
+        m_frame.resize(size);
+    }
+}
+
+StatusFrame StatusDeltaPublisher::publish(uint64_t epoch, const std::vector<LaunchTubeStatus>& tubes,
+                                          const std::vector<EngagementPlanResult>& results) {
+    size_t tubeCount = std::min(tubes.size(), results.size());
+    bool keyframe = m_keyframeRequested
+                 || tubeCount != m_lastTubes.size()
+                 || m_reportsSinceKeyframe + 1 >= m_config.keyframeInterval;
+
+    size_t fullSize = fullFrameSize(results);
+    m_fullBytes += fullSize;
+    m_fullBytesCounter.increment(fullSize);
+    reserveFrame(fullSize);
+
+    if (tubeCount != m_lastTubes.size()) {
+        m_lastTubes.assign(tubeCount, LaunchTubeStatus());
+        m_lastResults.resize(tubeCount);
+        m_versions.assign(tubeCount, 0);
+    }
+
+    StatusFrameHeader header{};
+    header.version = STATUS_DELTA_VERSION;
+    header.type = static_cast<uint8_t>(keyframe ? StatusFrameType::KEYFRAME : StatusFrameType::DELTA);
+    header.sequence = m_sequence + 1;
+    header.baseSequence = keyframe ? 0 : m_sequence;
+    header.epoch = epoch;
+    header.tubeCount = static_cast<uint16_t>(tubeCount);
+
+    EventEncoder encoder(m_frame.data(), m_frame.size());
+    encoder.putBytes(&header, sizeof(header));
+
+    uint16_t records = 0;
+    for (size_t i = 0; i < tubeCount; ++i) {
+        size_t trajectoryBegin = 0;
+        size_t trajectoryEnd = 0;
+        uint16_t changed = diffTube(i, tubes[i], results[i], trajectoryBegin, trajectoryEnd);
+        if (changed != 0) {
+            ++m_versions[i];
+        }
+        if (keyframe) {
+            trajectoryBegin = 0;
+            trajectoryEnd = clampCount(results[i].trajectory.size());
+        }
+
+        uint16_t mask = keyframe ? static_cast<uint16_t>(STATUS_FIELD_ALL) : changed;
+        if (mask == 0) {
+            continue;
+        }
+
+        encodeTube(encoder, i, mask, tubes[i], results[i], trajectoryBegin, trajectoryEnd);
+        if (changed != 0) {
+            m_lastTubes[i] = tubes[i];
+            m_lastResults[i] = results[i];      // 원소 대입 (궤적/경로점 용량 재사용)
+        }
+        ++records;
+    }
+
+    ++m_reportsSinceKeyframe;
+    if (!keyframe && records == 0) {
+        return StatusFrame{};
+    }
+
+    header.recordCount = records;
+    std::memcpy(m_frame.data(), &header, sizeof(header));
+
+    m_sequence = header.sequence;
+    ++m_frames;
+    m_bytes += encoder.size();
+    if (keyframe) {
+        ++m_keyframes;
+        m_keyframeRequested = false;
+        m_reportsSinceKeyframe = 0;
+        m_keyframeBytesCounter.increment(encoder.size());
+    } else {
+        m_deltaBytesCounter.increment(encoder.size());
+    }
+
+    return StatusFrame{m_frame.data(), encoder.size(), keyframe};
+}
+
+uint16_t StatusDeltaPublisher::diffTube(size_t index, const LaunchTubeStatus& status, const EngagementPlanResult& result,
+                                        size_t& trajectoryBegin, size_t& trajectoryEnd) const {
+    const auto& lastStatus = m_lastTubes[index];
+    const auto& last = m_lastResults[index];
+    uint16_t mask = 0;
+
+    if (status.hasWeapon != lastStatus.hasWeapon || status.weaponKind != lastStatus.weaponKind
+        || status.weaponState != lastStatus.weaponState || status.launched != lastStatus.launched
+        || status.engagementPlanValid != lastStatus.engagementPlanValid) {
+        mask |= STATUS_FIELD_STATUS;
+    }
+
+    if (result.weaponKind != last.weaponKind || result.isValid != last.isValid
+        || !sameValue(result.totalTime_sec, last.totalTime_sec)
+        || !sameValue(result.timeToTarget_sec, last.timeToTarget_sec)
+        || result.nextWaypointIndex != last.nextWaypointIndex
+        || !sameValue(result.timeToNextWaypoint_sec, last.timeToNextWaypoint_sec)) {
+        mask |= STATUS_FIELD_PLAN;
+    }
+
+    if (!samePosition(result.currentPosition, last.currentPosition)) {
+        mask |= STATUS_FIELD_POSITION;
+    }
+
+    if (!samePosition(result.launchPosition, last.launchPosition)
+        || !samePosition(result.targetPosition, last.targetPosition)) {
+        mask |= STATUS_FIELD_ENDPOINTS;
+    }
+
+    // 궤적: 앞뒤에서 같은 구간을 제외한 바뀐 구간 (길이가 줄면 잘라냄)
+    size_t size = clampCount(result.trajectory.size());
+    size_t lastSize = clampCount(last.trajectory.size());
+    size_t common = std::min(size, lastSize);
+    size_t begin = 0;
+    while (begin < common && samePosition(result.trajectory[begin], last.trajectory[begin])) {
+        ++begin;
+    }
+    size_t end = size;
+    if (size <= lastSize) {
+        end = common;
+        while (end > begin && samePosition(result.trajectory[end - 1], last.trajectory[end - 1])) {
+            --end;
+        }
+    }
+    if (begin < end || size != lastSize) {
+        mask |= STATUS_FIELD_TRAJECTORY;
+        trajectoryBegin = begin < end ? begin : size;
+        trajectoryEnd = begin < end ? end : size;
+    }
+
+    bool waypointsChanged = result.waypoints.size() != last.waypoints.size();
+    for (size_t i = 0; !waypointsChanged && i < result.waypoints.size(); ++i) {
+        waypointsChanged = !sameWaypoint(result.waypoints[i], last.waypoints[i]);
+    }
+    if (waypointsChanged) {
+        mask |= STATUS_FIELD_WAYPOINTS;
+    }
+
+    return mask;
+}
+
+void StatusDeltaPublisher::encodeTube(EventEncoder& encoder, size_t index, uint16_t mask, const LaunchTubeStatus& status,
+                                      const EngagementPlanResult& result, size_t trajectoryBegin, size_t trajectoryEnd) {
+    StatusTubeRecordHeader record{};
+    record.tubeNumber = status.tubeNumber;
+    record.fieldMask = mask;
+    record.version = m_versions[index];
+    encoder.putBytes(&record, sizeof(record));
+
+    if (mask & STATUS_FIELD_STATUS) {
+        encoder.put(static_cast<uint8_t>(status.hasWeapon));
+        encoder.put(status.weaponKind);
+        encoder.put(status.weaponState);
+        encoder.put(static_cast<uint8_t>(status.launched));
+        encoder.put(static_cast<uint8_t>(status.engagementPlanValid));
+    }
+    if (mask & STATUS_FIELD_PLAN) {
+        encoder.put(result.weaponKind);
+        encoder.put(static_cast<uint8_t>(result.isValid));
+        encoder.put(result.totalTime_sec);
+        encoder.put(result.timeToTarget_sec);
+        encoder.put(result.nextWaypointIndex);
+        encoder.put(result.timeToNextWaypoint_sec);
+    }
+    if (mask & STATUS_FIELD_POSITION) {
+        encode(encoder, result.currentPosition);
+    }
+    if (mask & STATUS_FIELD_ENDPOINTS) {
+        encode(encoder, result.launchPosition);
+        encode(encoder, result.targetPosition);
+    }
+    if (mask & STATUS_FIELD_TRAJECTORY) {
+        encoder.put(static_cast<uint16_t>(clampCount(result.trajectory.size())));
+        encoder.put(static_cast<uint16_t>(trajectoryBegin));
+        encoder.put(static_cast<uint16_t>(trajectoryEnd - trajectoryBegin));
+        for (size_t i = trajectoryBegin; i < trajectoryEnd; ++i) {
+            encode(encoder, result.trajectory[i]);
+        }
+    }
+    if (mask & STATUS_FIELD_WAYPOINTS) {
+        size_t count = clampCount(result.waypoints.size());
+        encoder.put(static_cast<uint16_t>(count));
+        for (size_t i = 0; i < count; ++i) {
+            encode(encoder, result.waypoints[i]);
+        }
+    }
+}
+
+// =============================================================================
+// StatusDeltaReceiver 구현
+// =============================================================================
+
+Result<void> StatusDeltaReceiver::apply(const uint8_t* data, size_t size) {
+    StatusFrameHeader header;
+    if (size < sizeof(header)) {
+        return Result<void>::failure("Status frame too short");
+    }
+    std::memcpy(&header, data, sizeof(header));
+    if (header.version != STATUS_DELTA_VERSION) {
+        return Result<void>::failure("Unsupported status frame version " + std::to_string(header.version));
+    }
+
+    bool keyframe = header.type == static_cast<uint8_t>(StatusFrameType::KEYFRAME);
+    if (!keyframe && (!m_synchronized || header.baseSequence != m_sequence)) {
+        m_synchronized = false;
+        return Result<void>::failure("Missed status frame " + std::to_string(m_sequence + 1) + ", waiting for keyframe");
+    }
+
+    if (keyframe) {
+        m_tubes.assign(header.tubeCount, LaunchTubeStatus());
+        m_results.resize(header.tubeCount);
+        m_versions.assign(header.tubeCount, 0);
+    }
+
+    EventDecoder decoder(data + sizeof(header), size - sizeof(header));
+    for (uint16_t i = 0; i < header.recordCount; ++i) {
+        StatusTubeRecordHeader record;
+        decoder.getBytes(&record, sizeof(record));
+        if (!decoder.ok() || !decodeTube(decoder, record)) {
+            m_synchronized = false;
+            return Result<void>::failure("Malformed status frame " + std::to_string(header.sequence));
+        }
+    }
+
+    m_sequence = header.sequence;
+    m_epoch = header.epoch;
+    m_synchronized = true;
+    return Result<void>::success();
+}
+
+bool StatusDeltaReceiver::decodeTube(EventDecoder& decoder, const StatusTubeRecordHeader& record) {
+    if (record.tubeNumber == 0 || record.tubeNumber > m_tubes.size()) {
+        return false;
+    }
+
+    size_t index = record.tubeNumber - 1;
+    auto& status = m_tubes[index];
+    auto& result = m_results[index];
+    status.tubeNumber = record.tubeNumber;
+    result.tubeNumber = record.tubeNumber;
+    m_versions[index] = record.version;
+
+    if (record.fieldMask & STATUS_FIELD_STATUS) {
+        status.hasWeapon = decoder.get<uint8_t>() != 0;
+        decodeField(decoder, status.weaponKind);
+        decodeField(decoder, status.weaponState);
+        status.launched = decoder.get<uint8_t>() != 0;
+        status.engagementPlanValid = decoder.get<uint8_t>() != 0;
+    }
+    if (record.fieldMask & STATUS_FIELD_PLAN) {
+        decodeField(decoder, result.weaponKind);
+        result.isValid = decoder.get<uint8_t>() != 0;
+        decodeField(decoder, result.totalTime_sec);
+        decodeField(decoder, result.timeToTarget_sec);
+        decodeField(decoder, result.nextWaypointIndex);
+        decodeField(decoder, result.timeToNextWaypoint_sec);
+    }
+    if (record.fieldMask & STATUS_FIELD_POSITION) {
+        decode(decoder, result.currentPosition);
+    }
+    if (record.fieldMask & STATUS_FIELD_ENDPOINTS) {
+        decode(decoder, result.launchPosition);
+        decode(decoder, result.targetPosition);
+    }
+    if (record.fieldMask & STATUS_FIELD_TRAJECTORY) {
+        uint16_t total = decoder.get<uint16_t>();
+        uint16_t begin = decoder.get<uint16_t>();
+        uint16_t count = decoder.get<uint16_t>();
+        if (static_cast<size_t>(begin) + count > total) {
+            return false;
+        }
+        result.trajectory.resize(total);
+        for (uint16_t i = 0; i < count; ++i) {
+            decode(decoder, result.trajectory[begin + i]);
+        }
+    }
+    if (record.fieldMask & STATUS_FIELD_WAYPOINTS) {
+        uint16_t count = decoder.get<uint16_t>();
+        result.waypoints.resize(count);
+        for (auto& waypoint : result.waypoints) {
+            decode(decoder, waypoint);
+        }
+    }
+
+    return decoder.ok();
+}
+
+} // namespace WeaponControl
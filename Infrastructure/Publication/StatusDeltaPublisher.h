@@ -0,0 +1,165 @@
+#pragma once
+
+#include "../../Common/Types/CommonTypes.h"
+#include "../Diagnostics/MetricsRegistry.h"
+#include "../Recording/EventLog.h"
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace WeaponControl {
+
+// =============================================================================
+// 상태/교전계획 변경분 게시 설정
+// =============================================================================
+
+struct StatusDeltaConfig {
+    uint32_t keyframeInterval = 50;     // 보고 주기 N 회마다 전체 프레임 (늦게 참여한 수신 측 동기화)
+};
+
+// =============================================================================
+// 변경분 프레임 형식
+//
+// [프레임 헤더 24B] version | 종류 | sequence | baseSequence | epoch | 발사관 수 | 레코드 수
+// [발사관 레코드] 발사관 번호 | 필드 마스크 | 발사관 버전 + 마스크 순서의 필드
+//
+// 키프레임은 모든 발사관의 모든 필드를 담고, 변경분 프레임은 직전 프레임
+// (baseSequence) 이후 내용이 바뀐 발사관의 바뀐 필드만 담는다. 궤적은 바뀐
+// 구간 [begin, begin + count) 만 보내고 전체 길이로 잘라낸다. 변경이 없는
+// 보고 주기에는 프레임을 만들지 않으므로 sequence 는 보낸 프레임끼리 연속이다.
+// 페이로드 인코딩은 EventLog.h 와 같다 (호스트 바이트 순서).
+// =============================================================================
+
+constexpr uint16_t STATUS_DELTA_VERSION = 1;
+
+enum class StatusFrameType : uint8_t {
+    KEYFRAME = 1,
+    DELTA
+};
+
+enum StatusDeltaField : uint16_t {
+    STATUS_FIELD_STATUS = 1 << 0,           // 할당/무장 종류/상태/발사 여부/계획 유효
+    STATUS_FIELD_PLAN = 1 << 1,             // 계획 유효, 비행/잔여 시간, 다음 경로점
+    STATUS_FIELD_POSITION = 1 << 2,         // 현재 위치
+    STATUS_FIELD_ENDPOINTS = 1 << 3,        // 발사/표적 위치
+    STATUS_FIELD_TRAJECTORY = 1 << 4,       // 궤적 (바뀐 구간)
+    STATUS_FIELD_WAYPOINTS = 1 << 5,        // 경로점 (전체)
+    STATUS_FIELD_ALL = 0x3F
+};
+
+#pragma pack(push, 1)
+struct StatusFrameHeader {
+    uint16_t version;
+    uint8_t type;
+    uint8_t reserved;
+    uint32_t sequence;
+    uint32_t baseSequence;  // 변경분이 적용되는 직전 프레임 (키프레임은 0)
+    uint64_t epoch;         // 원본 시스템 스냅샷 순번
+    uint16_t tubeCount;
+    uint16_t recordCount;
+};
+
+struct StatusTubeRecordHeader {
+    uint16_t tubeNumber;
+    uint16_t fieldMask;
+    uint32_t version;       // 발사관 내용이 바뀔 때마다 1 증가
+};
+#pragma pack(pop)
+
+static_assert(sizeof(StatusFrameHeader) == 24, "StatusFrameHeader must be 24 bytes");
+static_assert(sizeof(StatusTubeRecordHeader) == 8, "StatusTubeRecordHeader must be 8 bytes");
+
+// 작성된 프레임 (게시기 내부 버퍼, 다음 publish 까지 유효)
+struct StatusFrame {
+    const uint8_t* data = nullptr;
+    size_t size = 0;
+    bool keyframe = false;
+
+    bool empty() const { return size == 0; }
+};
+
+// =============================================================================
+// 변경분 게시기
+//
+// 보고 주기마다 전체 발사관 상태와 교전계획 결과(SystemSnapshot 의 tubes /
+// engagementResults, 인덱스 = 발사관 번호 - 1)를 받아 직전 게시 내용과
+// 비교하고 프레임을 만든다. 프레임 버퍼와 비교 기준은 재사용하므로 정상
+// 상태 게시에 할당이 없다. 한 스레드(보고 주기)에서만 호출한다.
+// =============================================================================
+
+class StatusDeltaPublisher {
+public:
+    explicit StatusDeltaPublisher(const StatusDeltaConfig& config = StatusDeltaConfig());
+
+    // 프레임 작성 (보낼 내용이 없으면 빈 프레임)
+    StatusFrame publish(uint64_t epoch, const std::vector<LaunchTubeStatus>& tubes,
+                        const std::vector<EngagementPlanResult>& results);
+
+    // 다음 publish 를 키프레임으로 (새 수신 측 참여, 수신 측 재동기화 요청)
+    void requestKeyframe() { m_keyframeRequested = true; }
+
+    const std::vector<uint32_t>& tubeVersions() const { return m_versions; }
+
+    // 누적 통계 (fullBytes: 보고 주기마다 키프레임을 보냈을 때의 바이트)
+    uint64_t frames() const { return m_frames; }
+    uint64_t keyframes() const { return m_keyframes; }
+    uint64_t bytes() const { return m_bytes; }
+    uint64_t fullBytes() const { return m_fullBytes; }
+
+    static size_t fullFrameSize(const std::vector<EngagementPlanResult>& results);
+
+private:
+    uint16_t diffTube(size_t index, const LaunchTubeStatus& status, const EngagementPlanResult& result,
+                      size_t& trajectoryBegin, size_t& trajectoryEnd) const;
+    void encodeTube(EventEncoder& encoder, size_t index, uint16_t mask, const LaunchTubeStatus& status,
+                    const EngagementPlanResult& result, size_t trajectoryBegin, size_t trajectoryEnd);
+    void reserveFrame(size_t size);
+
+    StatusDeltaConfig m_config;
+    std::vector<uint8_t> m_frame;
+    std::vector<LaunchTubeStatus> m_lastTubes;
+    std::vector<EngagementPlanResult> m_lastResults;
+    std::vector<uint32_t> m_versions;
+    uint32_t m_sequence;
+    uint32_t m_reportsSinceKeyframe;
+    bool m_keyframeRequested;
+
+    uint64_t m_frames;
+    uint64_t m_keyframes;
+    uint64_t m_bytes;
+    uint64_t m_fullBytes;
+
+    MetricCounter& m_keyframeBytesCounter;
+    MetricCounter& m_deltaBytesCounter;
+    MetricCounter& m_fullBytesCounter;
+};
+
+// =============================================================================
+// 변경분 수신기
+//
+// 키프레임으로 동기화한 뒤 연속된 변경분 프레임을 적용한다. 프레임을 놓치면
+// (baseSequence 불일치) 다음 키프레임까지 비동기 상태로 두고 실패를 반환한다.
+// =============================================================================
+
+class StatusDeltaReceiver {
+public:
+    Result<void> apply(const uint8_t* data, size_t size);
+
+    bool isSynchronized() const { return m_synchronized; }
+    uint64_t epoch() const { return m_epoch; }
+    const std::vector<LaunchTubeStatus>& tubes() const { return m_tubes; }
+    const std::vector<EngagementPlanResult>& results() const { return m_results; }
+    const std::vector<uint32_t>& tubeVersions() const { return m_versions; }
+
+private:
+    bool decodeTube(EventDecoder& decoder, const StatusTubeRecordHeader& record);
+
+    std::vector<LaunchTubeStatus> m_tubes;
+    std::vector<EngagementPlanResult> m_results;
+    std::vector<uint32_t> m_versions;
+    uint32_t m_sequence = 0;
+    uint64_t m_epoch = 0;
+    bool m_synchronized = false;
+};
+
+} // namespace WeaponControl
@@ -0,0 +1,81 @@
+#pragma once
+
+#include <cstddef>
+#include <iterator>
+#include <utility>
+#include <vector>
+
+namespace WeaponControl {
+
+// =============================================================================
+// std::map 노드 예비 보관소
+//
+// 실시간 모드에서 키가 늘어나는 맵(표적 저장소 등)의 노드를 초기화 시
+// 미리 만들어 두고, 새 키 삽입 시 꺼내 쓰며 제거된 노드는 다시 보관한다.
+// C++17 노드 핸들(extract/insert)을 사용하므로 맵의 할당자와 무관하다.
+// 예약하지 않으면(reserve 미호출) 일반 삽입/삭제와 같다.
+// =============================================================================
+
+template <typename Map>
+class MapNodePool {
+public:
+    using key_type = typename Map::key_type;
+    using mapped_type = typename Map::mapped_type;
+    using iterator = typename Map::iterator;
+
+    // 맵의 현재 원소와 보관 노드를 합쳐 capacity 개가 되도록 노드 생성
+    void reserve(const Map& map, size_t capacity) {
+        m_spares.reserve(capacity);
+
+        size_t existing = map.size() + m_spares.size();
+        if (existing >= capacity) {
+            return;
+        }
+
+        Map scratch;
+        for (size_t i = 0; i < capacity - existing; ++i) {
+            scratch.emplace(static_cast<key_type>(i), mapped_type{});
+        }
+        while (!scratch.empty()) {
+            m_spares.push_back(scratch.extract(scratch.begin()));
+        }
+    }
+
+    // map[key] = value 와 같으나 새 키는 보관 노드를 우선 사용
+    template <typename Value>
+    iterator assign(Map& map, const key_type& key, Value&& value) {
+        auto it = map.find(key);
+        if (it != map.end()) {
+            it->second = std::forward<Value>(value);
+            return it;
+        }
+
+        if (m_spares.empty()) {
+            return map.emplace(key, std::forward<Value>(value)).first;
+        }
+
+        auto node = std::move(m_spares.back());
+        m_spares.pop_back();
+        node.key() = key;
+        node.mapped() = std::forward<Value>(value);
+        return map.insert(std::move(node)).position;
+    }
+
+    // map.erase(it) 와 같으나 예약 용량 안에서는 노드를 보관
+    iterator erase(Map& map, iterator it) {
+        if (m_spares.size() >= m_spares.capacity()) {
+            return map.erase(it);
+        }
+
+        auto next = std::next(it);
+        m_spares.push_back(map.extract(it));
+        return next;
+    }
+
+    size_t spareCount() const { return m_spares.size(); }
+
+private:
+    std::vector<typename Map::node_type> m_spares;
+};
+
+} // namespace WeaponControl
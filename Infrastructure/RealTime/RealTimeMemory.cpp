@@ -0,0 +1,183 @@
+#include "RealTimeMemory.h"
+#include <algorithm>
+#include <cerrno>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <new>
+#include <string>
+
+#ifdef __linux__
+#include <sys/mman.h>
+#include <unistd.h>
+#endif
+
+#ifdef __GLIBC__
+#include <execinfo.h>
+#include <malloc.h>
+#endif
+
+namespace WeaponControl {
+
+// =============================================================================
+// RealTimeMemory 구현
+// =============================================================================
+
+std::atomic<bool> RealTimeMemory::s_memoryLocked(false);
+
+Result<void> RealTimeMemory::lockAndPrefault(const RealTimeMemoryConfig& config) {
+#ifdef __GLIBC__
+    // 해제된 힙을 운영체제로 반환하지 않고, 큰 블록도 mmap 대신 힙에서 할당
+    mallopt(M_TRIM_THRESHOLD, -1);
+    mallopt(M_MMAP_MAX, 0);
+#endif
+
+#ifdef __linux__
+    if (config.lockMemory) {
+        if (mlockall(MCL_CURRENT | MCL_FUTURE) != 0) {
+            return Result<void>::failure("mlockall failed: " + std::string(std::strerror(errno)));
+        }
+        s_memoryLocked.store(true, std::memory_order_relaxed);
+    }
+#else
+    if (config.lockMemory) {
+        return Result<void>::failure("Memory locking is not supported on this platform");
+    }
+#endif
+
+    prefaultHeap(config.heapPrefaultBytes);
+    prefaultStack(config.stackPrefaultBytes);
+    return Result<void>::success();
+}
+
+void RealTimeMemory::prefaultStack(size_t bytes) {
+    // 스택 배열을 페이지 단위로 접근 (volatile 로 최적화 제거 방지)
+    constexpr size_t CHUNK = 64 * 1024;
+    constexpr size_t PAGE = 4096;
+    volatile unsigned char chunk[CHUNK];
+    for (size_t i = 0; i < CHUNK; i += PAGE) {
+        chunk[i] = 0;
+    }
+
+    if (bytes > CHUNK) {
+        prefaultStack(bytes - CHUNK);
+        chunk[0] = chunk[CHUNK - 1];    // 재귀 후 접근하여 꼬리 호출로 프레임이 재사용되지 않게 함
+    }
+}
+
+void RealTimeMemory::prefaultHeap(size_t bytes) {
+    if (bytes == 0) {
+        return;
+    }
+
+#ifdef __linux__
+    size_t page = static_cast<size_t>(sysconf(_SC_PAGESIZE));
+#else
+    size_t page = 4096;
+#endif
+
+    auto* block = static_cast<unsigned char*>(std::malloc(bytes));
+    if (!block) {
+        return;
+    }
+
+    for (size_t i = 0; i < bytes; i += page) {
+        block[i] = 0;
+    }
+
+    // 트림이 비활성이므로 접근한 페이지는 힙에 남아 이후 할당에 재사용됨
+    std::free(block);
+}
+
+// =============================================================================
+// AllocationGuard 구현
+// =============================================================================
+
+std::atomic<bool> AllocationGuard::s_armed(false);
+std::atomic<uint64_t> AllocationGuard::s_violations(0);
+
+void AllocationGuard::arm(bool armed) {
+#ifdef __GLIBC__
+    if (armed && isCompiledIn()) {
+        // 첫 backtrace() 호출의 라이브러리 적재(할당)를 미리 수행
+        void* frames[4];
+        backtrace(frames, 4);
+    }
+#endif
+    s_armed.store(armed, std::memory_order_relaxed);
+}
+
+void AllocationGuard::onAllocation(size_t bytes) {
+    if (!isForbidden()) {
+        return;
+    }
+
+    // 보고 중 발생하는 할당은 다시 보고하지 않음
+    thread_local bool reporting = false;
+    if (reporting) {
+        return;
+    }
+
+    reporting = true;
+    s_violations.fetch_add(1, std::memory_order_relaxed);
+    report(bytes);
+    reporting = false;
+}
+
+void AllocationGuard::report(size_t bytes) {
+#if defined(__linux__) && defined(__GLIBC__)
+    // 할당 없이 stderr 로 직접 출력
+    char line[160];
+    const char* name = scopeName() ? scopeName() : "(unnamed)";
+    int length = std::snprintf(line, sizeof(line), "[AllocationGuard] %zu byte allocation in no-allocation scope '%s'\n",
+                               bytes, name);
+    if (length > 0) {
+        ssize_t written = write(STDERR_FILENO, line, std::min(static_cast<size_t>(length), sizeof(line) - 1));
+        (void)written;
+    }
+
+    void* frames[32];
+    int depth = backtrace(frames, 32);
+    backtrace_symbols_fd(frames, depth, STDERR_FILENO);
+#else
+    (void)bytes;
+#endif
+}
+
+} // namespace WeaponControl
+
+// =============================================================================
+// 전역 operator new/delete 교체 (WEAPONCONTROL_ALLOCATION_GUARD 빌드 전용)
+// =============================================================================
+
+#ifdef WEAPONCONTROL_ALLOCATION_GUARD
+
+namespace {
+
+void* guardedAllocate(std::size_t size) {
+    WeaponControl::AllocationGuard::onAllocation(size);
+
+    void* ptr = std::malloc(size == 0 ? 1 : size);
+    if (!ptr) {
+        throw std::bad_alloc();
+    }
+    return ptr;
+}
+
+} // namespace
+
+void* operator new(std::size_t size) { return guardedAllocate(size); }
+void* operator new[](std::size_t size) { return guardedAllocate(size); }
+void* operator new(std::size_t size, const std::nothrow_t&) noexcept {
+    try { return guardedAllocate(size); } catch (...) { return nullptr; }
+}
+void* operator new[](std::size_t size, const std::nothrow_t&) noexcept {
+    try { return guardedAllocate(size); } catch (...) { return nullptr; }
+}
+
+void operator delete(void* ptr) noexcept { std::free(ptr); }
+void operator delete[](void* ptr) noexcept { std::free(ptr); }
+void operator delete(void* ptr, std::size_t) noexcept { std::free(ptr); }
+void operator delete[](void* ptr, std::size_t) noexcept { std::free(ptr); }
+
+#endif // WEAPONCONTROL_ALLOCATION_GUARD
@@ -0,0 +1,115 @@
+#pragma once
+
+#include "../../Common/Types/CommonTypes.h"
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+
+namespace WeaponControl {
+
+// =============================================================================
+// 실시간 메모리 모드 설정 (SystemConfig::getRealTimeMemoryConfig 로 생성)
+// =============================================================================
+
+struct RealTimeMemoryConfig {
+    bool lockMemory = true;                         // mlockall(MCL_CURRENT | MCL_FUTURE)
+    size_t stackPrefaultBytes = 512 * 1024;         // 호출 스레드 스택 선점 크기
+    size_t heapPrefaultBytes = 32 * 1024 * 1024;    // 힙 선점 크기 (해제 후에도 반환하지 않음)
+    size_t maxTargets = 256;                        // 표적 저장소 예약 수
+};
+
+// =============================================================================
+// 실시간 메모리 준비
+//
+// 초기화 마지막 단계에서 한 번 호출한다. 힙이 운영체제로 반환/축소되지
+// 않도록 고정한 뒤 지정 크기만큼 힙과 호출 스레드 스택을 미리 접근하여
+// 페이지 폴트를 초기화 단계로 옮긴다. 주기/명령 스레드가 별도로 있으면
+// 각 스레드 시작 시 prefaultStack() 을 호출한다.
+// =============================================================================
+
+class RealTimeMemory {
+public:
+    static Result<void> lockAndPrefault(const RealTimeMemoryConfig& config);
+
+    // 호출 스레드의 스택 페이지를 미리 접근
+    static void prefaultStack(size_t bytes);
+
+    static bool isMemoryLocked() { return s_memoryLocked.load(std::memory_order_relaxed); }
+
+private:
+    static void prefaultHeap(size_t bytes);
+
+    static std::atomic<bool> s_memoryLocked;
+};
+
+// =============================================================================
+// 정상 상태 할당 감시
+//
+// ScopedNoAllocation 구간(주기 갱신, 정상 상태 명령 처리) 안의 할당을
+// 위반으로 집계한다. 감시는 arm(true) 이후에만 동작한다. 할당 가로채기는
+// WEAPONCONTROL_ALLOCATION_GUARD 를 정의하여 빌드한 경우에만 포함되며
+// (전역 operator new 교체, 위반마다 호출 스택을 stderr 로 출력), 그 외
+// 빌드에서는 구간 표시 비용만 남는다. 벤치마크의 AllocationHooks.cpp 도
+// operator new 를 교체하므로 두 가지를 함께 링크하지 않는다.
+// =============================================================================
+
+class AllocationGuard {
+public:
+    static constexpr bool isCompiledIn() {
+#ifdef WEAPONCONTROL_ALLOCATION_GUARD
+        return true;
+#else
+        return false;
+#endif
+    }
+
+    static void arm(bool armed);
+    static bool isArmed() { return s_armed.load(std::memory_order_relaxed); }
+
+    // 현재 스레드가 할당 금지 구간 안인지
+    static bool isForbidden() { return isArmed() && scopeDepth() > 0; }
+
+    // 할당 가로채기에서 호출 (금지 구간이면 위반 집계 및 보고)
+    static void onAllocation(size_t bytes);
+
+    static uint64_t violationCount() { return s_violations.load(std::memory_order_relaxed); }
+
+private:
+    friend class ScopedNoAllocation;
+
+    static int& scopeDepth() {
+        thread_local int depth = 0;
+        return depth;
+    }
+
+    static const char*& scopeName() {
+        thread_local const char* name = nullptr;
+        return name;
+    }
+
+    static void report(size_t bytes);
+
+    static std::atomic<bool> s_armed;
+    static std::atomic<uint64_t> s_violations;
+};
+
+// 할당 금지 구간 (중첩 가능, 가장 바깥 구간 이름으로 보고)
+class ScopedNoAllocation {
+public:
+    explicit ScopedNoAllocation(const char* name) {
+        if (AllocationGuard::scopeDepth()++ == 0) {
+            AllocationGuard::scopeName() = name;
+        }
+    }
+
+    ~ScopedNoAllocation() {
+        if (--AllocationGuard::scopeDepth() == 0) {
+            AllocationGuard::scopeName() = nullptr;
+        }
+    }
+
+    ScopedNoAllocation(const ScopedNoAllocation&) = delete;
+    ScopedNoAllocation& operator=(const ScopedNoAllocation&) = delete;
+};
+
+} // namespace WeaponControl
@@ -0,0 +1,135 @@
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+
+namespace WeaponControl {
+
+// =============================================================================
+// 불변 스냅샷 교환 (단일 작성자, 다수 읽기, 읽기 대기 없음)
+//
+// 미리 만든 SLOTS 개의 슬롯을 돌려 쓰며 작성자는 현재 게시 슬롯이 아니고
+// 읽는 쪽이 없는 슬롯에 새 스냅샷을 채운 뒤 게시한다. 게시 위치와 그 슬롯을
+// 잡은 읽기 수를 한 64비트 원자값(상위: 슬롯 번호 + 1, 하위: 읽기 수)에 두므로
+// 읽기는 fetch_add 한 번으로 슬롯을 고정하고(재시도 없음), 해제는 해당 슬롯
+// 카운터의 fetch_sub 한 번이다. 게시 시 교체된 슬롯의 읽기 수를 그 슬롯
+// 카운터로 넘기며, 카운터가 0 이 된 슬롯만 다시 쓴다.
+//
+// 슬롯 객체는 재사용되므로 벡터 용량이 유지되어 정상 상태 게시에 할당이 없다.
+// 읽는 쪽이 모든 예비 슬롯을 잡고 있으면 beginWrite 가 nullptr 를 반환하며
+// 작성자는 그 주기 게시를 건너뛴다. 한 게시 간격 동안의 읽기는 2^32 회 미만이어야 한다.
+// =============================================================================
+
+template <typename T, size_t SLOTS = 4>
+class SnapshotExchange {
+    static_assert(SLOTS >= 2, "SnapshotExchange requires at least two slots");
+
+    struct alignas(64) Slot {
+        std::atomic<int64_t> readers{0};
+        T value{};
+    };
+
+public:
+    // 읽기 핸들 - 소멸 시 슬롯 해제 (이동만 가능)
+    class Handle {
+    public:
+        Handle() = default;
+        Handle(Handle&& other) noexcept : m_slot(other.m_slot) { other.m_slot = nullptr; }
+        Handle& operator=(Handle&& other) noexcept {
+            if (this != &other) {
+                release();
+                m_slot = other.m_slot;
+                other.m_slot = nullptr;
+            }
+            return *this;
+        }
+        Handle(const Handle&) = delete;
+        Handle& operator=(const Handle&) = delete;
+        ~Handle() { release(); }
+
+        explicit operator bool() const { return m_slot != nullptr; }
+        const T& operator*() const { return m_slot->value; }
+        const T* operator->() const { return &m_slot->value; }
+        const T* get() const { return m_slot ? &m_slot->value : nullptr; }
+
+        void release() {
+            if (m_slot) {
+                m_slot->readers.fetch_sub(1, std::memory_order_release);
+                m_slot = nullptr;
+            }
+        }
+
+    private:
+        friend class SnapshotExchange;
+        explicit Handle(Slot* slot) : m_slot(slot) {}
+
+        Slot* m_slot = nullptr;
+    };
+
+    SnapshotExchange() = default;
+    SnapshotExchange(const SnapshotExchange&) = delete;
+    SnapshotExchange& operator=(const SnapshotExchange&) = delete;
+
+    // 최근 게시 스냅샷 (게시 전이면 빈 핸들)
+    Handle acquire() const {
+        uint64_t word = m_current.fetch_add(1, std::memory_order_acquire);
+        uint32_t index = static_cast<uint32_t>(word >> 32);
+        return index == 0 ? Handle() : Handle(&m_slots[index - 1]);
+    }
+
+    // ==========================================================================
+    // 작성자 (한 스레드)
+    // ==========================================================================
+
+    // 채울 슬롯 (이전 게시 내용이 남아 있음), 모두 사용 중이면 nullptr
+    T* beginWrite() {
+        for (size_t i = 0; i < SLOTS; ++i) {
+            size_t candidate = (m_lastWritten + 1 + i) % SLOTS;
+            if (candidate + 1 != m_currentIndex
+                && m_slots[candidate].readers.load(std::memory_order_acquire) == 0) {
+                m_writing = candidate + 1;
+                return &m_slots[candidate].value;
+            }
+        }
+        return nullptr;
+    }
+
+    // beginWrite 로 채운 슬롯 게시
+    void publish() {
+        if (m_writing == 0) {
+            return;
+        }
+
+        uint64_t previous = m_current.exchange(static_cast<uint64_t>(m_writing) << 32, std::memory_order_acq_rel);
+        uint32_t previousIndex = static_cast<uint32_t>(previous >> 32);
+        if (previousIndex != 0) {
+            m_slots[previousIndex - 1].readers.fetch_add(static_cast<int64_t>(previous & 0xFFFFFFFFu),
+                                                         std::memory_order_relaxed);
+        }
+
+        m_currentIndex = m_writing;
+        m_lastWritten = m_writing - 1;
+        m_writing = 0;
+    }
+
+    // 초기화 시 슬롯별 용량 확보 등 (게시 전, 읽기가 없을 때만)
+    template <typename Visitor>
+    void forEachSlot(Visitor&& visitor) {
+        for (auto& slot : m_slots) {
+            visitor(slot.value);
+        }
+    }
+
+private:
+    mutable std::array<Slot, SLOTS> m_slots;
+    mutable std::atomic<uint64_t> m_current{0};
+
+    // 작성자 전용
+    size_t m_currentIndex = 0;      // 게시 슬롯 번호 + 1 (0: 없음)
+    size_t m_writing = 0;           // 채우는 중인 슬롯 번호 + 1
+    size_t m_lastWritten = SLOTS - 1;
+};
+
+} // namespace WeaponControl
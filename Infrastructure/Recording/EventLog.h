@@ -0,0 +1,523 @@
+#pragma once
+
+#include "../../Common/Types/CommonTypes.h"
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+namespace WeaponControl {
+
+// =============================================================================
+// 이벤트 로그 형식
+//
+// [파일 헤더 16B] magic "WCEVLOG1" | version(u32) | reserved(u32)
+// [레코드 헤더 16B] type(u16) | payloadSize(u16) | sequence(u32) | timestampNs(i64)
+// [페이로드] 아래 encode/decode 로 정의된 필드 순서 (호스트 바이트 순서)
+//
+// 타임스탬프는 ClockProvider 기준 시각(steady/virtual)의 ns 값이다.
+// =============================================================================
+
+constexpr char EVENT_LOG_MAGIC[8] = {'W', 'C', 'E', 'V', 'L', 'O', 'G', '1'};
+constexpr uint32_t EVENT_LOG_VERSION = 1;
+constexpr size_t EVENT_MAX_PAYLOAD = 1024;
+
+enum class EventType : uint16_t {
+    // 입력 이벤트 (WeaponControlService 진입 시점)
+    SESSION_START = 1,
+    ASSIGN,
+    UNASSIGN,
+    CONTROL,
+    WAYPOINTS,
+    EMERGENCY_STOP,
+    OWN_SHIP,
+    TRACK,
+    AXIS_CENTER,
+    UPDATE_TICK,
+    MINE_PLAN_SAVE_BEGIN,       // 목록 저장 시작 (목록 번호, 계획 수) - 이후 ITEM 이 계획 수만큼 이어짐
+    MINE_PLAN_SAVE_ITEM,
+    MINE_PLAN_UPDATE,
+    MINE_PLAN_ADD,
+    MINE_PLAN_REMOVE,
+    MINE_PLAN_LIST_CREATE,
+    MINE_PLAN_LIST_DELETE,
+
+    // 출력 이벤트 (콜백 통지, 재생 결과 비교용)
+    STATE_CHANGED = 100,
+    LAUNCH_STATUS,
+    ENGAGEMENT_PLAN
+};
+
+inline bool IsOutputEvent(EventType type) {
+    return static_cast<uint16_t>(type) >= static_cast<uint16_t>(EventType::STATE_CHANGED);
+}
+
+inline const char* EventTypeName(EventType type) {
+    switch (type) {
+        case EventType::SESSION_START: return "SESSION_START";
+        case EventType::ASSIGN: return "ASSIGN";
+        case EventType::UNASSIGN: return "UNASSIGN";
+        case EventType::CONTROL: return "CONTROL";
+        case EventType::WAYPOINTS: return "WAYPOINTS";
+        case EventType::EMERGENCY_STOP: return "EMERGENCY_STOP";
+        case EventType::OWN_SHIP: return "OWN_SHIP";
+        case EventType::TRACK: return "TRACK";
+        case EventType::AXIS_CENTER: return "AXIS_CENTER";
+        case EventType::UPDATE_TICK: return "UPDATE_TICK";
+        case EventType::MINE_PLAN_SAVE_BEGIN: return "MINE_PLAN_SAVE_BEGIN";
+        case EventType::MINE_PLAN_SAVE_ITEM: return "MINE_PLAN_SAVE_ITEM";
+        case EventType::MINE_PLAN_UPDATE: return "MINE_PLAN_UPDATE";
+        case EventType::MINE_PLAN_ADD: return "MINE_PLAN_ADD";
+        case EventType::MINE_PLAN_REMOVE: return "MINE_PLAN_REMOVE";
+        case EventType::MINE_PLAN_LIST_CREATE: return "MINE_PLAN_LIST_CREATE";
+        case EventType::MINE_PLAN_LIST_DELETE: return "MINE_PLAN_LIST_DELETE";
+        case EventType::STATE_CHANGED: return "STATE_CHANGED";
+        case EventType::LAUNCH_STATUS: return "LAUNCH_STATUS";
+        case EventType::ENGAGEMENT_PLAN: return "ENGAGEMENT_PLAN";
+        default: return "UNKNOWN";
+    }
+}
+
+#pragma pack(push, 1)
+struct EventRecordHeader {
+    uint16_t type;
+    uint16_t payloadSize;
+    uint32_t sequence;
+    int64_t timestampNs;
+};
+#pragma pack(pop)
+
+static_assert(sizeof(EventRecordHeader) == 16, "EventRecordHeader must be 16 bytes");
+
+// =============================================================================
+// 페이로드 인코더/디코더
+// =============================================================================
+
+class EventEncoder {
+public:
+    EventEncoder(uint8_t* buffer, size_t capacity)
+        : m_buffer(buffer), m_capacity(capacity), m_size(0), m_overflow(false) {}
+
+    template<typename T>
+    void put(T value) {
+        static_assert(std::is_arithmetic<T>::value || std::is_enum<T>::value, "put() requires a scalar");
+        putBytes(&value, sizeof(value));
+    }
+
+    void putBytes(const void* data, size_t size) {
+        if (m_overflow || m_size + size > m_capacity) {
+            m_overflow = true;
+            return;
+        }
+        std::memcpy(m_buffer + m_size, data, size);
+        m_size += size;
+    }
+
+    size_t size() const { return m_size; }
+    bool overflow() const { return m_overflow; }
+
+private:
+    uint8_t* m_buffer;
+    size_t m_capacity;
+    size_t m_size;
+    bool m_overflow;
+};
+
+class EventDecoder {
+public:
+    EventDecoder(const uint8_t* data, size_t size)
+        : m_data(data), m_size(size), m_offset(0), m_error(false) {}
+
+    template<typename T>
+    T get() {
+        static_assert(std::is_arithmetic<T>::value || std::is_enum<T>::value, "get() requires a scalar");
+        T value{};
+        getBytes(&value, sizeof(value));
+        return value;
+    }
+
+    void getBytes(void* out, size_t size) {
+        if (m_error || m_offset + size > m_size) {
+            m_error = true;
+            return;
+        }
+        std::memcpy(out, m_data + m_offset, size);
+        m_offset += size;
+    }
+
+    bool ok() const { return !m_error; }
+
+private:
+    const uint8_t* m_data;
+    size_t m_size;
+    size_t m_offset;
+    bool m_error;
+};
+
+// 필드 타입 그대로 읽기 (DDS 생성 타입의 필드 폭을 코덱에서 가정하지 않도록)
+template<typename Field>
+inline void decodeField(EventDecoder& d, Field& field) {
+    field = d.get<Field>();
+}
+
+// =============================================================================
+// 도메인 타입 코덱
+//
+// DDS 메시지는 무장 통제 로직이 사용하는 필드만 기록한다. 항법/축 중심
+// 정보는 필드를 해석하지 않고 전달만 하므로 바이트 이미지로 기록한다.
+// =============================================================================
+
+inline void encode(EventEncoder& e, const ST_3D_GEODETIC_POSITION& pos) {
+    e.put(pos.dLatitude());
+    e.put(pos.dLongitude());
+    e.put(pos.fDepth());
+}
+
+inline void decode(EventDecoder& d, ST_3D_GEODETIC_POSITION& pos) {
+    decodeField(d, pos.dLatitude());
+    decodeField(d, pos.dLongitude());
+    decodeField(d, pos.fDepth());
+}
+
+inline void encode(EventEncoder& e, const SGEODETIC_POSITION& pos) {
+    e.put(pos.dLatitude());
+    e.put(pos.dLongitude());
+    e.put(pos.fAltitude());
+}
+
+inline void decode(EventDecoder& d, SGEODETIC_POSITION& pos) {
+    decodeField(d, pos.dLatitude());
+    decodeField(d, pos.dLongitude());
+    decodeField(d, pos.fAltitude());
+}
+
+inline void encode(EventEncoder& e, const ST_WEAPON_WAYPOINT& wp) {
+    e.put(wp.dLatitude());
+    e.put(wp.dLongitude());
+    e.put(wp.fDepth());
+}
+
+inline void decode(EventDecoder& d, ST_WEAPON_WAYPOINT& wp) {
+    decodeField(d, wp.dLatitude());
+    decodeField(d, wp.dLongitude());
+    decodeField(d, wp.fDepth());
+}
+
+inline void encode(EventEncoder& e, const WeaponAssignmentRequest& request) {
+    const auto& info = request.assignmentInfo;
+    e.put(request.tubeNumber);
+    e.put(request.weaponKind);
+    e.put(info.tubeNumber);
+    e.put(info.weaponKind);
+    e.put(info.systemTargetId);
+    encode(e, info.targetPos);
+    e.put(info.dropPlanListNumber);
+    e.put(info.dropPlanNumber);
+}
+
+inline void decode(EventDecoder& d, WeaponAssignmentRequest& request) {
+    auto& info = request.assignmentInfo;
+    decodeField(d, request.tubeNumber);
+    decodeField(d, request.weaponKind);
+    decodeField(d, info.tubeNumber);
+    decodeField(d, info.weaponKind);
+    decodeField(d, info.systemTargetId);
+    decode(d, info.targetPos);
+    decodeField(d, info.dropPlanListNumber);
+    decodeField(d, info.dropPlanNumber);
+}
+
+// 취소 토큰은 기록하지 않음 (재생 시 새 토큰)
+inline void encode(EventEncoder& e, const WeaponControlRequest& request) {
+    e.put(request.tubeNumber);
+    e.put(request.targetState);
+}
+
+inline void decode(EventDecoder& d, WeaponControlRequest& request) {
+    decodeField(d, request.tubeNumber);
+    decodeField(d, request.targetState);
+}
+
+inline void encode(EventEncoder& e, const WaypointUpdateRequest& request) {
+    e.put(request.tubeNumber);
+    e.put(static_cast<uint16_t>(request.waypoints.size()));
+    for (const auto& wp : request.waypoints) {
+        encode(e, wp);
+    }
+}
+
+inline void decode(EventDecoder& d, WaypointUpdateRequest& request) {
+    decodeField(d, request.tubeNumber);
+    uint16_t count = d.get<uint16_t>();
+    request.waypoints.resize(count);
+    for (auto& wp : request.waypoints) {
+        decode(d, wp);
+    }
+}
+
+inline void encode(EventEncoder& e, const TRKMGR_SYSTEMTARGET_INFO& target) {
+    e.put(target.unTargetSystemID());
+    encode(e, target.stGeodeticPosition());
+}
+
+inline void decode(EventDecoder& d, TRKMGR_SYSTEMTARGET_INFO& target) {
+    decodeField(d, target.unTargetSystemID());
+    decode(d, target.stGeodeticPosition());
+}
+
+inline void encode(EventEncoder& e, const NAVINF_SHIP_NAVIGATION_INFO& ownShip) {
+    static_assert(std::is_trivially_copyable<NAVINF_SHIP_NAVIGATION_INFO>::value,
+                  "NAVINF_SHIP_NAVIGATION_INFO is recorded as a byte image");
+    e.putBytes(&ownShip, sizeof(ownShip));
+}
+
+inline void decode(EventDecoder& d, NAVINF_SHIP_NAVIGATION_INFO& ownShip) {
+    d.getBytes(&ownShip, sizeof(ownShip));
+}
+
+inline void encode(EventEncoder& e, const GEO_POINT_2D& axisCenter) {
+    static_assert(std::is_trivially_copyable<GEO_POINT_2D>::value, "GEO_POINT_2D is recorded as a byte image");
+    e.putBytes(&axisCenter, sizeof(axisCenter));
+}
+
+inline void decode(EventDecoder& d, GEO_POINT_2D& axisCenter) {
+    d.getBytes(&axisCenter, sizeof(axisCenter));
+}
+
+inline void encode(EventEncoder& e, const ST_M_MINE_PLAN_INFO& plan) {
+    e.put(plan.sListID());
+    e.put(plan.usDroppingPlanNumber());
+    encode(e, plan.stLaunchPos());
+    encode(e, plan.stDropPos());
+    e.put(plan.usWaypointCnt());
+    uint16_t count = std::min<uint16_t>(plan.usWaypointCnt(), static_cast<uint16_t>(plan.stWaypoint().size()));
+    for (uint16_t i = 0; i < count; ++i) {
+        encode(e, plan.stWaypoint()[i]);
+    }
+}
+
+inline void decode(EventDecoder& d, ST_M_MINE_PLAN_INFO& plan) {
+    decodeField(d, plan.sListID());
+    decodeField(d, plan.usDroppingPlanNumber());
+    decode(d, plan.stLaunchPos());
+    decode(d, plan.stDropPos());
+    decodeField(d, plan.usWaypointCnt());
+    uint16_t count = std::min<uint16_t>(plan.usWaypointCnt(), static_cast<uint16_t>(plan.stWaypoint().size()));
+    for (uint16_t i = 0; i < count; ++i) {
+        decode(d, plan.stWaypoint()[i]);
+    }
+}
+
+// 단일 값 페이로드 (발사관 번호 등)
+template<typename T, typename = std::enable_if_t<std::is_arithmetic<T>::value>>
+inline void encode(EventEncoder& e, T value) {
+    e.put(value);
+}
+
+template<typename T, typename = std::enable_if_t<std::is_arithmetic<T>::value>>
+inline void decode(EventDecoder& d, T& value) {
+    value = d.get<T>();
+}
+
+// =============================================================================
+// 세션/부설계획 편집 이벤트
+// =============================================================================
+
+struct SessionStartEvent {
+    uint16_t tubeCount = 0;
+};
+
+// 목록 단위 편집: SAVE_BEGIN(value=계획 수), REMOVE(value=계획 번호), LIST_CREATE/DELETE
+struct PlanListEvent {
+    uint32_t planListNumber = 0;
+    uint32_t value = 0;
+};
+
+// 계획 단위 편집: SAVE_ITEM, UPDATE, ADD
+struct PlanEvent {
+    uint32_t planListNumber = 0;
+    ST_M_MINE_PLAN_INFO plan;
+};
+
+inline void encode(EventEncoder& e, const SessionStartEvent& event) {
+    e.put(event.tubeCount);
+}
+
+inline void decode(EventDecoder& d, SessionStartEvent& event) {
+    decodeField(d, event.tubeCount);
+}
+
+inline void encode(EventEncoder& e, const PlanListEvent& event) {
+    e.put(event.planListNumber);
+    e.put(event.value);
+}
+
+inline void decode(EventDecoder& d, PlanListEvent& event) {
+    decodeField(d, event.planListNumber);
+    decodeField(d, event.value);
+}
+
+inline void encode(EventEncoder& e, const PlanEvent& event) {
+    e.put(event.planListNumber);
+    encode(e, event.plan);
+}
+
+inline void decode(EventDecoder& d, PlanEvent& event) {
+    decodeField(d, event.planListNumber);
+    decode(d, event.plan);
+}
+
+// =============================================================================
+// 출력 이벤트 (콜백 비교용 요약)
+// =============================================================================
+
+struct StateChangedEvent {
+    uint16_t tubeNumber = 0;
+    EN_WPN_CTRL_STATE oldState = EN_WPN_CTRL_STATE::WPN_CTRL_STATE_OFF;
+    EN_WPN_CTRL_STATE newState = EN_WPN_CTRL_STATE::WPN_CTRL_STATE_OFF;
+};
+
+struct LaunchStatusEvent {
+    uint16_t tubeNumber = 0;
+    bool launched = false;
+};
+
+// 교전계획은 시각에 독립적인 내용(궤적, 경로점, 발사/표적 위치)의 요약값으로 비교
+struct EngagementPlanEvent {
+    uint16_t tubeNumber = 0;
+    bool isValid = false;
+    uint32_t trajectoryCount = 0;
+    uint32_t waypointCount = 0;
+    uint64_t contentDigest = 0;
+
+    static EngagementPlanEvent fromResult(uint16_t tubeNumber, const EngagementPlanResult& result) {
+        EngagementPlanEvent event;
+        event.tubeNumber = tubeNumber;
+        event.isValid = result.isValid;
+        event.trajectoryCount = static_cast<uint32_t>(result.trajectory.size());
+        event.waypointCount = static_cast<uint32_t>(result.waypoints.size());
+
+        // FNV-1a
+        uint64_t hash = 1469598103934665603ull;
+        auto mix = [&hash](const void* data, size_t size) {
+            auto bytes = static_cast<const uint8_t*>(data);
+            for (size_t i = 0; i < size; ++i) {
+                hash = (hash ^ bytes[i]) * 1099511628211ull;
+            }
+        };
+        auto mixPosition = [&mix](double lat, double lon, float depth) {
+            mix(&lat, sizeof(lat));
+            mix(&lon, sizeof(lon));
+            mix(&depth, sizeof(depth));
+        };
+
+        mix(&result.weaponKind, sizeof(result.weaponKind));
+        mix(&result.isValid, sizeof(result.isValid));
+        for (const auto& p : result.trajectory) {
+            mixPosition(p.dLatitude(), p.dLongitude(), p.fDepth());
+        }
+        for (const auto& wp : result.waypoints) {
+            mixPosition(wp.dLatitude(), wp.dLongitude(), wp.fDepth());
+        }
+        mixPosition(result.launchPosition.dLatitude(), result.launchPosition.dLongitude(), result.launchPosition.fDepth());
+        mixPosition(result.targetPosition.dLatitude(), result.targetPosition.dLongitude(), result.targetPosition.fDepth());
+
+        event.contentDigest = hash;
+        return event;
+    }
+};
+
+inline void encode(EventEncoder& e, const StateChangedEvent& event) {
+    e.put(event.tubeNumber);
+    e.put(event.oldState);
+    e.put(event.newState);
+}
+
+inline void decode(EventDecoder& d, StateChangedEvent& event) {
+    decodeField(d, event.tubeNumber);
+    decodeField(d, event.oldState);
+    decodeField(d, event.newState);
+}
+
+inline void encode(EventEncoder& e, const LaunchStatusEvent& event) {
+    e.put(event.tubeNumber);
+    e.put(static_cast<uint8_t>(event.launched));
+}
+
+inline void decode(EventDecoder& d, LaunchStatusEvent& event) {
+    decodeField(d, event.tubeNumber);
+    event.launched = d.get<uint8_t>() != 0;
+}
+
+inline void encode(EventEncoder& e, const EngagementPlanEvent& event) {
+    e.put(event.tubeNumber);
+    e.put(static_cast<uint8_t>(event.isValid));
+    e.put(event.trajectoryCount);
+    e.put(event.waypointCount);
+    e.put(event.contentDigest);
+}
+
+inline void decode(EventDecoder& d, EngagementPlanEvent& event) {
+    decodeField(d, event.tubeNumber);
+    event.isValid = d.get<uint8_t>() != 0;
+    decodeField(d, event.trajectoryCount);
+    decodeField(d, event.waypointCount);
+    decodeField(d, event.contentDigest);
+}
+
+// =============================================================================
+// 이벤트 로그 읽기
+// =============================================================================
+
+struct EventRecord {
+    EventType type;
+    uint32_t sequence;
+    int64_t timestampNs;
+    std::vector<uint8_t> payload;
+
+    EventDecoder decoder() const { return EventDecoder(payload.data(), payload.size()); }
+};
+
+class EventLogReader {
+public:
+    static Result<std::vector<EventRecord>> readAll(const std::string& path) {
+        std::ifstream file(path, std::ios::binary);
+        if (!file.is_open()) {
+            return Result<std::vector<EventRecord>>::failure("Cannot open event log: " + path);
+        }
+
+        char magic[sizeof(EVENT_LOG_MAGIC)];
+        uint32_t version = 0;
+        uint32_t reserved = 0;
+        file.read(magic, sizeof(magic));
+        file.read(reinterpret_cast<char*>(&version), sizeof(version));
+        file.read(reinterpret_cast<char*>(&reserved), sizeof(reserved));
+        if (!file || std::memcmp(magic, EVENT_LOG_MAGIC, sizeof(magic)) != 0) {
+            return Result<std::vector<EventRecord>>::failure("Not an event log: " + path);
+        }
+        if (version != EVENT_LOG_VERSION) {
+            return Result<std::vector<EventRecord>>::failure("Unsupported event log version " + std::to_string(version));
+        }
+
+        std::vector<EventRecord> records;
+        EventRecordHeader header;
+        while (file.read(reinterpret_cast<char*>(&header), sizeof(header))) {
+            EventRecord record;
+            record.type = static_cast<EventType>(header.type);
+            record.sequence = header.sequence;
+            record.timestampNs = header.timestampNs;
+            record.payload.resize(header.payloadSize);
+            if (!file.read(reinterpret_cast<char*>(record.payload.data()), header.payloadSize)) {
+                break;  // 기록 중단으로 잘린 마지막 레코드는 무시
+            }
+            records.push_back(std::move(record));
+        }
+
+        return Result<std::vector<EventRecord>>::success(std::move(records));
+    }
+};
+
+} // namespace WeaponControl
@@ -0,0 +1,180 @@
+#include "EventRecorder.h"
+#include "../Diagnostics/MemoryAccounting.h"
+#include <chrono>
+#include <iostream>
+
+namespace WeaponControl {
+
+// =============================================================================
+// EventRecorder 구현
+// =============================================================================
+
+namespace {
+
+size_t roundUpToPowerOfTwo(size_t value) {
+    size_t result = 2;
+    while (result < value) {
+        result <<= 1;
+    }
+    return result;
+}
+
+// 페이로드 없는 이벤트용
+struct EmptyPayload {};
+inline void encode(EventEncoder&, const EmptyPayload&) {}
+
+} // namespace
+
+EventRecorder::EventRecorder(size_t ringCapacity)
+    : m_capacity(roundUpToPowerOfTwo(ringCapacity))
+    , m_mask(m_capacity - 1)
+    , m_enqueuePosition(0)
+    , m_dequeuePosition(0)
+    , m_recording(false)
+    , m_writerRunning(false)
+    , m_fileBuffer(1 << 20)
+    , m_recordedCounter(MetricsRegistry::getInstance().counter(
+          "event_recorder_events_total", "Events written to the event log"))
+    , m_droppedCounter(MetricsRegistry::getInstance().counter(
+          "event_recorder_dropped_total", "Events dropped because the recorder ring was full or the payload too large"))
+    , m_queueDepthGauge(MetricsRegistry::getInstance().gauge(
+          "event_recorder_queue_depth", "Events waiting in the recorder ring"))
+{
+    m_ring.reset(new Slot[m_capacity]);
+    for (size_t i = 0; i < m_capacity; ++i) {
+        m_ring[i].sequence.store(i, std::memory_order_relaxed);
+    }
+    MemoryAccounting::getInstance().onAllocate(MemoryAccountId::LOGGING_BUFFERS, bufferBytes());
+}
+
+EventRecorder::~EventRecorder() {
+    stop();
+    MemoryAccounting::getInstance().onDeallocate(MemoryAccountId::LOGGING_BUFFERS, bufferBytes());
+}
+
+size_t EventRecorder::bufferBytes() const {
+    return m_capacity * sizeof(Slot) + m_fileBuffer.capacity();
+}
+
+Result<void> EventRecorder::start(const std::string& path) {
+    if (isRecording()) {
+        return Result<void>::failure("Event recorder already running");
+    }
+
+    m_file.rdbuf()->pubsetbuf(m_fileBuffer.data(), static_cast<std::streamsize>(m_fileBuffer.size()));
+    m_file.open(path, std::ios::binary | std::ios::trunc);
+    if (!m_file.is_open()) {
+        return Result<void>::failure("Cannot open event log for writing: " + path);
+    }
+
+    uint32_t version = EVENT_LOG_VERSION;
+    uint32_t reserved = 0;
+    m_file.write(EVENT_LOG_MAGIC, sizeof(EVENT_LOG_MAGIC));
+    m_file.write(reinterpret_cast<const char*>(&version), sizeof(version));
+    m_file.write(reinterpret_cast<const char*>(&reserved), sizeof(reserved));
+
+    m_writerRunning.store(true, std::memory_order_release);
+    m_writerThread = std::thread([this]() { writerLoop(); });
+    m_recording.store(true, std::memory_order_release);
+
+    std::cout << "Event recording started: " << path << std::endl;
+    return Result<void>::success();
+}
+
+void EventRecorder::stop() {
+    if (!m_recording.exchange(false, std::memory_order_acq_rel)) {
+        return;
+    }
+
+    m_writerRunning.store(false, std::memory_order_release);
+    if (m_writerThread.joinable()) {
+        m_writerThread.join();
+    }
+
+    drain();
+    m_file.flush();
+    m_file.close();
+
+    std::cout << "Event recording stopped: " << recordedCount() << " events, "
+              << droppedCount() << " dropped" << std::endl;
+}
+
+void EventRecorder::record(EventType type) {
+    record(type, EmptyPayload{});
+}
+
+EventRecorder::Slot* EventRecorder::claimSlot(uint64_t& position) {
+    position = m_enqueuePosition.load(std::memory_order_relaxed);
+    for (;;) {
+        Slot* slot = &m_ring[position & m_mask];
+        uint64_t sequence = slot->sequence.load(std::memory_order_acquire);
+        int64_t diff = static_cast<int64_t>(sequence) - static_cast<int64_t>(position);
+
+        if (diff == 0) {
+            if (m_enqueuePosition.compare_exchange_weak(position, position + 1, std::memory_order_relaxed)) {
+                return slot;
+            }
+        } else if (diff < 0) {
+            return nullptr;     // 링 가득 참
+        } else {
+            position = m_enqueuePosition.load(std::memory_order_relaxed);
+        }
+    }
+}
+
+void EventRecorder::publishSlot(Slot* slot, uint64_t position, EventType type, uint16_t payloadSize,
+                                int64_t timestampNs, bool discard) {
+    slot->header.type = static_cast<uint16_t>(type);
+    slot->header.payloadSize = payloadSize;
+    slot->header.sequence = static_cast<uint32_t>(position);
+    slot->header.timestampNs = timestampNs;
+    slot->discard = discard;
+    slot->sequence.store(position + 1, std::memory_order_release);
+}
+
+size_t EventRecorder::drain() {
+    size_t written = 0;
+
+    for (;;) {
+        Slot* slot = &m_ring[m_dequeuePosition & m_mask];
+        uint64_t sequence = slot->sequence.load(std::memory_order_acquire);
+        if (sequence != m_dequeuePosition + 1) {
+            break;      // 아직 게시되지 않음
+        }
+
+        if (!slot->discard) {
+            m_file.write(reinterpret_cast<const char*>(&slot->header), sizeof(slot->header));
+            m_file.write(reinterpret_cast<const char*>(slot->payload), slot->header.payloadSize);
+            ++written;
+        }
+
+        slot->sequence.store(m_dequeuePosition + m_capacity, std::memory_order_release);
+        ++m_dequeuePosition;
+    }
+
+    if (written > 0) {
+        m_recordedCounter.increment(written);
+    }
+    m_queueDepthGauge.set(static_cast<int64_t>(
+        m_enqueuePosition.load(std::memory_order_relaxed) - m_dequeuePosition));
+    return written;
+}
+
+void EventRecorder::writerLoop() {
+    auto lastFlush = std::chrono::steady_clock::now();
+
+    while (m_writerRunning.load(std::memory_order_acquire)) {
+        if (drain() == 0) {
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        }
+
+        // 비정상 종료 시 손실 범위를 제한하기 위해 주기적으로 flush
+        auto now = std::chrono::steady_clock::now();
+        if (now - lastFlush > std::chrono::milliseconds(200)) {
+            m_file.flush();
+            lastFlush = now;
+        }
+    }
+}
+
+} // namespace WeaponControl
@@ -0,0 +1,102 @@
+#pragma once
+
+#include "EventLog.h"
+#include "../Diagnostics/MetricsRegistry.h"
+#include <atomic>
+#include <fstream>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace WeaponControl {
+
+// =============================================================================
+// 이벤트 기록기
+//
+// 입력 스레드는 잠금 없는 링 버퍼(Vyukov bounded MPMC 방식, 소비자 1개)에
+// 슬롯을 확보하여 직접 인코딩하고, 백그라운드 기록 스레드가 파일에 쓴다.
+// 링이 가득 차면 입력 경로를 막지 않고 이벤트를 버리며 개수를 집계한다.
+// =============================================================================
+
+class EventRecorder {
+public:
+    explicit EventRecorder(size_t ringCapacity = 4096);
+    ~EventRecorder();
+
+    EventRecorder(const EventRecorder&) = delete;
+    EventRecorder& operator=(const EventRecorder&) = delete;
+
+    Result<void> start(const std::string& path);
+    void stop();    // 링에 남은 이벤트를 모두 쓰고 파일을 닫음
+
+    bool isRecording() const { return m_recording.load(std::memory_order_relaxed); }
+
+    // 이벤트 기록 (payload 는 EventLog.h 의 encode 오버로드가 있는 타입)
+    template<typename T>
+    void record(EventType type, const T& payload) {
+        if (!isRecording()) {
+            return;
+        }
+
+        int64_t timestampNs = ClockProvider::get().now().time_since_epoch().count();
+        uint64_t position = 0;
+        Slot* slot = claimSlot(position);
+        if (!slot) {
+            m_droppedCounter.increment();
+            return;
+        }
+
+        EventEncoder encoder(slot->payload, EVENT_MAX_PAYLOAD);
+        encode(encoder, payload);
+        if (encoder.overflow()) {
+            // 최대 크기 초과 - 빈 페이로드의 레코드는 재생 시 무시됨
+            m_droppedCounter.increment();
+            publishSlot(slot, position, type, 0, timestampNs, true);
+            return;
+        }
+
+        publishSlot(slot, position, type, static_cast<uint16_t>(encoder.size()), timestampNs, false);
+    }
+
+    // 페이로드 없는 이벤트
+    void record(EventType type);
+
+    uint64_t recordedCount() const { return m_recordedCounter.value(); }
+    uint64_t droppedCount() const { return m_droppedCounter.value(); }
+
+private:
+    struct alignas(64) Slot {
+        std::atomic<uint64_t> sequence;
+        EventRecordHeader header;
+        bool discard;
+        uint8_t payload[EVENT_MAX_PAYLOAD];
+    };
+
+    Slot* claimSlot(uint64_t& position);
+    void publishSlot(Slot* slot, uint64_t position, EventType type, uint16_t payloadSize,
+                     int64_t timestampNs, bool discard);
+
+    void writerLoop();
+    size_t drain();
+    size_t bufferBytes() const;    // 링 + 파일 버퍼 (메모리 계정 집계용)
+
+    std::unique_ptr<Slot[]> m_ring;
+    size_t m_capacity;
+    size_t m_mask;
+
+    alignas(64) std::atomic<uint64_t> m_enqueuePosition;
+    alignas(64) uint64_t m_dequeuePosition;
+
+    std::atomic<bool> m_recording;
+    std::atomic<bool> m_writerRunning;
+    std::thread m_writerThread;
+    std::ofstream m_file;
+    std::vector<char> m_fileBuffer;
+
+    MetricCounter& m_recordedCounter;
+    MetricCounter& m_droppedCounter;
+    MetricGauge& m_queueDepthGauge;
+};
+
+} // namespace WeaponControl
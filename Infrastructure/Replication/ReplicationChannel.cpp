@@ -0,0 +1,318 @@
+#include "ReplicationChannel.h"
+#include <cerrno>
+#include <cstring>
+#include <iostream>
+#include <new>
+
+#ifdef __linux__
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace WeaponControl {
+
+namespace {
+
+size_t roundUpToPowerOfTwo(size_t value) {
+    size_t result = 2;
+    while (result < value) {
+        result <<= 1;
+    }
+    return result;
+}
+
+constexpr size_t alignUp(size_t value, size_t alignment) {
+    return (value + alignment - 1) / alignment * alignment;
+}
+
+// 페이로드 없는 레코드용
+struct EmptyPayload {};
+inline void encode(EventEncoder&, const EmptyPayload&) {}
+
+int64_t nowNanoseconds() {
+    return ClockProvider::get().now().time_since_epoch().count();
+}
+
+} // namespace
+
+// =============================================================================
+// ReplicationChannel 구현
+// =============================================================================
+
+ReplicationChannel::ReplicationChannel()
+    : m_header(nullptr)
+    , m_slots(nullptr)
+    , m_size(0)
+    , m_capacity(0)
+    , m_mask(0)
+    , m_producer(false)
+    , m_attachedEpoch(0)
+    , m_attachedNs(0)
+    , m_heartbeatTimeoutNs(0)
+    , m_publishedCounter(MetricsRegistry::getInstance().counter(
+          "replication_records_total", "State deltas published to the standby channel"))
+    , m_droppedCounter(MetricsRegistry::getInstance().counter(
+          "replication_dropped_total", "State deltas dropped because the standby channel was full"))
+    , m_publishDuration(MetricsRegistry::getInstance().histogram(
+          "replication_publish_duration_ns", "Primary-side cost of publishing one state delta in nanoseconds"))
+    , m_resyncCounter(MetricsRegistry::getInstance().counter(
+          "replication_resyncs_total", "Full state retransmissions requested by the standby"))
+    , m_appliedCounter(MetricsRegistry::getInstance().counter(
+          "replication_applied_total", "State deltas applied by the standby"))
+    , m_lagMicroseconds(MetricsRegistry::getInstance().histogram(
+          "replication_lag_us", "Time from publish on the primary to apply on the standby in microseconds"))
+    , m_backlogGauge(MetricsRegistry::getInstance().gauge(
+          "replication_backlog_records", "State deltas published but not yet applied by the standby"))
+{
+}
+
+ReplicationChannel::~ReplicationChannel() {
+    close();
+}
+
+Result<void> ReplicationChannel::create(const ReplicationConfig& config) {
+    return mapChannel(config, true);
+}
+
+Result<void> ReplicationChannel::attach(const ReplicationConfig& config) {
+    return mapChannel(config, false);
+}
+
+Result<void> ReplicationChannel::mapChannel(const ReplicationConfig& config, bool create) {
+    close();
+
+#ifdef __linux__
+    int flags = create ? (O_RDWR | O_CREAT) : O_RDWR;
+    int fd = shm_open(config.channelName.c_str(), flags, 0600);
+    if (fd < 0) {
+        return Result<void>::failure("Cannot open replication channel " + config.channelName + ": " + std::strerror(errno));
+    }
+
+    size_t capacity = roundUpToPowerOfTwo(config.capacity);
+    size_t slotsOffset = alignUp(sizeof(Header), alignof(Slot));
+
+    if (create) {
+        m_size = slotsOffset + capacity * sizeof(Slot);
+        if (ftruncate(fd, static_cast<off_t>(m_size)) != 0) {
+            int error = errno;
+            ::close(fd);
+            return Result<void>::failure("Cannot size replication channel " + config.channelName + ": " + std::strerror(error));
+        }
+    } else {
+        struct stat info;
+        if (fstat(fd, &info) != 0 || static_cast<size_t>(info.st_size) < sizeof(Header)) {
+            ::close(fd);
+            return Result<void>::failure("Replication channel " + config.channelName + " is not initialized");
+        }
+        m_size = static_cast<size_t>(info.st_size);
+    }
+
+    void* mapped = mmap(nullptr, m_size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    int mapError = errno;
+    ::close(fd);
+    if (mapped == MAP_FAILED) {
+        m_size = 0;
+        return Result<void>::failure("Cannot map replication channel " + config.channelName + ": " + std::strerror(mapError));
+    }
+
+    auto base = static_cast<uint8_t*>(mapped);
+    m_header = reinterpret_cast<Header*>(base);
+    m_slots = reinterpret_cast<Slot*>(base + slotsOffset);
+    m_heartbeatTimeoutNs = static_cast<int64_t>(config.heartbeatTimeoutMs) * 1000000;
+
+    if (create) {
+        // 이전 epoch 를 이어받아 대기 측이 주 인스턴스 재시작을 알 수 있도록 함
+        uint64_t previousEpoch = 0;
+        if (std::memcmp(m_header->magic, MAGIC, sizeof(MAGIC)) == 0 && m_header->version == VERSION) {
+            previousEpoch = m_header->epoch.load(std::memory_order_relaxed);
+        }
+
+        new (m_header) Header{};
+        std::memcpy(m_header->magic, MAGIC, sizeof(MAGIC));
+        m_header->version = VERSION;
+        m_header->capacity = static_cast<uint32_t>(capacity);
+        m_header->slotSize = static_cast<uint32_t>(sizeof(Slot));
+        for (size_t i = 0; i < capacity; ++i) {
+            new (&m_slots[i]) Slot{};
+            m_slots[i].sequence.store(i, std::memory_order_relaxed);
+        }
+        m_header->heartbeatNs.store(nowNanoseconds(), std::memory_order_relaxed);
+        m_header->primaryState.store(PRIMARY_RUNNING, std::memory_order_relaxed);
+        m_header->epoch.store(previousEpoch + 1, std::memory_order_release);
+    } else {
+        bool compatible = std::memcmp(m_header->magic, MAGIC, sizeof(MAGIC)) == 0
+                       && m_header->version == VERSION
+                       && m_header->slotSize == sizeof(Slot)
+                       && slotsOffset + static_cast<size_t>(m_header->capacity) * sizeof(Slot) <= m_size;
+        if (!compatible) {
+            close();
+            return Result<void>::failure("Replication channel " + config.channelName + " has an incompatible layout");
+        }
+        capacity = m_header->capacity;
+    }
+
+    m_capacity = capacity;
+    m_mask = capacity - 1;
+    m_producer = create;
+    m_attachedEpoch = m_header->epoch.load(std::memory_order_acquire);
+    m_attachedNs = nowNanoseconds();
+    return Result<void>::success();
+#else
+    (void)config;
+    (void)create;
+    return Result<void>::failure("Replication channel requires POSIX shared memory");
+#endif
+}
+
+void ReplicationChannel::close() {
+#ifdef __linux__
+    if (m_header) {
+        munmap(m_header, m_size);
+    }
+#endif
+    m_header = nullptr;
+    m_slots = nullptr;
+    m_size = 0;
+    m_capacity = 0;
+    m_mask = 0;
+    m_producer = false;
+}
+
+void ReplicationChannel::unlink(const std::string& channelName) {
+#ifdef __linux__
+    shm_unlink(channelName.c_str());
+#else
+    (void)channelName;
+#endif
+}
+
+// =============================================================================
+// 게시
+// =============================================================================
+
+bool ReplicationChannel::publish(ReplicationRecordType type) {
+    return publish(type, EmptyPayload{});
+}
+
+ReplicationChannel::Slot* ReplicationChannel::claimSlot(uint64_t& position) {
+    position = m_header->enqueuePosition.load(std::memory_order_relaxed);
+    for (;;) {
+        Slot* slot = slotAt(position);
+        uint64_t sequence = slot->sequence.load(std::memory_order_acquire);
+        int64_t diff = static_cast<int64_t>(sequence) - static_cast<int64_t>(position);
+
+        if (diff == 0) {
+            if (m_header->enqueuePosition.compare_exchange_weak(position, position + 1, std::memory_order_relaxed)) {
+                return slot;
+            }
+        } else if (diff < 0) {
+            return nullptr;     // 링 가득 참 (대기 측 지연 또는 미연결)
+        } else {
+            position = m_header->enqueuePosition.load(std::memory_order_relaxed);
+        }
+    }
+}
+
+void ReplicationChannel::publishSlot(Slot* slot, uint64_t position, ReplicationRecordType type,
+                                     uint16_t payloadSize, uint64_t generation, bool discard) {
+    slot->header.type = static_cast<uint16_t>(type);
+    slot->header.payloadSize = payloadSize;
+    slot->header.reserved = 0;
+    slot->header.generation = generation;
+    slot->header.timestampNs = nowNanoseconds();
+    slot->discard = discard;
+    slot->sequence.store(position + 1, std::memory_order_release);
+
+    if (!discard) {
+        m_publishedCounter.increment();
+    }
+}
+
+void ReplicationChannel::markOverrun() {
+    m_droppedCounter.increment();
+    m_header->overrun.store(1, std::memory_order_release);
+}
+
+void ReplicationChannel::heartbeat(uint64_t environmentGeneration) {
+    if (!m_producer) {
+        return;
+    }
+    m_header->environmentGeneration.store(environmentGeneration, std::memory_order_relaxed);
+    m_header->tickCount.fetch_add(1, std::memory_order_relaxed);
+    m_header->heartbeatNs.store(nowNanoseconds(), std::memory_order_release);
+}
+
+bool ReplicationChannel::consumeResyncRequest() {
+    if (!m_producer || m_header->resyncRequested.load(std::memory_order_relaxed) == 0) {
+        return false;
+    }
+    if (m_header->resyncRequested.exchange(0, std::memory_order_acq_rel) == 0) {
+        return false;
+    }
+    m_resyncCounter.increment();
+    return true;
+}
+
+void ReplicationChannel::markPrimaryStopped() {
+    if (m_producer) {
+        m_header->primaryState.store(PRIMARY_STOPPED, std::memory_order_release);
+    }
+}
+
+// =============================================================================
+// 소비
+// =============================================================================
+
+size_t ReplicationChannel::discardPending() {
+    return poll([](ReplicationRecordType, uint64_t, EventDecoder) {});
+}
+
+bool ReplicationChannel::consumeOverrun() {
+    if (!isOpen() || m_header->overrun.load(std::memory_order_relaxed) == 0) {
+        return false;
+    }
+    return m_header->overrun.exchange(0, std::memory_order_acq_rel) != 0;
+}
+
+void ReplicationChannel::requestResync() {
+    if (isOpen()) {
+        m_header->resyncRequested.store(1, std::memory_order_release);
+    }
+}
+
+bool ReplicationChannel::isPrimaryLost() const {
+    if (!isOpen()) {
+        return true;
+    }
+    if (m_header->primaryState.load(std::memory_order_acquire) == PRIMARY_STOPPED) {
+        return true;
+    }
+
+    int64_t lastSignal = std::max(m_header->heartbeatNs.load(std::memory_order_acquire), m_attachedNs);
+    return nowNanoseconds() - lastSignal > m_heartbeatTimeoutNs;
+}
+
+bool ReplicationChannel::primaryRestarted() const {
+    return isOpen() && m_header->epoch.load(std::memory_order_acquire) != m_attachedEpoch;
+}
+
+uint64_t ReplicationChannel::backlog() const {
+    if (!isOpen()) {
+        return 0;
+    }
+    uint64_t enqueued = m_header->enqueuePosition.load(std::memory_order_relaxed);
+    uint64_t dequeued = m_header->dequeuePosition.load(std::memory_order_relaxed);
+    return enqueued > dequeued ? enqueued - dequeued : 0;
+}
+
+uint64_t ReplicationChannel::primaryEnvironmentGeneration() const {
+    return isOpen() ? m_header->environmentGeneration.load(std::memory_order_relaxed) : 0;
+}
+
+uint64_t ReplicationChannel::primaryTickCount() const {
+    return isOpen() ? m_header->tickCount.load(std::memory_order_relaxed) : 0;
+}
+
+} // namespace WeaponControl
@@ -0,0 +1,307 @@
+#pragma once
+
+#include "../Recording/EventLog.h"
+#include "../Diagnostics/MetricsRegistry.h"
+#include "../../Common/Utils/Clock.h"
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+namespace WeaponControl {
+
+// =============================================================================
+// 이중화 설정 (SystemConfig::getReplicationConfig 로 생성)
+// =============================================================================
+
+enum class ReplicationRole : uint8_t {
+    NONE = 0,
+    PRIMARY,        // 상태 변경을 채널에 게시
+    STANDBY         // 채널을 적용하여 발사관 관리자를 미러링, 주 인스턴스 정지 시 승격
+};
+
+inline const char* ReplicationRoleName(ReplicationRole role) {
+    switch (role) {
+        case ReplicationRole::PRIMARY: return "primary";
+        case ReplicationRole::STANDBY: return "standby";
+        default: return "none";
+    }
+}
+
+struct ReplicationConfig {
+    ReplicationRole role = ReplicationRole::NONE;
+    std::string channelName = "/weapon_control_replication";   // POSIX 공유 메모리 이름
+    size_t capacity = 2048;                                     // 링 슬롯 수 (2의 거듭제곱으로 올림)
+    uint32_t heartbeatTimeoutMs = 300;                          // 주 인스턴스 주기 신호 제한 시간
+};
+
+// =============================================================================
+// 복제 레코드
+//
+// 페이로드는 EventLog.h 의 인코딩을 그대로 쓴다. 환경 정보(자함/표적/축 중심)
+// 레코드의 generation 은 주 인스턴스의 환경 세대(환경 갱신마다 1 증가),
+// PLAN_VERSION 은 발사관별 교전계획 버전이다.
+// =============================================================================
+
+enum class ReplicationRecordType : uint16_t {
+    RESYNC_BEGIN = 1,       // 전체 상태 재전송 시작 (대기 측 미러 초기화)
+    RESYNC_END,
+    ASSIGN,
+    UNASSIGN,
+    STATE,
+    WAYPOINTS,
+    TARGET,
+    OWN_SHIP,
+    AXIS_CENTER,
+    SELECTED_PLAN,
+    PLAN_VERSION
+};
+
+inline const char* ReplicationRecordTypeName(ReplicationRecordType type) {
+    switch (type) {
+        case ReplicationRecordType::RESYNC_BEGIN: return "RESYNC_BEGIN";
+        case ReplicationRecordType::RESYNC_END: return "RESYNC_END";
+        case ReplicationRecordType::ASSIGN: return "ASSIGN";
+        case ReplicationRecordType::UNASSIGN: return "UNASSIGN";
+        case ReplicationRecordType::STATE: return "STATE";
+        case ReplicationRecordType::WAYPOINTS: return "WAYPOINTS";
+        case ReplicationRecordType::TARGET: return "TARGET";
+        case ReplicationRecordType::OWN_SHIP: return "OWN_SHIP";
+        case ReplicationRecordType::AXIS_CENTER: return "AXIS_CENTER";
+        case ReplicationRecordType::SELECTED_PLAN: return "SELECTED_PLAN";
+        case ReplicationRecordType::PLAN_VERSION: return "PLAN_VERSION";
+        default: return "UNKNOWN";
+    }
+}
+
+#pragma pack(push, 1)
+struct ReplicationRecordHeader {
+    uint16_t type;
+    uint16_t payloadSize;
+    uint32_t reserved;
+    uint64_t generation;
+    int64_t timestampNs;    // 게시 시각 (ClockProvider, 복제 지연 계산용)
+};
+#pragma pack(pop)
+
+static_assert(sizeof(ReplicationRecordHeader) == 24, "ReplicationRecordHeader must be 24 bytes");
+
+// 무장 상태 (launched 는 POST_LAUNCH 여부)
+struct ReplicatedTubeState {
+    uint16_t tubeNumber = 0;
+    EN_WPN_CTRL_STATE state = EN_WPN_CTRL_STATE::WPN_CTRL_STATE_OFF;
+    bool launched = false;
+};
+
+inline void encode(EventEncoder& e, const ReplicatedTubeState& event) {
+    e.put(event.tubeNumber);
+    e.put(event.state);
+    e.put(static_cast<uint8_t>(event.launched));
+}
+
+inline void decode(EventDecoder& d, ReplicatedTubeState& event) {
+    decodeField(d, event.tubeNumber);
+    decodeField(d, event.state);
+    event.launched = d.get<uint8_t>() != 0;
+}
+
+// =============================================================================
+// 이중화 채널 - POSIX 공유 메모리 링
+//
+// [헤더] magic | version | 슬롯 수 | epoch | 게시/소비 위치 | 주 인스턴스 주기 신호
+// [슬롯] 슬롯 sequence(원자) + 레코드 헤더 + 페이로드
+//
+// EventRecorder 와 같은 Vyukov 방식 링이며 위치와 슬롯 sequence 가 모두 공유
+// 메모리에 있으므로 두 프로세스가 잠금 없이 주고받는다. 주 인스턴스는 여러
+// 스레드에서 게시할 수 있고 소비자는 대기 인스턴스 하나이다. 링이 가득 차면
+// 게시를 막지 않고 버린 뒤 overrun 을 표시하며, 대기 측은 이를 보고 전체
+// 재전송(resync)을 요청한다. 주 인스턴스가 채널을 만들고(epoch 증가),
+// 대기 인스턴스는 이미 있는 채널에 연결한다.
+// =============================================================================
+
+class ReplicationChannel {
+public:
+    ReplicationChannel();
+    ~ReplicationChannel();
+
+    ReplicationChannel(const ReplicationChannel&) = delete;
+    ReplicationChannel& operator=(const ReplicationChannel&) = delete;
+
+    // 주 인스턴스: 채널 생성/초기화, 대기 인스턴스: 기존 채널 연결
+    Result<void> create(const ReplicationConfig& config);
+    Result<void> attach(const ReplicationConfig& config);
+
+    // 매핑 해제 (unlink 는 하지 않음 - 상대 프로세스가 계속 사용할 수 있음)
+    void close();
+    static void unlink(const std::string& channelName);
+
+    bool isOpen() const { return m_header != nullptr; }
+    bool isProducer() const { return m_producer; }
+
+    // ==========================================================================
+    // 주 인스턴스 (게시)
+    // ==========================================================================
+    template<typename T>
+    bool publish(ReplicationRecordType type, const T& payload, uint64_t generation = 0) {
+        if (!m_producer) {
+            return false;
+        }
+
+        auto start = std::chrono::steady_clock::now();
+        uint64_t position = 0;
+        Slot* slot = claimSlot(position);
+        if (!slot) {
+            markOverrun();
+            return false;
+        }
+
+        EventEncoder encoder(slot->payload, EVENT_MAX_PAYLOAD);
+        encode(encoder, payload);
+        publishSlot(slot, position, type, encoder.overflow() ? 0 : static_cast<uint16_t>(encoder.size()),
+                    generation, encoder.overflow());
+        if (encoder.overflow()) {
+            markOverrun();
+            return false;
+        }
+
+        m_publishDuration.record(static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(
+            std::chrono::steady_clock::now() - start).count()));
+        return true;
+    }
+
+    bool publish(ReplicationRecordType type);
+
+    // 주기 신호 (주 인스턴스 update 마다) 와 현재 환경 세대
+    void heartbeat(uint64_t environmentGeneration);
+
+    // 대기 측의 재전송 요청 확인 (요청을 소비)
+    bool consumeResyncRequest();
+
+    // 정상 종료 표시 (대기 측은 제한 시간을 기다리지 않고 승격)
+    void markPrimaryStopped();
+
+    // ==========================================================================
+    // 대기 인스턴스 (소비)
+    // ==========================================================================
+
+    // 게시된 레코드를 최대 maxRecords 개까지 순서대로 전달, 처리 수 반환
+    template<typename Handler>
+    size_t poll(Handler&& handler, size_t maxRecords = static_cast<size_t>(-1)) {
+        if (!isOpen() || m_producer) {
+            return 0;
+        }
+
+        size_t applied = 0;
+        int64_t nowNs = ClockProvider::get().now().time_since_epoch().count();
+        while (applied < maxRecords) {
+            uint64_t position = m_header->dequeuePosition.load(std::memory_order_relaxed);
+            Slot* slot = slotAt(position);
+            if (slot->sequence.load(std::memory_order_acquire) != position + 1) {
+                break;      // 아직 게시되지 않음
+            }
+
+            if (!slot->discard) {
+                int64_t lagNs = nowNs - slot->header.timestampNs;
+                m_lagMicroseconds.record(lagNs > 0 ? static_cast<uint64_t>(lagNs / 1000) : 0);
+                handler(static_cast<ReplicationRecordType>(slot->header.type), slot->header.generation,
+                        EventDecoder(slot->payload, slot->header.payloadSize));
+                ++applied;
+            }
+
+            slot->sequence.store(position + m_capacity, std::memory_order_release);
+            m_header->dequeuePosition.store(position + 1, std::memory_order_release);
+        }
+
+        if (applied > 0) {
+            m_appliedCounter.increment(applied);
+        }
+        m_backlogGauge.set(static_cast<int64_t>(backlog()));
+        return applied;
+    }
+
+    // 연결 직후 남아 있는 레코드 폐기 (이후 resync 로 전체 상태 수신)
+    size_t discardPending();
+
+    // overrun 이 표시되어 있으면 지우고 true (대기 측은 resync 요청)
+    bool consumeOverrun();
+    void requestResync();
+
+    // 주 인스턴스가 정상 종료했거나 주기 신호가 제한 시간보다 오래됨
+    bool isPrimaryLost() const;
+
+    // 주 인스턴스가 채널을 다시 만들었는지 (연결 이후 epoch 변경)
+    bool primaryRestarted() const;
+
+    // ==========================================================================
+    // 조회
+    // ==========================================================================
+    uint64_t backlog() const;                   // 게시되었으나 적용되지 않은 레코드
+    uint64_t primaryEnvironmentGeneration() const;
+    uint64_t primaryTickCount() const;
+    size_t capacity() const { return m_capacity; }
+    size_t mappedBytes() const { return m_size; }
+
+private:
+    static constexpr char MAGIC[8] = {'W', 'C', 'R', 'E', 'P', 'L', '0', '1'};
+    static constexpr uint32_t VERSION = 1;
+
+    enum PrimaryState : uint32_t { PRIMARY_RUNNING = 1, PRIMARY_STOPPED = 2 };
+
+    struct Header {
+        char magic[8];
+        uint32_t version;
+        uint32_t capacity;
+        uint32_t slotSize;
+        uint32_t reserved;
+        std::atomic<uint64_t> epoch;
+
+        alignas(64) std::atomic<uint64_t> enqueuePosition;
+        alignas(64) std::atomic<uint64_t> dequeuePosition;
+
+        alignas(64) std::atomic<int64_t> heartbeatNs;
+        std::atomic<uint64_t> tickCount;
+        std::atomic<uint64_t> environmentGeneration;
+        std::atomic<uint32_t> primaryState;
+        std::atomic<uint32_t> overrun;
+        std::atomic<uint32_t> resyncRequested;
+    };
+
+    struct alignas(64) Slot {
+        std::atomic<uint64_t> sequence;
+        ReplicationRecordHeader header;
+        bool discard;
+        uint8_t payload[EVENT_MAX_PAYLOAD];
+    };
+
+    static_assert(std::atomic<uint64_t>::is_always_lock_free, "Shared memory ring requires lock-free 64-bit atomics");
+    static_assert(std::atomic<uint32_t>::is_always_lock_free, "Shared memory ring requires lock-free 32-bit atomics");
+
+    Result<void> mapChannel(const ReplicationConfig& config, bool create);
+
+    Slot* slotAt(uint64_t position) const { return &m_slots[position & m_mask]; }
+    Slot* claimSlot(uint64_t& position);
+    void publishSlot(Slot* slot, uint64_t position, ReplicationRecordType type, uint16_t payloadSize,
+                     uint64_t generation, bool discard);
+    void markOverrun();
+
+    Header* m_header;
+    Slot* m_slots;
+    size_t m_size;
+    size_t m_capacity;
+    size_t m_mask;
+    bool m_producer;
+    uint64_t m_attachedEpoch;
+    int64_t m_attachedNs;               // 연결 시각 (주기 신호가 아직 없을 때 기준)
+    int64_t m_heartbeatTimeoutNs;
+
+    MetricCounter& m_publishedCounter;
+    MetricCounter& m_droppedCounter;
+    MetricHistogram& m_publishDuration;
+    MetricCounter& m_resyncCounter;
+    MetricCounter& m_appliedCounter;
+    MetricHistogram& m_lagMicroseconds;
+    MetricGauge& m_backlogGauge;
+};
+
+} // namespace WeaponControl
@@ -0,0 +1,66 @@
+#include "BenchSupport.h"
+#include <cstdlib>
+#include <new>
+
+#ifdef __GLIBC__
+#include <malloc.h>
+#endif
+
+// =============================================================================
+// 전역 operator new/delete 교체 - 벤치마크 실행 파일마다 한 번만 링크
+// =============================================================================
+
+namespace WeaponControl {
+namespace Bench {
+
+AllocationCounters& allocationCounters() {
+    static AllocationCounters counters;
+    return counters;
+}
+
+} // namespace Bench
+} // namespace WeaponControl
+
+namespace {
+
+void* countedAllocate(std::size_t size) {
+    auto& counters = WeaponControl::Bench::allocationCounters();
+    counters.allocations.fetch_add(1, std::memory_order_relaxed);
+    counters.bytes.fetch_add(size, std::memory_order_relaxed);
+
+    void* ptr = std::malloc(size == 0 ? 1 : size);
+    if (!ptr) {
+        throw std::bad_alloc();
+    }
+#ifdef __GLIBC__
+    counters.liveBytes.fetch_add(static_cast<int64_t>(malloc_usable_size(ptr)), std::memory_order_relaxed);
+#endif
+    return ptr;
+}
+
+void countedFree(void* ptr) {
+    if (ptr) {
+        auto& counters = WeaponControl::Bench::allocationCounters();
+        counters.deallocations.fetch_add(1, std::memory_order_relaxed);
+#ifdef __GLIBC__
+        counters.liveBytes.fetch_sub(static_cast<int64_t>(malloc_usable_size(ptr)), std::memory_order_relaxed);
+#endif
+        std::free(ptr);
+    }
+}
+
+} // namespace
+
+void* operator new(std::size_t size) { return countedAllocate(size); }
+void* operator new[](std::size_t size) { return countedAllocate(size); }
+void* operator new(std::size_t size, const std::nothrow_t&) noexcept {
+    try { return countedAllocate(size); } catch (...) { return nullptr; }
+}
+void* operator new[](std::size_t size, const std::nothrow_t&) noexcept {
+    try { return countedAllocate(size); } catch (...) { return nullptr; }
+}
+
+void operator delete(void* ptr) noexcept { countedFree(ptr); }
+void operator delete[](void* ptr) noexcept { countedFree(ptr); }
+void operator delete(void* ptr, std::size_t) noexcept { countedFree(ptr); }
+void operator delete[](void* ptr, std::size_t) noexcept { countedFree(ptr); }
@@ -0,0 +1,461 @@
+#pragma once
+
+#include "../Core/Service/WeaponControlService.h"
+#include "../Infrastructure/Configuration/SystemConfig.h"
+#include "../Common/Utils/Clock.h"
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <functional>
+#include <iomanip>
+#include <iostream>
+#include <limits>
+#include <memory>
+#include <sstream>
+#include <streambuf>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+#ifdef __linux__
+#include <linux/perf_event.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#include <cstring>
+#endif
+
+namespace WeaponControl {
+namespace Bench {
+
+// =============================================================================
+// 할당 카운터 (AllocationHooks.cpp 의 operator new/delete 교체로 집계)
+// =============================================================================
+
+struct AllocationCounters {
+    std::atomic<uint64_t> allocations{0};
+    std::atomic<uint64_t> deallocations{0};
+    std::atomic<uint64_t> bytes{0};
+    std::atomic<int64_t> liveBytes{0};      // 현재 할당 중인 바이트 (malloc 실제 크기, glibc 전용)
+};
+
+AllocationCounters& allocationCounters();
+
+struct AllocationSample {
+    uint64_t allocations;
+    uint64_t bytes;
+
+    static AllocationSample now() {
+        auto& counters = allocationCounters();
+        return {counters.allocations.load(std::memory_order_relaxed),
+                counters.bytes.load(std::memory_order_relaxed)};
+    }
+};
+
+// =============================================================================
+// 캐시 미스 카운터 (Linux perf_event, 사용 불가 시 비활성)
+// =============================================================================
+
+class CacheMissCounter {
+public:
+    CacheMissCounter() : m_fd(-1) {
+#ifdef __linux__
+        perf_event_attr attr;
+        std::memset(&attr, 0, sizeof(attr));
+        attr.type = PERF_TYPE_HARDWARE;
+        attr.size = sizeof(attr);
+        attr.config = PERF_COUNT_HW_CACHE_MISSES;
+        attr.disabled = 1;
+        attr.exclude_kernel = 1;
+        attr.exclude_hv = 1;
+        m_fd = static_cast<int>(syscall(__NR_perf_event_open, &attr, 0, -1, -1, 0));
+#endif
+    }
+
+    ~CacheMissCounter() {
+#ifdef __linux__
+        if (m_fd >= 0) {
+            close(m_fd);
+        }
+#endif
+    }
+
+    CacheMissCounter(const CacheMissCounter&) = delete;
+    CacheMissCounter& operator=(const CacheMissCounter&) = delete;
+
+    bool isAvailable() const { return m_fd >= 0; }
+
+    void start() {
+#ifdef __linux__
+        if (m_fd >= 0) {
+            ioctl(m_fd, PERF_EVENT_IOC_RESET, 0);
+            ioctl(m_fd, PERF_EVENT_IOC_ENABLE, 0);
+        }
+#endif
+    }
+
+    uint64_t stop() {
+        uint64_t value = 0;
+#ifdef __linux__
+        if (m_fd >= 0) {
+            ioctl(m_fd, PERF_EVENT_IOC_DISABLE, 0);
+            if (read(m_fd, &value, sizeof(value)) != static_cast<ssize_t>(sizeof(value))) {
+                value = 0;
+            }
+        }
+#endif
+        return value;
+    }
+
+private:
+    int m_fd;
+};
+
+// =============================================================================
+// 측정 중 콘솔 로그 억제 (핵심 경로의 std::cout 출력이 측정을 왜곡하지 않도록)
+// =============================================================================
+
+class ScopedCoutSilencer {
+public:
+    ScopedCoutSilencer() : m_previous(std::cout.rdbuf(&m_null)) {}
+    ~ScopedCoutSilencer() { std::cout.rdbuf(m_previous); }
+
+    ScopedCoutSilencer(const ScopedCoutSilencer&) = delete;
+    ScopedCoutSilencer& operator=(const ScopedCoutSilencer&) = delete;
+
+private:
+    class NullBuffer : public std::streambuf {
+    protected:
+        int overflow(int c) override { return traits_type::not_eof(c); }
+        std::streamsize xsputn(const char*, std::streamsize n) override { return n; }
+    };
+
+    NullBuffer m_null;
+    std::streambuf* m_previous;
+};
+
+// =============================================================================
+// 지연 시간 분포 (p50/p99/p99.9/max)
+// =============================================================================
+
+struct LatencyStats {
+    size_t count = 0;
+    double p50_us = 0.0;
+    double p99_us = 0.0;
+    double p999_us = 0.0;
+    double max_us = 0.0;
+
+    // samples 는 정렬됨
+    static LatencyStats fromSamples(std::vector<double>& samples) {
+        LatencyStats stats;
+        stats.count = samples.size();
+        if (samples.empty()) {
+            return stats;
+        }
+
+        std::sort(samples.begin(), samples.end());
+        auto percentile = [&](double p) {
+            size_t index = static_cast<size_t>(p * (samples.size() - 1) + 0.5);
+            return samples[std::min(index, samples.size() - 1)];
+        };
+
+        stats.p50_us = percentile(0.50);
+        stats.p99_us = percentile(0.99);
+        stats.p999_us = percentile(0.999);
+        stats.max_us = samples.back();
+        return stats;
+    }
+};
+
+// =============================================================================
+// 벤치마크 결과 및 실행기
+// =============================================================================
+
+struct BenchmarkResult {
+    std::string name;
+    uint64_t iterations;
+    double nsPerOp;
+    double allocationsPerOp;
+    double bytesPerOp;
+    double cacheMissesPerOp;   // 음수면 측정 불가
+};
+
+class BenchmarkRunner {
+public:
+    explicit BenchmarkRunner(double scale = 1.0) : m_scale(scale) {}
+
+    // fn 을 iterations 회 실행하여 ns/op, 할당/op, 캐시미스/op 를 기록
+    const BenchmarkResult& run(const std::string& name, uint64_t iterations, const std::function<void()>& fn) {
+        iterations = std::max<uint64_t>(1, static_cast<uint64_t>(iterations * m_scale));
+
+        // 워밍업 (캐시, 지연 초기화, 컨테이너 용량 확보)
+        {
+            ScopedCoutSilencer silencer;
+            for (uint64_t i = 0; i < std::min<uint64_t>(iterations / 10 + 1, 1000); ++i) {
+                fn();
+            }
+        }
+
+        BenchmarkResult result;
+        result.name = name;
+        result.iterations = iterations;
+
+        {
+            ScopedCoutSilencer silencer;
+            auto allocBefore = AllocationSample::now();
+            m_cacheMisses.start();
+            auto start = std::chrono::steady_clock::now();
+
+            for (uint64_t i = 0; i < iterations; ++i) {
+                fn();
+            }
+
+            auto end = std::chrono::steady_clock::now();
+            uint64_t misses = m_cacheMisses.stop();
+            auto allocAfter = AllocationSample::now();
+
+            double ops = static_cast<double>(iterations);
+            result.nsPerOp = std::chrono::duration<double, std::nano>(end - start).count() / ops;
+            result.allocationsPerOp = (allocAfter.allocations - allocBefore.allocations) / ops;
+            result.bytesPerOp = (allocAfter.bytes - allocBefore.bytes) / ops;
+            result.cacheMissesPerOp = m_cacheMisses.isAvailable() ? misses / ops : -1.0;
+        }
+
+        m_results.push_back(result);
+        printResult(m_results.back());
+        return m_results.back();
+    }
+
+    const std::vector<BenchmarkResult>& results() const { return m_results; }
+
+    static void printHeader() {
+        std::cout << std::left << std::setw(48) << "benchmark"
+                  << std::right << std::setw(14) << "ns/op"
+                  << std::setw(12) << "allocs/op"
+                  << std::setw(12) << "bytes/op"
+                  << std::setw(14) << "misses/op" << std::endl;
+    }
+
+    static void printResult(const BenchmarkResult& r) {
+        std::cout << std::left << std::setw(48) << r.name
+                  << std::right << std::fixed << std::setprecision(1)
+                  << std::setw(14) << r.nsPerOp
+                  << std::setw(12) << std::setprecision(2) << r.allocationsPerOp
+                  << std::setw(12) << std::setprecision(1) << r.bytesPerOp;
+        if (r.cacheMissesPerOp >= 0.0) {
+            std::cout << std::setw(14) << std::setprecision(2) << r.cacheMissesPerOp;
+        } else {
+            std::cout << std::setw(14) << "n/a";
+        }
+        std::cout << std::defaultfloat << std::endl;
+    }
+
+    // 릴리스 간 회귀 추적용 JSON 출력
+    bool writeJson(const std::string& path, const std::string& suite) const {
+        std::ofstream file(path);
+        if (!file.is_open()) {
+            return false;
+        }
+
+        auto timestamp = std::chrono::duration_cast<std::chrono::seconds>(
+            std::chrono::system_clock::now().time_since_epoch()).count();
+
+        file << "{\n";
+        file << "  \"suite\": \"" << suite << "\",\n";
+        file << "  \"schemaVersion\": 1,\n";
+        file << "  \"timestamp\": " << timestamp << ",\n";
+        file << "  \"cacheMissesAvailable\": " << (m_cacheMisses.isAvailable() ? "true" : "false") << ",\n";
+        file << "  \"results\": [\n";
+
+        for (size_t i = 0; i < m_results.size(); ++i) {
+            const auto& r = m_results[i];
+            file << "    {\"name\": \"" << r.name << "\""
+                 << ", \"iterations\": " << r.iterations
+                 << ", \"nsPerOp\": " << r.nsPerOp
+                 << ", \"allocationsPerOp\": " << r.allocationsPerOp
+                 << ", \"bytesPerOp\": " << r.bytesPerOp
+                 << ", \"cacheMissesPerOp\": ";
+            if (r.cacheMissesPerOp >= 0.0) {
+                file << r.cacheMissesPerOp;
+            } else {
+                file << "null";
+            }
+            file << "}" << (i + 1 < m_results.size() ? "," : "") << "\n";
+        }
+
+        file << "  ]\n";
+        file << "}\n";
+        return true;
+    }
+
+private:
+    double m_scale;
+    CacheMissCounter m_cacheMisses;
+    std::vector<BenchmarkResult> m_results;
+};
+
+// =============================================================================
+// 명령행 옵션 ("--이름 값" 쌍, 알 수 없는 옵션은 경고 후 무시)
+// =============================================================================
+
+class OptionParser {
+public:
+    // 정수/실수 옵션 (minimum 보다 작은 값은 minimum 으로)
+    template<typename T>
+    OptionParser& add(const std::string& name, T& target,
+                      std::common_type_t<T> minimum = std::numeric_limits<T>::lowest()) {
+        static_assert(std::is_arithmetic_v<T>, "numeric option expected");
+        return add(name, [&target, minimum](const std::string& value) {
+            if constexpr (std::is_floating_point_v<T>) {
+                target = std::max(minimum, static_cast<T>(std::stod(value)));
+            } else {
+                target = std::max(minimum, static_cast<T>(std::stoull(value)));
+            }
+        });
+    }
+
+    // 0|1 옵션
+    OptionParser& add(const std::string& name, bool& target) {
+        return add(name, [&target](const std::string& value) { target = (value != "0"); });
+    }
+
+    OptionParser& add(const std::string& name, std::string& target) {
+        return add(name, [&target](const std::string& value) { target = value; });
+    }
+
+    // 목록 등 직접 해석하는 옵션
+    OptionParser& add(const std::string& name, std::function<void(const std::string&)> handler) {
+        m_options.push_back({name, std::move(handler)});
+        return *this;
+    }
+
+    void parse(int argc, char* argv[]) const {
+        for (int i = 1; i + 1 < argc; i += 2) {
+            std::string arg = argv[i];
+            auto option = std::find_if(m_options.begin(), m_options.end(),
+                                       [&](const Option& candidate) { return candidate.name == arg; });
+            if (option == m_options.end()) {
+                std::cerr << "Unknown option: " << arg << std::endl;
+                continue;
+            }
+            option->handler(argv[i + 1]);
+        }
+    }
+
+private:
+    struct Option {
+        std::string name;
+        std::function<void(const std::string&)> handler;
+    };
+
+    std::vector<Option> m_options;
+};
+
+// =============================================================================
+// 서비스 시나리오 환경
+//
+// 가상 시각(대기 시 자동 진행)을 이 스레드의 시계로 설정하고, 전원 인가/발사
+// 지연을 0 으로 두며, 이름별 임시 디렉터리(부설계획 저장소, 체크포인트 파일
+// 등)를 만들고 소멸 시 지운다. 서비스보다 먼저 만들어 나중에 소멸해야 한다.
+// =============================================================================
+
+class ServiceFixture {
+public:
+    explicit ServiceFixture(const std::string& name)
+        : m_clockOverride(m_clock)
+        , m_root(std::filesystem::temp_directory_path() / ("weapon_control_" + name)) {
+        SystemConfig::getInstance().set("Weapon.DefaultLaunchDelay", "0");
+        std::filesystem::remove_all(m_root);
+        std::filesystem::create_directories(m_root);
+    }
+
+    ~ServiceFixture() {
+        std::error_code error;
+        std::filesystem::remove_all(m_root, error);
+    }
+
+    ServiceFixture(const ServiceFixture&) = delete;
+    ServiceFixture& operator=(const ServiceFixture&) = delete;
+
+    VirtualClock& clock() { return m_clock; }
+
+    std::string path(const std::string& leaf) const { return (m_root / leaf).string(); }
+
+    std::unique_ptr<WeaponControlService> makeService(uint16_t tubes, const std::string& dataLeaf = "mine_plans") const {
+        return std::make_unique<WeaponControlService>(
+            std::make_unique<LaunchTubeManager>(tubes),
+            std::make_unique<TargetTrackingService>(),
+            std::make_unique<MineDropPlanService>(path(dataLeaf)));
+    }
+
+private:
+    VirtualClock m_clock{true};
+    ClockProvider::ScopedOverride m_clockOverride;
+    std::filesystem::path m_root;
+};
+
+// -----------------------------------------------------------------------------
+// 시나리오 메시지
+// -----------------------------------------------------------------------------
+
+// 발사관 번호로 유도탄 종류를 돌려 배정 (ALM/ASM/AAM)
+inline EN_WPN_KIND missileKindForTube(uint16_t tube) {
+    switch (tube % 3) {
+        case 0: return EN_WPN_KIND::WPN_KIND_ALM;
+        case 1: return EN_WPN_KIND::WPN_KIND_ASM;
+        default: return EN_WPN_KIND::WPN_KIND_AAM;
+    }
+}
+
+inline WeaponAssignmentRequest makeAssignment(uint16_t tube, uint32_t targetId, EN_WPN_KIND kind) {
+    WeaponAssignmentRequest request;
+    request.tubeNumber = tube;
+    request.weaponKind = kind;
+    request.assignmentInfo.tubeNumber = tube;
+    request.assignmentInfo.weaponKind = kind;
+    request.assignmentInfo.systemTargetId = targetId;
+    return request;
+}
+
+inline WeaponAssignmentRequest makeAssignment(uint16_t tube, uint32_t targetId) {
+    return makeAssignment(tube, targetId, missileKindForTube(tube));
+}
+
+// 표적별 기준 위치 주변을 phase 에 따라 도는 항적
+inline TRKMGR_SYSTEMTARGET_INFO makeTrack(uint32_t targetId, double phase) {
+    TRKMGR_SYSTEMTARGET_INFO track;
+    track.unTargetSystemID() = targetId;
+    track.stGeodeticPosition().dLatitude() = 35.0 + targetId * 0.01 + 0.001 * std::sin(phase);
+    track.stGeodeticPosition().dLongitude() = 129.0 + 0.001 * std::cos(phase);
+    track.stGeodeticPosition().fDepth() = 0.0f;
+    return track;
+}
+
+inline WaypointUpdateRequest makeWaypoints(uint16_t tube, size_t count) {
+    WaypointUpdateRequest request;
+    request.tubeNumber = tube;
+    request.waypoints.resize(count);
+    for (size_t i = 0; i < count; ++i) {
+        request.waypoints[i].dLatitude() = 35.0 + 0.002 * (i + 1);
+        request.waypoints[i].dLongitude() = 129.0 + 0.002 * (i + 1);
+        request.waypoints[i].fDepth() = 0.0f;
+    }
+    return request;
+}
+
+// 발사관 1..N 에 유도탄을 할당하고 같은 번호 표적의 항적을 넣는다.
+// 관리자는 표적 번호가 할당된 뒤 들어온 항적만 받으므로 할당을 먼저 한다.
+inline void assignMissiles(WeaponControlService& service, uint16_t tubes, double phase = 0.0) {
+    ScopedCoutSilencer silencer;
+    for (uint16_t tube = 1; tube <= tubes; ++tube) {
+        service.assignWeapon(makeAssignment(tube, tube));
+        service.updateTargetInfo(makeTrack(tube, phase));
+    }
+}
+
+} // namespace Bench
+} // namespace WeaponControl
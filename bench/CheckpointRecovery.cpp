@@ -0,0 +1,303 @@
+// =============================================================================
+// 상태 체크포인트 복구 벤치마크
+//
+// 1) 체크포인트 기록 비용: StateCheckpoint 레코드 기록(상태/표적/경로점)과
+//    상태 전이 명령(controlWeapon ON/OFF)의 체크포인트 유무별 비용
+// 2) 재시작 복원: 할당/경로점/전원 인가/절반 발사 후 서비스를 종료 절차 없이
+//    버리고 새 인스턴스가 같은 파일에서 복원하는 시간, 복원 결과 검증
+//    (할당/무장 종류/발사 여부, 상태는 RestoredWeaponState 규칙 적용)
+// 3) 기록 중단 레코드: 발사관 1 레코드를 기록 중 상태로 만든 뒤 복원하여
+//    해당 레코드만 버려지는지 확인
+//
+// 사용법: CheckpointRecovery [옵션]
+//   --tubes N        발사관 수 (기본 24)
+//   --targets M      시스템 표적 수 (기본 64)
+//   --iterations N   기록 비용 측정 반복 수 (기본 200000)
+//   --sync 0|1       기록마다 변경 페이지 msync(MS_ASYNC) (기본 0)
+//
+// 복원 결과가 기대와 다르거나 기록 중단 레코드가 복원되면 종료 코드 1.
+// =============================================================================
+
+#include "BenchSupport.h"
+#include "../Infrastructure/Persistence/StateCheckpoint.h"
+#include <filesystem>
+#include <fstream>
+#include <string>
+
+using namespace WeaponControl;
+using namespace WeaponControl::Bench;
+
+namespace {
+
+// -----------------------------------------------------------------------------
+// 설정
+// -----------------------------------------------------------------------------
+
+struct BenchConfig {
+    uint16_t tubes = 24;
+    uint32_t targets = 64;
+    uint64_t iterations = 200000;
+    bool syncWrites = false;
+};
+
+BenchConfig parseArguments(int argc, char* argv[]) {
+    BenchConfig config;
+    OptionParser()
+        .add("--tubes", config.tubes, 2)
+        .add("--targets", config.targets, 1)
+        .add("--iterations", config.iterations)
+        .add("--sync", config.syncWrites)
+        .parse(argc, argv);
+    return config;
+}
+
+// -----------------------------------------------------------------------------
+// 기록 비용
+// -----------------------------------------------------------------------------
+
+void measureWriteCost(const BenchConfig& config, const ServiceFixture& fixture, const std::string& checkpointPath) {
+    StateCheckpointConfig checkpointConfig;
+    checkpointConfig.path = checkpointPath;
+    checkpointConfig.maxTargets = config.targets;
+    checkpointConfig.syncWrites = config.syncWrites;
+
+    BenchmarkRunner::printHeader();
+    BenchmarkRunner runner;
+
+    {
+        StateCheckpoint checkpoint;
+        auto openResult = checkpoint.open(checkpointConfig, config.tubes);
+        if (!openResult) {
+            std::cerr << "Checkpoint open failed: " << openResult.error().message << std::endl;
+            return;
+        }
+
+        checkpoint.writeTubeState(makeAssignment(1, 1), EN_WPN_CTRL_STATE::WPN_CTRL_STATE_OFF, false);
+        auto track = makeTrack(1, 0.0);
+        auto waypoints = makeWaypoints(1, 8);
+        uint64_t counter = 0;
+
+        runner.run("StateCheckpoint::updateTubeState", config.iterations, [&]() {
+            bool on = (++counter & 1) != 0;
+            checkpoint.updateTubeState(1, on ? EN_WPN_CTRL_STATE::WPN_CTRL_STATE_ON : EN_WPN_CTRL_STATE::WPN_CTRL_STATE_OFF, false);
+        });
+        runner.run("StateCheckpoint::writeTubeState", config.iterations, [&]() {
+            checkpoint.writeTubeState(makeAssignment(1, 1), EN_WPN_CTRL_STATE::WPN_CTRL_STATE_ON, false);
+        });
+        runner.run("StateCheckpoint::writeTarget", config.iterations, [&]() {
+            track.unTargetSystemID() = static_cast<uint32_t>(++counter % config.targets + 1);
+            checkpoint.writeTarget(track);
+        });
+        runner.run("StateCheckpoint::writeWaypoints (8)", config.iterations, [&]() {
+            checkpoint.writeWaypoints(1, waypoints.waypoints);
+        });
+    }
+
+    // 상태 전이 명령: ON(POC -> ON) + OFF = 전이 3회
+    double transitionNs[2] = {0.0, 0.0};
+    for (int withCheckpoint = 0; withCheckpoint < 2; ++withCheckpoint) {
+        std::unique_ptr<WeaponControlService> service;
+        {
+            ScopedCoutSilencer silencer;
+            service = fixture.makeService(config.tubes);
+            service->initialize();
+            if (withCheckpoint) {
+                std::filesystem::remove(checkpointPath);
+                service->enableStateCheckpoint(checkpointConfig);
+            }
+            service->assignWeapon(makeAssignment(1, 1));
+        }
+
+        WeaponControlRequest on;
+        on.tubeNumber = 1;
+        on.targetState = EN_WPN_CTRL_STATE::WPN_CTRL_STATE_ON;
+        WeaponControlRequest off = on;
+        off.targetState = EN_WPN_CTRL_STATE::WPN_CTRL_STATE_OFF;
+
+        const auto& result = runner.run(withCheckpoint ? "controlWeapon ON+OFF (checkpoint)" : "controlWeapon ON+OFF (no checkpoint)",
+                                        config.iterations / 10, [&]() {
+            service->controlWeapon(on);
+            service->controlWeapon(off);
+        });
+        transitionNs[withCheckpoint] = result.nsPerOp / 3.0;
+
+        ScopedCoutSilencer silencer;
+        service->shutdown();
+    }
+
+    std::cout << "  -> checkpoint overhead per state transition: " << std::fixed << std::setprecision(1)
+              << transitionNs[1] - transitionNs[0] << " ns (" << transitionNs[0] << " -> " << transitionNs[1]
+              << " ns)" << std::defaultfloat << std::endl;
+}
+
+// -----------------------------------------------------------------------------
+// 재시작 복원
+// -----------------------------------------------------------------------------
+
+struct TubeSnapshot {
+    bool hasWeapon = false;
+    EN_WPN_KIND weaponKind = EN_WPN_KIND::WPN_KIND_NA;
+    EN_WPN_CTRL_STATE state = EN_WPN_CTRL_STATE::WPN_CTRL_STATE_OFF;
+    bool launched = false;
+};
+
+std::vector<TubeSnapshot> snapshotTubes(const WeaponControlService& service) {
+    std::vector<TubeSnapshot> snapshot;
+    for (const auto& status : service.getAllTubeStatus()) {
+        snapshot.push_back(TubeSnapshot{status.hasWeapon, status.weaponKind, status.weaponState, status.launched});
+    }
+    return snapshot;
+}
+
+// 복원 규칙을 적용한 기대값과 비교하여 불일치 수 반환
+size_t compareRestored(const std::vector<TubeSnapshot>& before, const std::vector<TubeSnapshot>& after) {
+    size_t mismatches = 0;
+    for (size_t i = 0; i < before.size() && i < after.size(); ++i) {
+        const auto& expected = before[i];
+        const auto& actual = after[i];
+        EN_WPN_CTRL_STATE expectedState = expected.hasWeapon
+            ? RestoredWeaponState(expected.state, expected.launched)
+            : EN_WPN_CTRL_STATE::WPN_CTRL_STATE_OFF;
+
+        // RTL 은 ON 으로 복원된 뒤 다음 주기 인터록 확인에서 다시 RTL 이 될 수 있음
+        bool stateMatches = actual.state == expectedState
+            || (expected.state == EN_WPN_CTRL_STATE::WPN_CTRL_STATE_RTL && actual.state == EN_WPN_CTRL_STATE::WPN_CTRL_STATE_RTL);
+
+        if (actual.hasWeapon != expected.hasWeapon || actual.weaponKind != expected.weaponKind
+            || actual.launched != expected.launched || !stateMatches) {
+            std::cout << "  mismatch tube " << i + 1 << ": expected " << WeaponKindToString(expected.weaponKind)
+                      << " " << StateToString(expectedState) << ", restored " << WeaponKindToString(actual.weaponKind)
+                      << " " << StateToString(actual.state) << std::endl;
+            ++mismatches;
+        }
+    }
+    return mismatches + (before.size() != after.size() ? 1 : 0);
+}
+
+void printReport(const char* label, const CheckpointRestoreReport& report) {
+    std::cout << "  " << std::left << std::setw(14) << label << std::right
+              << std::setw(8) << report.tubes << std::setw(10) << report.targets
+              << std::setw(8) << report.failedTubes << std::setw(11) << report.discardedRecords
+              << std::setw(10) << std::fixed << std::setprecision(3) << report.loadMilliseconds
+              << std::setw(12) << report.restoreMilliseconds << std::defaultfloat << std::endl;
+}
+
+} // namespace
+
+int main(int argc, char* argv[]) {
+    auto config = parseArguments(argc, argv);
+
+    ServiceFixture fixture("checkpoint");
+    auto& systemConfig = SystemConfig::getInstance();
+    auto checkpointPath = fixture.path("state.ckpt");
+
+    std::cout << "State checkpoint: " << config.tubes << " tubes, " << config.targets << " targets, sync writes "
+              << (config.syncWrites ? "on" : "off") << std::endl << std::endl;
+    measureWriteCost(config, fixture, checkpointPath);
+
+    // initialize() 에서 복원하도록 설정 경로 사용
+    std::filesystem::remove(checkpointPath);
+    systemConfig.set("Checkpoint.Enabled", "true");
+    systemConfig.set("Checkpoint.Path", checkpointPath);
+    systemConfig.set("Checkpoint.MaxTargets", std::to_string(config.targets));
+    systemConfig.set("Checkpoint.SyncWrites", config.syncWrites ? "true" : "false");
+
+    std::vector<TubeSnapshot> before;
+    size_t fileSize = 0;
+    {
+        ScopedCoutSilencer silencer;
+        auto service = fixture.makeService(config.tubes);
+        service->initialize();
+
+        for (uint32_t target = 1; target <= config.targets; ++target) {
+            service->updateTargetInfo(makeTrack(target, 0.0));
+        }
+        for (uint16_t tube = 1; tube <= config.tubes; ++tube) {
+            service->assignWeapon(makeAssignment(tube, (tube - 1) % config.targets + 1));
+            if (tube % 4 == 0) {
+                service->updateWaypoints(makeWaypoints(tube, 6));
+            }
+        }
+
+        // 발사관 4개 중 3개 전원 인가, 홀수 발사관 중 일부 발사, 마지막 발사관은 미할당
+        WeaponControlRequest control;
+        control.targetState = EN_WPN_CTRL_STATE::WPN_CTRL_STATE_ON;
+        for (uint16_t tube = 1; tube <= config.tubes; ++tube) {
+            if (tube % 4 != 2) {
+                control.tubeNumber = tube;
+                service->controlWeapon(control);
+            }
+        }
+        service->update();
+        control.targetState = EN_WPN_CTRL_STATE::WPN_CTRL_STATE_LAUNCH;
+        for (uint16_t tube = 1; tube <= config.tubes; tube += 4) {
+            control.tubeNumber = tube;
+            service->controlWeapon(control);
+        }
+        service->unassignWeapon(config.tubes);
+        service->update();
+
+        before = snapshotTubes(*service);
+        fileSize = std::filesystem::file_size(checkpointPath);
+        // 종료 절차 없이 폐기 (비정상 종료 후 재시작 모사)
+    }
+
+    std::cout << std::endl << "Restart recovery (checkpoint file " << fileSize / 1024 << " KB):" << std::endl;
+    std::cout << "  " << std::left << std::setw(14) << "restore" << std::right
+              << std::setw(8) << "tubes" << std::setw(10) << "targets" << std::setw(8) << "failed"
+              << std::setw(11) << "discarded" << std::setw(10) << "load ms" << std::setw(12) << "restore ms" << std::endl;
+
+    size_t mismatches = 0;
+    {
+        std::unique_ptr<WeaponControlService> service;
+        {
+            ScopedCoutSilencer silencer;
+            service = fixture.makeService(config.tubes);
+            service->initialize();
+        }
+        printReport("after restart", service->getCheckpointRestoreReport());
+        mismatches = compareRestored(before, snapshotTubes(*service));
+
+        ScopedCoutSilencer silencer;
+        service->shutdown();
+    }
+
+    // 발사관 1 상태 레코드를 기록 중(홀수 sequence)으로 만든 뒤 복원
+    {
+        std::fstream file(checkpointPath, std::ios::in | std::ios::out | std::ios::binary);
+        uint32_t tornSequence = 7;
+        file.seekp(static_cast<std::streamoff>(sizeof(CheckpointFileHeader)));
+        file.write(reinterpret_cast<const char*>(&tornSequence), sizeof(tornSequence));
+    }
+
+    size_t tornDiscarded = 0;
+    bool tornTubeAssigned = true;
+    {
+        std::unique_ptr<WeaponControlService> service;
+        {
+            ScopedCoutSilencer silencer;
+            service = fixture.makeService(config.tubes);
+            service->initialize();
+        }
+        const auto& report = service->getCheckpointRestoreReport();
+        printReport("torn record", report);
+        tornDiscarded = report.discardedRecords;
+        tornTubeAssigned = service->getTubeStatus(1).hasWeapon;
+
+        ScopedCoutSilencer silencer;
+        service->shutdown();
+    }
+
+    systemConfig.set("Checkpoint.Enabled", "false");
+
+    bool tornHandled = tornDiscarded == 1 && !tornTubeAssigned;
+    std::cout << std::endl;
+    if (mismatches != 0 || !tornHandled) {
+        std::cout << "FAIL: " << mismatches << " restored tube mismatches, torn record "
+                  << (tornHandled ? "discarded" : "not handled") << std::endl;
+        return 1;
+    }
+
+    std::cout << "PASS: restored state matches, torn record discarded" << std::endl;
+    return 0;
+}
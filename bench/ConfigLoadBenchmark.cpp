@@ -0,0 +1,268 @@
+// =============================================================================
+// 설정 파일 적재 벤치마크
+//
+// 생성한 대용량 INI 파일(알려진 키 + 임의 섹션/키)을 기존 방식(getline +
+// trim/substr + "섹션.키" 연결 + std::map)과 SystemConfig::loadFromFile
+// (mmap + string_view 단일 패스 + 알려진 키 완전 해시 슬롯)으로 각각 적재하여
+// 적재 시간, 적재 중 할당 수/바이트, 적재 후 보유 메모리를 비교한다.
+// 마지막으로 스키마 키(get<ConfigKey>)/문자열 키 get 비용을 출력하고, 문자열
+// 키 get 으로 읽은 스키마 키가 범위 검사를 거친 슬롯 값과 같은지 확인한다
+// (다르면 종료 코드 1).
+//
+// 사용법: ConfigLoadBenchmark [옵션]
+//   --entries LIST       파일당 항목 수, 쉼표로 여러 값 (기본 1000,10000,100000)
+//   --keys-per-section N 섹션당 키 수 (기본 32)
+//   --repeat N           크기별 반복 횟수, 중앙값 사용 (기본 5)
+//
+// AllocationHooks.cpp 와 함께 링크해야 메모리 항목이 집계된다.
+// =============================================================================
+
+#include "BenchSupport.h"
+#include "../Infrastructure/Configuration/SystemConfig.h"
+#include <filesystem>
+#include <fstream>
+#include <map>
+#include <sstream>
+#include <string>
+#include <vector>
+
+using namespace WeaponControl;
+using namespace WeaponControl::Bench;
+
+namespace {
+
+using Clock = std::chrono::steady_clock;
+
+// -----------------------------------------------------------------------------
+// 설정
+// -----------------------------------------------------------------------------
+
+struct BenchConfig {
+    std::vector<uint32_t> entryCounts = {1000, 10000, 100000};
+    uint32_t keysPerSection = 32;
+    uint32_t repeat = 5;
+};
+
+std::vector<uint32_t> parseList(const std::string& value) {
+    std::vector<uint32_t> result;
+    std::stringstream stream(value);
+    std::string item;
+    while (std::getline(stream, item, ',')) {
+        if (!item.empty()) {
+            result.push_back(static_cast<uint32_t>(std::stoul(item)));
+        }
+    }
+    return result;
+}
+
+BenchConfig parseArguments(int argc, char* argv[]) {
+    BenchConfig config;
+
+    for (int i = 1; i + 1 < argc; i += 2) {
+        std::string arg = argv[i];
+        std::string value = argv[i + 1];
+
+        if (arg == "--entries") config.entryCounts = parseList(value);
+        else if (arg == "--keys-per-section") config.keysPerSection = std::max(1u, static_cast<uint32_t>(std::stoul(value)));
+        else if (arg == "--repeat") config.repeat = std::max(1u, static_cast<uint32_t>(std::stoul(value)));
+        else std::cerr << "Unknown option: " << arg << std::endl;
+    }
+
+    return config;
+}
+
+// -----------------------------------------------------------------------------
+// 설정 파일 생성 (주석/빈 줄/인라인 주석 포함, 알려진 키는 앞부분에 한 번)
+// -----------------------------------------------------------------------------
+
+size_t writeConfigFile(const std::string& path, uint32_t entries, uint32_t keysPerSection) {
+    std::ofstream file(path, std::ios::trunc);
+    file << "; generated by ConfigLoadBenchmark\n\n";
+    file << "[System]\nMaxLaunchTubes=6\nUpdateIntervalMs=100\nEngagementPlanIntervalMs=1000\n\n";
+    file << "[Weapon]\nALMSpeed=300.0   ; m/s\nASMSpeed=400.0\nDefaultLaunchDelay=3.0\n\n";
+    file << "[Paths]\nMineDataPath=data/mine_plans\nLogPath=logs\n\n";
+
+    for (uint32_t i = 0; i < entries; ++i) {
+        if (i % keysPerSection == 0) {
+            file << "\n# section " << i / keysPerSection << "\n[Module" << i / keysPerSection << "]\n";
+        }
+        file << "  Parameter" << i % keysPerSection << " = " << (i * 7919u) % 100000 << "." << i % 10 << "\n";
+    }
+
+    file.flush();
+    return static_cast<size_t>(std::filesystem::file_size(path));
+}
+
+// -----------------------------------------------------------------------------
+// 기존 방식 (변경 전 SystemConfig::loadFromFile 과 같은 알고리즘)
+// -----------------------------------------------------------------------------
+
+std::string legacyTrim(const std::string& str) {
+    size_t start = str.find_first_not_of(" \t\r\n");
+    if (start == std::string::npos) return "";
+
+    size_t end = str.find_last_not_of(" \t\r\n");
+    return str.substr(start, end - start + 1);
+}
+
+void legacyLoad(const std::string& filename, std::map<std::string, std::string>& config) {
+    std::ifstream file(filename);
+    std::string line;
+    std::string currentSection = "";
+
+    while (std::getline(file, line)) {
+        line = legacyTrim(line);
+
+        if (line.empty() || line[0] == ';' || line[0] == '#') {
+            continue;
+        }
+
+        if (line[0] == '[' && line.back() == ']') {
+            currentSection = line.substr(1, line.length() - 2);
+            continue;
+        }
+
+        auto equalPos = line.find('=');
+        if (equalPos != std::string::npos) {
+            std::string key = legacyTrim(line.substr(0, equalPos));
+            std::string value = legacyTrim(line.substr(equalPos + 1));
+
+            if (!currentSection.empty()) {
+                key = currentSection + "." + key;
+            }
+
+            config[key] = value;
+        }
+    }
+}
+
+// -----------------------------------------------------------------------------
+// 측정
+// -----------------------------------------------------------------------------
+
+struct LoadSample {
+    double milliseconds = 0.0;
+    uint64_t allocations = 0;
+    uint64_t bytes = 0;
+    int64_t retainedBytes = 0;      // 적재 후 남은 힙 (malloc 실제 크기)
+};
+
+template <typename Load, typename Release>
+LoadSample measureLoad(Load&& load, Release&& release) {
+    release();
+
+    int64_t liveBefore = allocationCounters().liveBytes.load(std::memory_order_relaxed);
+    auto before = AllocationSample::now();
+    auto start = Clock::now();
+
+    load();
+
+    auto end = Clock::now();
+    auto after = AllocationSample::now();
+
+    LoadSample sample;
+    sample.milliseconds = std::chrono::duration<double, std::milli>(end - start).count();
+    sample.allocations = after.allocations - before.allocations;
+    sample.bytes = after.bytes - before.bytes;
+    sample.retainedBytes = allocationCounters().liveBytes.load(std::memory_order_relaxed) - liveBefore;
+
+    release();
+    return sample;
+}
+
+LoadSample median(std::vector<LoadSample> samples) {
+    std::sort(samples.begin(), samples.end(),
+              [](const LoadSample& lhs, const LoadSample& rhs) { return lhs.milliseconds < rhs.milliseconds; });
+    return samples[samples.size() / 2];
+}
+
+void printRow(const char* parser, uint32_t entries, size_t fileBytes, const LoadSample& sample) {
+    std::cout << "  " << std::left << std::setw(8) << parser << std::right
+              << std::setw(10) << entries
+              << std::setw(12) << fileBytes / 1024
+              << std::setw(12) << std::fixed << std::setprecision(3) << sample.milliseconds
+              << std::setw(14) << sample.allocations
+              << std::setw(14) << sample.bytes / 1024
+              << std::setw(14) << sample.retainedBytes / 1024 << std::defaultfloat << std::endl;
+}
+
+} // namespace
+
+int main(int argc, char* argv[]) {
+    auto config = parseArguments(argc, argv);
+    auto& systemConfig = SystemConfig::getInstance();
+    auto path = (std::filesystem::temp_directory_path() / "weapon_control_config_bench.ini").string();
+
+    std::cout << "Config load: median of " << config.repeat << " runs, "
+              << config.keysPerSection << " keys per section" << std::endl;
+    std::cout << "  " << std::left << std::setw(8) << "parser" << std::right
+              << std::setw(10) << "entries" << std::setw(12) << "file KB" << std::setw(12) << "load ms"
+              << std::setw(14) << "allocations" << std::setw(14) << "alloc KB" << std::setw(14) << "retained KB"
+              << std::endl;
+
+    for (uint32_t entries : config.entryCounts) {
+        size_t fileBytes = writeConfigFile(path, entries, config.keysPerSection);
+
+        std::map<std::string, std::string> legacyConfig;
+        std::vector<LoadSample> legacySamples;
+        std::vector<LoadSample> mappedSamples;
+
+        for (uint32_t run = 0; run < config.repeat; ++run) {
+            legacySamples.push_back(measureLoad(
+                [&]() { legacyLoad(path, legacyConfig); },
+                [&]() { std::map<std::string, std::string>().swap(legacyConfig); }));
+
+            mappedSamples.push_back(measureLoad(
+                [&]() { systemConfig.loadFromFile(path); },
+                [&]() { systemConfig.clear(); }));
+        }
+
+        auto legacy = median(legacySamples);
+        auto mapped = median(mappedSamples);
+        printRow("legacy", entries, fileBytes, legacy);
+        printRow("mmap", entries, fileBytes, mapped);
+        std::cout << "  -> " << std::fixed << std::setprecision(2)
+                  << (mapped.milliseconds > 0.0 ? legacy.milliseconds / mapped.milliseconds : 0.0)
+                  << "x faster, " << (mapped.allocations ? static_cast<double>(legacy.allocations) / mapped.allocations : 0.0)
+                  << "x fewer allocations" << std::defaultfloat << std::endl;
+    }
+
+    // 적재 후 조회 비용 (알려진 키 슬롯 / 일반 키 맵)
+    writeConfigFile(path, 1000, config.keysPerSection);
+    systemConfig.clear();
+    systemConfig.loadFromFile(path);
+
+    std::cout << std::endl;
+    BenchmarkRunner::printHeader();
+    BenchmarkRunner runner;
+    volatile double numberSink = 0.0;
+    runner.run("SystemConfig::get<ConfigKey::ALM_SPEED>", 500000, [&]() {
+        numberSink = systemConfig.get<ConfigKey::ALM_SPEED>();
+    });
+    runner.run("SystemConfig::get<double> (known key)", 500000, [&]() {
+        numberSink = systemConfig.get<double>("Weapon.ALMSpeed", 0.0);
+    });
+    runner.run("SystemConfig::get<double> (other key)", 500000, [&]() {
+        numberSink = systemConfig.get<double>("Module3.Parameter7", 0.0);
+    });
+    (void)numberSink;
+
+    // 문자열 키 get 도 스키마 키는 슬롯을 읽음: 거부된 값 대신 이전 값, 없으면 스키마 기본값
+    systemConfig.clear();
+    double defaultSpeed = systemConfig.get<double>("Weapon.ALMSpeed", 0.0);
+    {
+        ScopedCoutSilencer silencer;
+        systemConfig.set("Weapon.ALMSpeed", "99999");
+    }
+    double rejectedSpeed = systemConfig.get<double>("Weapon.ALMSpeed", 0.0);
+    bool slotsMatch = defaultSpeed == systemConfig.get<ConfigKey::ALM_SPEED>()
+        && rejectedSpeed == systemConfig.get<ConfigKey::ALM_SPEED>()
+        && systemConfig.get<std::string>("Paths.MineDataPath") == systemConfig.get<ConfigKey::MINE_DATA_PATH>();
+    std::cout << std::endl << std::setprecision(6) << "String-key get of schema keys: unset -> " << defaultSpeed
+              << ", out-of-range set -> " << rejectedSpeed << " ("
+              << (slotsMatch ? "matches" : "DIFFERS FROM") << " get<ConfigKey>)" << std::endl;
+
+    systemConfig.clear();
+    std::filesystem::remove(path);
+    return slotsMatch ? 0 : 1;
+}
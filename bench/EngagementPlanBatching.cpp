@@ -0,0 +1,343 @@
+// =============================================================================
+// 교전계획 묶음 전달 벤치마크
+//
+// 대표 시나리오: 발사관 N 개 모두 유도탄 할당, 매 주기 모든 표적 항적 갱신 후
+// 명령 스레드에서 전체 교전계획 재계산, 이어서 발사관 4개 중 1개의 항적을 한 번
+// 더 갱신 (같은 주기에 교전계획이 두 번 바뀜).
+// 발사관별 즉시 전달과 System.EngagementPlanBatching 묶음 전달을 같은 입력으로
+// 실행하여
+//
+// 1) 비용: 주기당 콜백 호출 수, 전달 항목 수, 주기(입력 + update) 비용
+// 2) 동일성: 주기마다 통지된 발사관 집합이 두 방식에서 같은지
+// 3) 묶음 규칙: 한 묶음에 발사관이 한 번만 있고, 내용이 update 직후 조회
+//    결과와 같은지 (같은 주기의 여러 갱신은 최신 내용 하나로 합쳐짐)
+// 4) 명령 스레드 갱신: 주기 밖 재계산이 즉시 전달되지 않고 다음 update 끝의
+//    묶음으로 전달되는지
+// 5) 경로 분리: 즉시 모드는 발사관별 콜백으로만, 묶음 모드는 묶음 콜백으로만
+//    전달되는지
+// 6) 변경 판정: 궤적 중간점만 바뀐 계획(자항기뢰 경로점 이동, 양 끝점과 궤적
+//    길이는 같음)은 통지되고, 같은 경로점을 다시 넣은 재계산은 통지되지 않는지
+//
+// 사용법: EngagementPlanBatching [옵션]
+//   --tubes N        발사관 수 (기본 48)
+//   --ticks T        검증 주기 수 (기본 200)
+//   --iterations N   주기 비용 측정 반복 수 (기본 500)
+//
+// 두 방식의 통지 발사관 집합이 다르거나, 묶음에 중복/지난 내용이 있거나, 모드에
+// 맞지 않는 콜백이 호출되거나, 변경 판정이 틀리면 종료 코드 1.
+// =============================================================================
+
+#include "BenchSupport.h"
+#include <string>
+
+using namespace WeaponControl;
+using namespace WeaponControl::Bench;
+
+namespace {
+
+// -----------------------------------------------------------------------------
+// 설정
+// -----------------------------------------------------------------------------
+
+struct BenchConfig {
+    uint16_t tubes = 48;
+    uint64_t ticks = 200;
+    uint64_t iterations = 500;
+};
+
+BenchConfig parseArguments(int argc, char* argv[]) {
+    BenchConfig config;
+    OptionParser()
+        .add("--tubes", config.tubes, 4)
+        .add("--ticks", config.ticks, 1)
+        .add("--iterations", config.iterations)
+        .parse(argc, argv);
+    return config;
+}
+
+// -----------------------------------------------------------------------------
+// 시나리오
+// -----------------------------------------------------------------------------
+
+constexpr int TICK_MS = 20;
+
+// -----------------------------------------------------------------------------
+// 모드별 실행
+// -----------------------------------------------------------------------------
+
+struct DeliveryStats {
+    uint64_t callbacks = 0;         // 모드에 맞는 사용자 콜백 호출 수 (즉시: 발사관별, 묶음: 묶음)
+    uint64_t entries = 0;           // 전달된 발사관 항목 수
+    uint64_t duplicates = 0;        // 한 주기에 같은 발사관이 두 번 이상 전달
+    uint64_t staleResults = 0;      // 전달 내용이 update 직후 조회 결과와 다름
+    uint64_t crossDeliveries = 0;   // 모드에 맞지 않는 콜백 호출 수 (0 이어야 함)
+};
+
+class PlanDeliveryRun {
+public:
+    PlanDeliveryRun(const BenchConfig& config, bool batching, ServiceFixture& fixture)
+        : m_config(config)
+        , m_batching(batching)
+        , m_clock(fixture.clock())
+        , m_tickTubes(config.tubes + 1, false)
+        , m_tickHashes(config.tubes + 1, 0) {
+        SystemConfig::getInstance().set("System.EngagementPlanBatching", batching ? "true" : "false");
+        m_service = fixture.makeService(config.tubes, batching ? "batch_mine" : "immediate_mine");
+
+        // 두 콜백을 모두 등록하고 모드에 맞지 않는 쪽이 호출되면 계수
+        m_service->setEngagementPlanCallback([this](uint16_t tubeNumber, const EngagementPlanResult& result) {
+            if (m_batching) {
+                ++m_stats.crossDeliveries;
+                return;
+            }
+            ++m_stats.callbacks;
+            deliver(tubeNumber, result);
+        });
+        m_service->setEngagementPlanBatchCallback([this](const EngagementPlanBatch& batch) {
+            if (!m_batching) {
+                ++m_stats.crossDeliveries;
+                return;
+            }
+            ++m_stats.callbacks;
+            for (const auto& update : batch) {
+                deliver(update.tubeNumber, *update.result);
+            }
+        });
+
+        ScopedCoutSilencer silencer;
+        m_service->initialize();
+        assignMissiles(*m_service, config.tubes);
+        m_service->update();
+        m_stats = DeliveryStats();
+    }
+
+    ~PlanDeliveryRun() {
+        ScopedCoutSilencer silencer;
+        m_service->shutdown();
+    }
+
+    // 한 주기: 항적 전체 갱신, 전체 재계산, 일부 항적 재갱신, update
+    void tick(uint64_t index) {
+        resetTick();
+
+        double phase = 0.05 * static_cast<double>(index + 1);
+        for (uint16_t tube = 1; tube <= m_config.tubes; ++tube) {
+            m_service->updateTargetInfo(makeTrack(tube, phase));
+        }
+        m_service->calculateAllEngagementPlans();
+        for (uint16_t tube = 4; tube <= m_config.tubes; tube += 4) {
+            m_service->updateTargetInfo(makeTrack(tube, phase + 0.02));
+        }
+
+        m_clock.advance(std::chrono::milliseconds(TICK_MS));
+        m_service->update();
+    }
+
+    void deliver(uint16_t tubeNumber, const EngagementPlanResult& result) {
+        ++m_stats.entries;
+        if (m_tickTubes[tubeNumber]) {
+            ++m_stats.duplicates;
+        }
+        m_tickTubes[tubeNumber] = true;
+        m_tickHashes[tubeNumber] = HashEngagementPlanContent(result);
+    }
+
+    void resetTick() {
+        std::fill(m_tickTubes.begin(), m_tickTubes.end(), false);
+    }
+
+    // 직전 주기에 전달된 내용이 현재 조회 결과와 같은지
+    void verifyTick() {
+        for (uint16_t tube = 1; tube <= m_config.tubes; ++tube) {
+            if (m_tickTubes[tube] && m_tickHashes[tube] != HashEngagementPlanContent(m_service->getEngagementResult(tube))) {
+                ++m_stats.staleResults;
+            }
+        }
+    }
+
+    WeaponControlService& service() { return *m_service; }
+    const std::vector<bool>& tickTubes() const { return m_tickTubes; }
+    DeliveryStats& stats() { return m_stats; }
+    bool batching() const { return m_batching; }
+
+private:
+    const BenchConfig& m_config;
+    bool m_batching;
+    VirtualClock& m_clock;
+    std::unique_ptr<WeaponControlService> m_service;
+    std::vector<bool> m_tickTubes;
+    std::vector<uint64_t> m_tickHashes;
+    DeliveryStats m_stats;
+};
+
+// -----------------------------------------------------------------------------
+// 변경 판정
+// -----------------------------------------------------------------------------
+
+struct ChangeDetectionResult {
+    bool hashSeesMidpoint = false;      // 중간점만 다른 두 계획의 내용 해시가 다름
+    uint64_t midpointCallbacks = 0;     // 자항기뢰 중간 경로점 이동 (1 이어야 함)
+    uint64_t mineReapplyCallbacks = 0;  // 같은 경로점 재적용, 자항기뢰 (0 이어야 함)
+    uint64_t missileMoveCallbacks = 0;  // 유도탄 경로점 변경 (1 이어야 함)
+    uint64_t missileReapplyCallbacks = 0; // 같은 경로점 재적용, 유도탄 (0 이어야 함)
+
+    bool ok() const {
+        return hashSeesMidpoint && midpointCallbacks == 1 && mineReapplyCallbacks == 0
+            && missileMoveCallbacks == 1 && missileReapplyCallbacks == 0;
+    }
+};
+
+// 기본 설정(전체 내용 비교, 즉시 전달)에서 발사관 1 자항기뢰, 2 유도탄
+ChangeDetectionResult verifyChangeDetection(ServiceFixture& fixture) {
+    ChangeDetectionResult result;
+
+    EngagementPlanResult plan;
+    plan.isValid = true;
+    for (int i = 0; i < 5; ++i) {
+        ST_3D_GEODETIC_POSITION point;
+        point.dLatitude() = 35.0 + i * 0.01;
+        point.dLongitude() = 129.0 + i * 0.01;
+        plan.trajectory.push_back(point);
+    }
+    uint64_t before = HashEngagementPlanContent(plan);
+    plan.trajectory[2].dLatitude() += 0.001;
+    result.hashSeesMidpoint = HashEngagementPlanContent(plan) != before;
+
+    SystemConfig::getInstance().set("System.EngagementPlanBatching", "false");
+    auto service = fixture.makeService(2, "change_mine");
+    std::vector<uint64_t> callbacks(3, 0);
+    service->setEngagementPlanCallback([&callbacks](uint16_t tubeNumber, const EngagementPlanResult&) {
+        ++callbacks[tubeNumber];
+    });
+
+    ScopedCoutSilencer silencer;
+    service->initialize();
+    service->assignWeapon(makeAssignment(1, 1, EN_WPN_KIND::WPN_KIND_M_MINE));
+    service->assignWeapon(makeAssignment(2, 2));
+    service->updateTargetInfo(makeTrack(2, 0.0));
+    service->updateWaypoints(makeWaypoints(1, 3));
+    service->update();
+
+    // 요청을 적용하고 update 까지 마친 뒤 발사관의 콜백 수
+    auto callbacksFor = [&](const WaypointUpdateRequest& request) {
+        uint64_t start = callbacks[request.tubeNumber];
+        service->updateWaypoints(request);
+        fixture.clock().advance(std::chrono::milliseconds(TICK_MS));
+        service->update();
+        return callbacks[request.tubeNumber] - start;
+    };
+
+    // 가운데 경로점만 이동: 궤적 길이와 양 끝점(발사/부설 지점)은 그대로
+    auto moved = makeWaypoints(1, 3);
+    moved.waypoints[1].dLatitude() += 0.001;
+    result.midpointCallbacks = callbacksFor(moved);
+    result.mineReapplyCallbacks = callbacksFor(moved);
+
+    result.missileMoveCallbacks = callbacksFor(makeWaypoints(2, 3));
+    result.missileReapplyCallbacks = callbacksFor(makeWaypoints(2, 3));
+
+    service->shutdown();
+    return result;
+}
+
+} // namespace
+
+int main(int argc, char* argv[]) {
+    auto config = parseArguments(argc, argv);
+
+    ServiceFixture fixture("plan_batching");
+    auto& clock = fixture.clock();
+    auto changeDetection = verifyChangeDetection(fixture);
+    PlanDeliveryRun immediate(config, false, fixture);
+    PlanDeliveryRun batched(config, true, fixture);
+
+    std::cout << "Engagement plan delivery: " << config.tubes << " tubes, all tracks updated every "
+              << TICK_MS << " ms tick, " << config.ticks << " ticks" << std::endl << std::endl;
+
+    // -------------------------------------------------------------------------
+    // 동일 입력 비교
+    // -------------------------------------------------------------------------
+    uint64_t mismatchedTicks = 0;
+    {
+        ScopedCoutSilencer silencer;
+        for (uint64_t t = 0; t < config.ticks; ++t) {
+            immediate.tick(t);
+            batched.tick(t);
+            immediate.verifyTick();
+            batched.verifyTick();
+            if (immediate.tickTubes() != batched.tickTubes()) {
+                ++mismatchedTicks;
+            }
+        }
+    }
+
+    std::cout << "  " << std::left << std::setw(12) << "mode" << std::right << std::setw(18) << "callbacks/tick"
+              << std::setw(16) << "entries/tick" << std::setw(12) << "duplicate" << std::setw(10) << "stale"
+              << std::setw(10) << "cross" << std::endl;
+    for (auto* run : {&immediate, &batched}) {
+        const auto& stats = run->stats();
+        std::cout << "  " << std::left << std::setw(12) << (run->batching() ? "batched" : "immediate") << std::right
+                  << std::setw(18) << std::fixed << std::setprecision(1)
+                  << static_cast<double>(stats.callbacks) / static_cast<double>(config.ticks)
+                  << std::setw(16) << static_cast<double>(stats.entries) / static_cast<double>(config.ticks)
+                  << std::setw(12) << stats.duplicates << std::setw(10) << stats.staleResults
+                  << std::setw(10) << stats.crossDeliveries << std::endl;
+    }
+    std::cout << std::endl;
+
+    // -------------------------------------------------------------------------
+    // 명령 스레드 갱신은 다음 update 끝에 전달
+    // -------------------------------------------------------------------------
+    uint64_t callbacksBefore = batched.stats().callbacks;
+    uint64_t entriesBefore = batched.stats().entries;
+    bool deferredOk = false;
+    {
+        ScopedCoutSilencer silencer;
+        batched.resetTick();
+        batched.service().updateTargetInfo(makeTrack(1, -1.0));
+        batched.service().calculateAllEngagementPlans();
+        bool deliveredEarly = batched.stats().callbacks != callbacksBefore;
+        clock.advance(std::chrono::milliseconds(TICK_MS));
+        batched.service().update();
+        batched.verifyTick();
+        deferredOk = !deliveredEarly && batched.stats().callbacks == callbacksBefore + 1
+            && batched.stats().entries == entriesBefore + 1 && batched.tickTubes()[1];
+    }
+    std::cout << "Command-thread recalculation (tube 1 track changed): "
+              << (deferredOk ? "one entry at next tick end" : "NOT deferred") << std::endl << std::endl;
+
+    std::cout << "Change detection: midpoint-only plan change -> " << changeDetection.midpointCallbacks
+              << " callback(s) (hash " << (changeDetection.hashSeesMidpoint ? "differs" : "SAME")
+              << "), identical waypoints re-applied -> " << changeDetection.mineReapplyCallbacks << " (mine) / "
+              << changeDetection.missileReapplyCallbacks << " (missile), missile waypoint change -> "
+              << changeDetection.missileMoveCallbacks << std::endl << std::endl;
+
+    // -------------------------------------------------------------------------
+    // 주기 비용 (입력 갱신 + update + 전달)
+    // -------------------------------------------------------------------------
+    BenchmarkRunner::printHeader();
+    BenchmarkRunner runner;
+    uint64_t tick = config.ticks + 1;
+    runner.run("tick, immediate per-tube delivery", config.iterations, [&]() { immediate.tick(tick++); });
+    runner.run("tick, batched delivery", config.iterations, [&]() { batched.tick(tick++); });
+
+    const auto& immediateStats = immediate.stats();
+    const auto& batchedStats = batched.stats();
+
+    std::cout << std::endl;
+    uint64_t crossDeliveries = immediateStats.crossDeliveries + batchedStats.crossDeliveries;
+    if (mismatchedTicks != 0 || batchedStats.duplicates != 0 || batchedStats.staleResults != 0 || crossDeliveries != 0
+        || !deferredOk || !changeDetection.ok() || batchedStats.entries == 0
+        || batchedStats.callbacks >= immediateStats.callbacks) {
+        std::cout << "FAIL: " << mismatchedTicks << " ticks with different tube sets, " << batchedStats.duplicates
+                  << " duplicate entries, " << batchedStats.staleResults << " stale results, " << crossDeliveries
+                  << " callbacks outside their mode, command-thread update "
+                  << (deferredOk ? "deferred" : "not deferred to next tick") << ", change detection "
+                  << (changeDetection.ok() ? "correct" : "wrong") << std::endl;
+        return 1;
+    }
+
+    std::cout << "PASS: same tubes notified every tick, " << immediateStats.callbacks << " -> "
+              << batchedStats.callbacks << " callbacks" << std::endl;
+    return 0;
+}
@@ -0,0 +1,521 @@
+// =============================================================================
+// 종단간 시나리오 부하 생성기
+//
+// WeaponControlService 에 표적/항법/할당/통제/경로점 스트림을 설정된 속도로
+// 주입하고 명령-콜백 지연 분포, 처리량, 구성요소별 CPU 사용량을 측정한다.
+// 모든 입력은 하나의 디스패치 루프(DDS 메시지 핸들러 + 주기 작업 관리자 모델)
+// 에서 순차 처리된다.
+//
+// 사용법: LoadGenerator [옵션]
+//   --tubes N            발사관 수 (기본 6)
+//   --targets M          시스템 표적 수 (기본 32)
+//   --duration SEC       실행 시간 (기본 10)
+//   --tick-ms MS         주기 업데이트 간격 (기본 System.UpdateIntervalMs)
+//   --track-rate HZ      표적 갱신 총 속도 (기본 1000)
+//   --nav-rate HZ        항법 갱신 속도 (기본 10)
+//   --assign-rate HZ     할당 해제/재할당 속도 (기본 2)
+//   --control-rate HZ    통제 명령 속도 (기본 20)
+//   --waypoint-rate HZ   경로점 편집 속도 (기본 5)
+//   --json PATH          결과 JSON 저장
+//   --metrics PATH       실행 중 운용 지표를 1초 주기로 Prometheus text 파일에 덤프
+//   --record PATH        입력/콜백 이벤트 로그 기록 (tools/EventReplay 로 재생)
+//   --trace PATH         정상 부하 구간의 타임라인을 Chrome trace JSON 으로 저장
+//   --memory 1           종료 직전 구성요소/발사관별 메모리 사용량 출력
+// =============================================================================
+
+#include "BenchSupport.h"
+#include "../Core/Service/WeaponControlService.h"
+#include "../Infrastructure/Configuration/SystemConfig.h"
+#include <array>
+#include <filesystem>
+#include <mutex>
+#include <random>
+#include <string>
+#include <thread>
+#include <time.h>
+
+using namespace WeaponControl;
+using namespace WeaponControl::Bench;
+
+namespace {
+
+using Clock = std::chrono::steady_clock;
+
+// -----------------------------------------------------------------------------
+// 설정
+// -----------------------------------------------------------------------------
+
+struct LoadConfig {
+    uint16_t tubes = 6;
+    uint32_t targets = 32;
+    double durationSec = 10.0;
+    int tickMs = 0;
+    double trackRate = 1000.0;
+    double navRate = 10.0;
+    double assignRate = 2.0;
+    double controlRate = 20.0;
+    double waypointRate = 5.0;
+    std::string jsonPath;
+    std::string metricsPath;
+    std::string recordPath;
+    std::string tracePath;
+    bool memoryReport = false;
+};
+
+LoadConfig parseArguments(int argc, char* argv[]) {
+    LoadConfig config;
+    config.tickMs = static_cast<int>(SystemConfig::getInstance().getUpdateInterval().count());
+
+    for (int i = 1; i + 1 < argc; i += 2) {
+        std::string arg = argv[i];
+        std::string value = argv[i + 1];
+        if (arg == "--tubes") config.tubes = static_cast<uint16_t>(std::stoul(value));
+        else if (arg == "--targets") config.targets = static_cast<uint32_t>(std::stoul(value));
+        else if (arg == "--duration") config.durationSec = std::stod(value);
+        else if (arg == "--tick-ms") config.tickMs = std::stoi(value);
+        else if (arg == "--track-rate") config.trackRate = std::stod(value);
+        else if (arg == "--nav-rate") config.navRate = std::stod(value);
+        else if (arg == "--assign-rate") config.assignRate = std::stod(value);
+        else if (arg == "--control-rate") config.controlRate = std::stod(value);
+        else if (arg == "--waypoint-rate") config.waypointRate = std::stod(value);
+        else if (arg == "--json") config.jsonPath = value;
+        else if (arg == "--metrics") config.metricsPath = value;
+        else if (arg == "--record") config.recordPath = value;
+        else if (arg == "--trace") config.tracePath = value;
+        else if (arg == "--memory") config.memoryReport = (value != "0");
+        else std::cerr << "Unknown option: " << arg << std::endl;
+    }
+
+    return config;
+}
+
+// -----------------------------------------------------------------------------
+// 구성요소별 측정
+// -----------------------------------------------------------------------------
+
+enum class Stream : size_t {
+    TICK = 0,
+    TRACK,
+    NAV,
+    ASSIGN,
+    CONTROL,
+    WAYPOINT,
+    COUNT
+};
+
+constexpr size_t STREAM_COUNT = static_cast<size_t>(Stream::COUNT);
+
+const char* streamName(Stream stream) {
+    switch (stream) {
+        case Stream::TICK: return "tick";
+        case Stream::TRACK: return "track";
+        case Stream::NAV: return "nav";
+        case Stream::ASSIGN: return "assign";
+        case Stream::CONTROL: return "control";
+        case Stream::WAYPOINT: return "waypoint";
+        default: return "unknown";
+    }
+}
+
+double threadCpuSeconds() {
+    timespec ts;
+    clock_gettime(CLOCK_THREAD_CPUTIME_ID, &ts);
+    return ts.tv_sec + ts.tv_nsec * 1e-9;
+}
+
+double microsecondsSince(Clock::time_point start) {
+    return std::chrono::duration<double, std::micro>(Clock::now() - start).count();
+}
+
+struct StreamMetrics {
+    uint64_t operations = 0;
+    uint64_t failures = 0;
+    double cpuSeconds = 0.0;
+    std::vector<double> callLatencyUs;       // 호출 반환까지
+    std::vector<double> callbackLatencyUs;   // 명령 발행부터 콜백 수신까지
+};
+
+// 명령 발행 시각을 발사관별로 기록하고 콜백 수신 시 지연 산출
+class PendingCommandTracker {
+public:
+    explicit PendingCommandTracker(uint16_t tubes) : m_pending(tubes + 1) {}
+
+    void issue(uint16_t tube) {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_pending[tube] = Clock::now();
+    }
+
+    void complete(uint16_t tube, std::vector<double>& samples) {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        if (tube < m_pending.size() && m_pending[tube] != Clock::time_point()) {
+            samples.push_back(microsecondsSince(m_pending[tube]));
+            m_pending[tube] = Clock::time_point();
+        }
+    }
+
+private:
+    std::mutex m_mutex;
+    std::vector<Clock::time_point> m_pending;
+};
+
+// -----------------------------------------------------------------------------
+// 메시지 생성
+// -----------------------------------------------------------------------------
+
+// 짝수 발사관 ASM, 홀수 발사관 ALM
+WeaponAssignmentRequest makeStrikeAssignment(uint16_t tube, uint32_t targetId) {
+    EN_WPN_KIND kind = (tube % 2 == 0) ? EN_WPN_KIND::WPN_KIND_ASM : EN_WPN_KIND::WPN_KIND_ALM;
+    return makeAssignment(tube, targetId, kind);
+}
+
+std::vector<ST_WEAPON_WAYPOINT> makeWaypoints(std::mt19937& rng) {
+    std::uniform_int_distribution<int> countDist(1, 8);
+    std::uniform_real_distribution<double> offsetDist(-0.05, 0.05);
+
+    std::vector<ST_WEAPON_WAYPOINT> waypoints(countDist(rng));
+    for (size_t i = 0; i < waypoints.size(); ++i) {
+        waypoints[i].dLatitude() = 35.0 + i * 0.02 + offsetDist(rng);
+        waypoints[i].dLongitude() = 129.0 + i * 0.02 + offsetDist(rng);
+        waypoints[i].fDepth() = 10.0f;
+    }
+    return waypoints;
+}
+
+// -----------------------------------------------------------------------------
+// 출력
+// -----------------------------------------------------------------------------
+
+void printLatency(const char* label, std::vector<double>& samples) {
+    auto stats = LatencyStats::fromSamples(samples);
+    std::cout << "  " << std::left << std::setw(28) << label << std::right
+              << " n=" << std::setw(8) << stats.count << std::fixed << std::setprecision(1)
+              << "  p50=" << std::setw(8) << stats.p50_us
+              << "  p99=" << std::setw(8) << stats.p99_us
+              << "  p99.9=" << std::setw(8) << stats.p999_us
+              << "  max=" << std::setw(9) << stats.max_us << " us" << std::defaultfloat << std::endl;
+}
+
+void printStageTimings(const std::vector<StageTimingStats>& stages, double tickMs) {
+    std::cout << "  " << std::left << std::setw(30) << "stage" << std::right
+              << std::setw(10) << "count" << std::setw(10) << "mean us" << std::setw(10) << "p50 us"
+              << std::setw(10) << "p99 us" << std::setw(10) << "max us" << std::setw(12) << "% of tick" << std::endl;
+
+    uint64_t ticks = stages[static_cast<size_t>(ProfileStage::TUBE_MANAGER_UPDATE)].count;
+    for (const auto& stage : stages) {
+        double perTickUs = ticks ? stage.totalMs * 1e3 / ticks : 0.0;
+        std::cout << "  " << std::left << std::setw(30) << stage.name << std::right
+                  << std::setw(10) << stage.count << std::fixed << std::setprecision(2)
+                  << std::setw(10) << stage.meanUs << std::setw(10) << stage.p50Us
+                  << std::setw(10) << stage.p99Us << std::setw(10) << stage.maxUs
+                  << std::setw(12) << 100.0 * perTickUs / (tickMs * 1e3) << std::defaultfloat << std::endl;
+    }
+}
+
+void writeJson(const std::string& path, const LoadConfig& config, double elapsed,
+               std::array<StreamMetrics, STREAM_COUNT>& metrics,
+               const std::vector<StageTimingStats>& stages) {
+    std::ofstream file(path);
+    if (!file.is_open()) {
+        std::cerr << "Failed to write " << path << std::endl;
+        return;
+    }
+
+    file << "{\n";
+    file << "  \"suite\": \"load-generator\",\n";
+    file << "  \"schemaVersion\": 1,\n";
+    file << "  \"tubes\": " << config.tubes << ",\n";
+    file << "  \"targets\": " << config.targets << ",\n";
+    file << "  \"elapsedSec\": " << elapsed << ",\n";
+    file << "  \"streams\": [\n";
+
+    for (size_t i = 0; i < STREAM_COUNT; ++i) {
+        auto& m = metrics[i];
+        auto call = LatencyStats::fromSamples(m.callLatencyUs);
+        auto callback = LatencyStats::fromSamples(m.callbackLatencyUs);
+        file << "    {\"name\": \"" << streamName(static_cast<Stream>(i)) << "\""
+             << ", \"operations\": " << m.operations
+             << ", \"failures\": " << m.failures
+             << ", \"throughputPerSec\": " << m.operations / elapsed
+             << ", \"cpuSeconds\": " << m.cpuSeconds
+             << ", \"callUs\": {\"p50\": " << call.p50_us << ", \"p99\": " << call.p99_us
+             << ", \"p999\": " << call.p999_us << ", \"max\": " << call.max_us << "}"
+             << ", \"callbackUs\": {\"count\": " << callback.count << ", \"p50\": " << callback.p50_us
+             << ", \"p99\": " << callback.p99_us << ", \"p999\": " << callback.p999_us
+             << ", \"max\": " << callback.max_us << "}}"
+             << (i + 1 < STREAM_COUNT ? "," : "") << "\n";
+    }
+
+    file << "  ],\n";
+    file << "  \"stages\": [\n";
+    for (size_t i = 0; i < stages.size(); ++i) {
+        const auto& stage = stages[i];
+        file << "    {\"name\": \"" << stage.name << "\""
+             << ", \"count\": " << stage.count
+             << ", \"totalMs\": " << stage.totalMs
+             << ", \"meanUs\": " << stage.meanUs
+             << ", \"p50Us\": " << stage.p50Us
+             << ", \"p99Us\": " << stage.p99Us
+             << ", \"maxUs\": " << stage.maxUs << "}"
+             << (i + 1 < stages.size() ? "," : "") << "\n";
+    }
+    file << "  ]\n";
+    file << "}\n";
+}
+
+} // namespace
+
+int main(int argc, char* argv[]) {
+    auto config = parseArguments(argc, argv);
+
+    // 전원 인가/발사 지연 제거 - 명령 처리 경로 자체를 측정
+    SystemConfig::getInstance().set("Weapon.DefaultLaunchDelay", "0");
+
+    auto dataPath = (std::filesystem::temp_directory_path() / "weapon_control_loadgen_mine").string();
+    std::filesystem::remove_all(dataPath);
+
+    WeaponControlService service(
+        std::make_unique<LaunchTubeManager>(config.tubes),
+        std::make_unique<TargetTrackingService>(),
+        std::make_unique<MineDropPlanService>(dataPath));
+
+    std::shared_ptr<EventRecorder> recorder;
+    if (!config.recordPath.empty()) {
+        recorder = std::make_shared<EventRecorder>(1 << 14);
+        auto recordResult = recorder->start(config.recordPath);
+        if (!recordResult) {
+            std::cerr << recordResult.error().message << std::endl;
+            return 1;
+        }
+        service.setEventRecorder(recorder);
+    }
+
+    std::array<StreamMetrics, STREAM_COUNT> metrics;
+    PendingCommandTracker controlPending(config.tubes);
+    PendingCommandTracker assignPending(config.tubes);
+    uint64_t stateCallbacks = 0;
+    uint64_t planCallbacks = 0;
+
+    auto& control = metrics[static_cast<size_t>(Stream::CONTROL)];
+    auto& assign = metrics[static_cast<size_t>(Stream::ASSIGN)];
+
+    service.setStateChangeCallback([&](uint16_t tube, EN_WPN_CTRL_STATE, EN_WPN_CTRL_STATE) {
+        ++stateCallbacks;
+        controlPending.complete(tube, control.callbackLatencyUs);
+    });
+    service.setAssignmentChangeCallback([&](uint16_t tube, EN_WPN_KIND, bool) {
+        assignPending.complete(tube, assign.callbackLatencyUs);
+    });
+    service.setEngagementPlanCallback([&](uint16_t, const EngagementPlanResult&) {
+        ++planCallbacks;
+    });
+
+    {
+        ScopedCoutSilencer silencer;
+        auto initResult = service.initialize();
+        if (!initResult) {
+            std::cerr << "Service initialization failed: " << initResult.error().message << std::endl;
+            return 1;
+        }
+        for (uint16_t tube = 1; tube <= config.tubes; ++tube) {
+            service.assignWeapon(makeStrikeAssignment(tube, (tube - 1) % config.targets + 1));
+        }
+    }
+
+    // 스트림별 다음 실행 시각
+    auto period = [](double rateHz) {
+        return rateHz > 0.0 ? std::chrono::duration_cast<Clock::duration>(std::chrono::duration<double>(1.0 / rateHz))
+                            : Clock::duration::max();
+    };
+
+    std::array<Clock::duration, STREAM_COUNT> periods = {
+        std::chrono::milliseconds(std::max(1, config.tickMs)),
+        period(config.trackRate),
+        period(config.navRate),
+        period(config.assignRate),
+        period(config.controlRate),
+        period(config.waypointRate)
+    };
+
+    // 초기 할당 구간은 제외하고 정상 부하 구간만 집계
+    service.resetStageTimings();
+    LockProfiler::getInstance().reset();
+    std::vector<StageTimingStats> stageTimings;
+    SystemStatistics statistics;
+    std::string lockReport;
+    MemoryReport memoryReport;
+    Result<void> traceResult = Result<void>::success();
+
+    MetricsFileDumper metricsDumper;
+    if (!config.metricsPath.empty()) {
+        metricsDumper.start(config.metricsPath, std::chrono::milliseconds(1000));
+    }
+
+    if (!config.tracePath.empty()) {
+        TraceRecorder::getInstance().setCurrentThreadName("load generator");
+        service.startTracing();
+    }
+
+    auto start = Clock::now();
+    auto deadline = start + std::chrono::duration_cast<Clock::duration>(std::chrono::duration<double>(config.durationSec));
+    std::array<Clock::time_point, STREAM_COUNT> nextDue;
+    nextDue.fill(start);
+
+    std::mt19937 rng(20240917);
+    std::uniform_int_distribution<int> tubeDist(1, config.tubes);
+    std::vector<bool> tubeOn(config.tubes + 1, false);
+    uint32_t nextTarget = 1;
+    double trackPhase = 0.0;
+    NAVINF_SHIP_NAVIGATION_INFO ownShip;
+
+    std::cout << "Running load: " << config.tubes << " tubes, " << config.targets << " targets, "
+              << config.durationSec << " s" << std::endl;
+
+    {
+        ScopedCoutSilencer silencer;
+
+        while (true) {
+            auto dueIt = std::min_element(nextDue.begin(), nextDue.end());
+            auto stream = static_cast<Stream>(dueIt - nextDue.begin());
+            if (*dueIt >= deadline) {
+                break;
+            }
+
+            std::this_thread::sleep_until(*dueIt);
+            *dueIt += periods[static_cast<size_t>(stream)];
+
+            auto& m = metrics[static_cast<size_t>(stream)];
+            double cpuStart = threadCpuSeconds();
+            auto callStart = Clock::now();
+            bool ok = true;
+
+            switch (stream) {
+                case Stream::TICK:
+                    service.update();
+                    break;
+
+                case Stream::TRACK:
+                    trackPhase += 0.01;
+                    service.updateTargetInfo(makeTrack(nextTarget, trackPhase));
+                    nextTarget = nextTarget % config.targets + 1;
+                    break;
+
+                case Stream::NAV:
+                    service.updateOwnShipInfo(ownShip);
+                    break;
+
+                case Stream::ASSIGN: {
+                    uint16_t tube = static_cast<uint16_t>(tubeDist(rng));
+                    if (service.getTubeStatus(tube).hasWeapon) {
+                        assignPending.issue(tube);
+                        ok = service.unassignWeapon(tube).isSuccess();
+                        tubeOn[tube] = false;
+                    }
+                    assignPending.issue(tube);
+                    ok = service.assignWeapon(makeStrikeAssignment(tube, (tube + nextTarget) % config.targets + 1)).isSuccess() && ok;
+                    break;
+                }
+
+                case Stream::CONTROL: {
+                    uint16_t tube = static_cast<uint16_t>(tubeDist(rng));
+                    WeaponControlRequest request;
+                    request.tubeNumber = tube;
+                    request.targetState = tubeOn[tube] ? EN_WPN_CTRL_STATE::WPN_CTRL_STATE_OFF
+                                                       : EN_WPN_CTRL_STATE::WPN_CTRL_STATE_ON;
+                    controlPending.issue(tube);
+                    ok = service.controlWeapon(request).isSuccess();
+                    if (ok) {
+                        tubeOn[tube] = !tubeOn[tube];
+                    }
+                    break;
+                }
+
+                case Stream::WAYPOINT: {
+                    WaypointUpdateRequest request;
+                    request.tubeNumber = static_cast<uint16_t>(tubeDist(rng));
+                    request.waypoints = makeWaypoints(rng);
+                    ok = service.updateWaypoints(request).isSuccess();
+                    break;
+                }
+
+                default:
+                    break;
+            }
+
+            m.callLatencyUs.push_back(microsecondsSince(callStart));
+            m.cpuSeconds += threadCpuSeconds() - cpuStart;
+            ++m.operations;
+            if (!ok) {
+                ++m.failures;
+            }
+        }
+
+        stageTimings = service.getStageTimings();
+        lockReport = service.getLockContentionReport();
+        memoryReport = service.getMemoryReport();
+        statistics = service.getSystemStatistics();
+        if (!config.tracePath.empty()) {
+            traceResult = service.stopTracing(config.tracePath);
+        }
+        service.shutdown();
+    }
+    metricsDumper.stop();
+    if (recorder) {
+        recorder->stop();
+    }
+
+    double elapsed = std::chrono::duration<double>(Clock::now() - start).count();
+
+    if (!traceResult) {
+        std::cerr << traceResult.error().message << std::endl;
+    } else if (!config.tracePath.empty()) {
+        std::cout << "Trace written: " << config.tracePath << " ("
+                  << TraceRecorder::getInstance().eventCount() << " events, "
+                  << TraceRecorder::getInstance().overwrittenCount() << " overwritten)" << std::endl;
+    }
+
+    std::cout << "\nElapsed " << elapsed << " s, state callbacks " << stateCallbacks
+              << ", plan callbacks " << planCallbacks << std::endl;
+    std::cout << "Commands " << statistics.totalCommands << " (" << statistics.failedCommands
+              << " failed), launched weapons " << statistics.launchedWeapons << std::endl;
+    std::cout << std::left << std::setw(10) << "stream" << std::right
+              << std::setw(10) << "ops" << std::setw(10) << "fail"
+              << std::setw(12) << "ops/s" << std::setw(12) << "cpu %" << std::endl;
+
+    for (size_t i = 0; i < STREAM_COUNT; ++i) {
+        const auto& m = metrics[i];
+        std::cout << std::left << std::setw(10) << streamName(static_cast<Stream>(i)) << std::right
+                  << std::setw(10) << m.operations << std::setw(10) << m.failures
+                  << std::fixed << std::setprecision(1)
+                  << std::setw(12) << m.operations / elapsed
+                  << std::setw(12) << 100.0 * m.cpuSeconds / elapsed << std::defaultfloat << std::endl;
+    }
+
+    std::cout << "\nCall latency" << std::endl;
+    for (size_t i = 0; i < STREAM_COUNT; ++i) {
+        printLatency(streamName(static_cast<Stream>(i)), metrics[i].callLatencyUs);
+    }
+
+    std::cout << "\nCommand-to-callback latency" << std::endl;
+    printLatency("control -> state callback", control.callbackLatencyUs);
+    printLatency("assign -> assignment callback", assign.callbackLatencyUs);
+
+    std::cout << "\nStage timing (inclusive; nested stages overlap)" << std::endl;
+    printStageTimings(stageTimings, std::max(1, config.tickMs));
+
+    if (LockProfiler::isCompiledIn()) {
+        std::cout << "\nLock contention" << std::endl << lockReport;
+    }
+
+    if (config.memoryReport) {
+        std::cout << "\nMemory (container allocations by account, capacity by tube)" << std::endl
+                  << memoryReport.format();
+    }
+
+    if (!config.jsonPath.empty()) {
+        writeJson(config.jsonPath, config, elapsed, metrics, stageTimings);
+        std::cout << "\nResults written to " << config.jsonPath << std::endl;
+    }
+
+    std::filesystem::remove_all(dataPath);
+    return 0;
+}
@@ -0,0 +1,363 @@
+// =============================================================================
+// 핵심 제어 경로 마이크로벤치마크
+//
+// 사용법: MicroBenchmarks [--json <path>] [--scale <factor>]
+//   --json   결과를 JSON 으로 저장 (기본: bench_results.json)
+//   --scale  반복 횟수 배율 (기본: 1.0)
+// =============================================================================
+
+#include "BenchSupport.h"
+#include "../Core/LaunchTube/LaunchTubeManager.h"
+#include "../Core/Factory/WeaponFactory.h"
+#include "../Core/Service/ServiceInterfaces.h"
+#include "../Infrastructure/Configuration/SystemConfig.h"
+#include <filesystem>
+#include <string>
+
+using namespace WeaponControl;
+using namespace WeaponControl::Bench;
+
+namespace {
+
+SGEODETIC_POSITION makeTargetPosition(double lat, double lon) {
+    SGEODETIC_POSITION pos;
+    pos.dLatitude() = lat;
+    pos.dLongitude() = lon;
+    pos.fAltitude() = 0.0;
+    return pos;
+}
+
+ST_WEAPON_WAYPOINT makeWaypoint(double lat, double lon, float depth) {
+    ST_WEAPON_WAYPOINT wp;
+    wp.dLatitude() = lat;
+    wp.dLongitude() = lon;
+    wp.fDepth() = depth;
+    return wp;
+}
+
+WeaponAssignmentRequest makeMissileAssignment(uint16_t tubeNumber, uint32_t systemTargetId) {
+    WeaponAssignmentRequest request;
+    request.tubeNumber = tubeNumber;
+    request.weaponKind = EN_WPN_KIND::WPN_KIND_ALM;
+    request.assignmentInfo.tubeNumber = tubeNumber;
+    request.assignmentInfo.weaponKind = EN_WPN_KIND::WPN_KIND_ALM;
+    request.assignmentInfo.systemTargetId = systemTargetId;
+    request.assignmentInfo.targetPos = makeTargetPosition(35.0 + tubeNumber * 0.01, 129.0);
+    return request;
+}
+
+std::unique_ptr<LaunchTubeManager> makeAssignedManager(uint16_t tubeCount, bool useSystemTargets) {
+    ScopedCoutSilencer silencer;
+    auto manager = std::make_unique<LaunchTubeManager>(tubeCount);
+    manager->initialize();
+    for (uint16_t tube = 1; tube <= tubeCount; ++tube) {
+        manager->assignWeapon(makeMissileAssignment(tube, useSystemTargets ? tube : 0));
+    }
+    return manager;
+}
+
+// -----------------------------------------------------------------------------
+// 개별 벤치마크
+// -----------------------------------------------------------------------------
+
+void benchIsValidTransition(BenchmarkRunner& runner) {
+    auto weapon = WeaponFactory::getInstance().createWeapon(EN_WPN_KIND::WPN_KIND_ALM);
+    volatile bool sink = false;
+    uint32_t i = 0;
+
+    runner.run("WeaponBase::isValidTransition", 200000, [&]() {
+        auto from = (i++ & 1) ? EN_WPN_CTRL_STATE::WPN_CTRL_STATE_OFF : EN_WPN_CTRL_STATE::WPN_CTRL_STATE_RTL;
+        sink = weapon->isValidTransition(from, EN_WPN_CTRL_STATE::WPN_CTRL_STATE_LAUNCH);
+    });
+    (void)sink;
+}
+
+void benchRequestStateChange(BenchmarkRunner& runner) {
+    // 전원 인가 지연 0 으로 상태 전이 로직 자체만 측정
+    SystemConfig::getInstance().set("Weapon.DefaultLaunchDelay", "0");
+    auto weapon = WeaponFactory::getInstance().createWeapon(EN_WPN_KIND::WPN_KIND_ALM);
+    weapon->initialize(1);
+    bool on = false;
+
+    runner.run("WeaponBase::requestStateChange (OFF<->ON)", 50000, [&]() {
+        weapon->requestStateChange(on ? EN_WPN_CTRL_STATE::WPN_CTRL_STATE_OFF : EN_WPN_CTRL_STATE::WPN_CTRL_STATE_ON);
+        on = !on;
+    });
+}
+
+void benchGetAllTubeStatus(BenchmarkRunner& runner) {
+    auto manager = makeAssignedManager(6, false);
+    size_t sink = 0;
+
+    runner.run("LaunchTubeManager::getAllTubeStatus (6 tubes)", 200000, [&]() {
+        sink += manager->getAllTubeStatus().size();
+    });
+    (void)sink;
+}
+
+void benchUpdateTargetInfoFanOut(BenchmarkRunner& runner) {
+    auto manager = makeAssignedManager(6, true);
+    TRKMGR_SYSTEMTARGET_INFO target;
+    uint32_t i = 0;
+
+    runner.run("LaunchTubeManager::updateTargetInfo (6 tubes)", 50000, [&]() {
+        uint32_t id = (i++ % 6) + 1;
+        target.unTargetSystemID() = id;
+        target.stGeodeticPosition().dLatitude() = 35.5 + (i % 100) * 1e-4;
+        target.stGeodeticPosition().dLongitude() = 129.5;
+        target.stGeodeticPosition().fDepth() = 0.0f;
+        manager->updateTargetInfo(target);
+    });
+}
+
+void benchAssignedTubeIteration(BenchmarkRunner& runner) {
+    // 홀수 발사관만 할당하여 비트 스캔이 빈 슬롯을 건너뛰는 경우까지 포함
+    for (uint16_t tubeCount : {6, 64, 256}) {
+        LaunchTubeManager manager(tubeCount);
+        {
+            ScopedCoutSilencer silencer;
+            manager.initialize();
+            for (uint16_t tube = 1; tube <= tubeCount; tube += 2) {
+                manager.assignWeapon(makeMissileAssignment(tube, 0));
+            }
+        }
+
+        std::string suffix = " (" + std::to_string(tubeCount) + " tubes, odd assigned)";
+        size_t sink = 0;
+
+        runner.run("LaunchTubeManager::getAssignedTubes" + suffix, 200000, [&]() {
+            for (const auto& tube : manager.getAssignedTubes()) {
+                sink += tube->getTubeNumber();
+            }
+        });
+
+        runner.run("LaunchTubeManager::forEachAssignedTube" + suffix, 200000, [&]() {
+            manager.forEachAssignedTube([&sink](LaunchTube& tube) {
+                sink += tube.getTubeNumber();
+            });
+        });
+        (void)sink;
+
+        ScopedCoutSilencer silencer;
+        manager.shutdown();
+    }
+}
+
+void benchUpdateByActivity(BenchmarkRunner& runner) {
+    // 64 발사관 할당, 활성(ON) 발사관 수에 따른 주기 비용
+    SystemConfig::getInstance().set("Weapon.DefaultLaunchDelay", "0");
+
+    for (uint16_t activeCount : {0, 8, 64}) {
+        auto manager = makeAssignedManager(64, false);
+        {
+            ScopedCoutSilencer silencer;
+            WeaponControlRequest control;
+            control.targetState = EN_WPN_CTRL_STATE::WPN_CTRL_STATE_ON;
+            for (uint16_t tube = 1; tube <= activeCount; ++tube) {
+                control.tubeNumber = tube;
+                manager->requestWeaponStateChange(control);
+            }
+            manager->update();   // 할당 직후 교전계획 계산 소진
+            manager->update();   // ON -> RTL
+        }
+
+        runner.run("LaunchTubeManager::update (64 tubes, " + std::to_string(activeCount) + " active)", 5000, [&]() {
+            manager->update();
+        });
+    }
+}
+
+void benchGetMissileEngagementResult(BenchmarkRunner& runner) {
+    EngagementManagerPtr engagementMgr = WeaponFactory::getInstance().createEngagementManager(EN_WPN_KIND::WPN_KIND_ALM);
+    auto* missileManager = dynamic_cast<IMissileEngagementManager*>(engagementMgr.get());
+    if (!missileManager) {
+        std::cout << "ALM engagement manager unavailable, skipping" << std::endl;
+        return;
+    }
+
+    {
+        ScopedCoutSilencer silencer;
+        engagementMgr->initialize(1, EN_WPN_KIND::WPN_KIND_ALM);
+        missileManager->setTargetPosition(makeTargetPosition(35.5, 129.5));
+
+        std::vector<ST_WEAPON_WAYPOINT> waypoints;
+        for (int i = 0; i < 8; ++i) {
+            waypoints.push_back(makeWaypoint(35.0 + i * 0.05, 129.0 + i * 0.05, 10.0f));
+        }
+        missileManager->updateWaypoints(waypoints);
+    }
+
+    size_t sink = 0;
+    runner.run("getMissileEngagementResult marshalling", 100000, [&]() {
+        auto result = missileManager->getMissileEngagementResult();
+        sink += result.value().unCntTrajectory();
+    });
+    (void)sink;
+}
+
+// 교전계획 변화 감지: 최대 크기 계획의 내용 해시와 내용이 같은 재계산 (세대 비교만, 콜백 없음)
+void benchEngagementPlanChangeDetection(BenchmarkRunner& runner) {
+    EngagementPlanResult plan;
+    plan.isValid = true;
+    plan.trajectory.resize(MAX_TRAJECTORY_POINTS);
+    for (size_t i = 0; i < plan.trajectory.size(); ++i) {
+        plan.trajectory[i].dLatitude() = 35.0 + i * 0.001;
+        plan.trajectory[i].dLongitude() = 129.0 + i * 0.001;
+    }
+    for (int i = 0; i < 8; ++i) {
+        plan.waypoints.push_back(makeWaypoint(35.0 + i * 0.05, 129.0 + i * 0.05, 10.0f));
+    }
+
+    uint64_t sink = 0;
+    runner.run("HashEngagementPlanContent (128 points)", 200000, [&]() {
+        sink += HashEngagementPlanContent(plan);
+    });
+
+    auto manager = makeAssignedManager(1, false);
+    uint64_t callbacks = 0;
+    manager->setEngagementPlanCallback([&callbacks](uint16_t, const EngagementPlanResult&) { ++callbacks; });
+    manager->calculateEngagementPlan(1);
+    callbacks = 0;
+
+    runner.run("calculateEngagementPlan (unchanged plan)", 100000, [&]() {
+        manager->calculateEngagementPlan(1);
+    });
+    if (callbacks != 0) {
+        std::cout << "  unexpected engagement plan callbacks for unchanged plan: " << callbacks << std::endl;
+    }
+    (void)sink;
+}
+
+void benchSystemConfigGet(BenchmarkRunner& runner) {
+    auto& config = SystemConfig::getInstance();
+    config.set("Weapon.ALMSpeed", "300.0");
+    config.set("Paths.MineDataPath", "data/mine_plans");
+    volatile double numberSink = 0.0;
+    size_t stringSink = 0;
+
+    runner.run("SystemConfig::get<double>", 500000, [&]() {
+        numberSink = config.get<double>("Weapon.ALMSpeed", 0.0);
+    });
+
+    runner.run("SystemConfig::get<std::string>", 500000, [&]() {
+        stringSink += config.get<std::string>("Paths.MineDataPath", "").size();
+    });
+
+    runner.run("SystemConfig::get<ConfigKey::ALM_SPEED>", 500000, [&]() {
+        numberSink = config.get<ConfigKey::ALM_SPEED>();
+    });
+    (void)numberSink;
+    (void)stringSink;
+}
+
+void benchMineMissionVirtualTime(BenchmarkRunner& runner) {
+    // 전원 인가 3초 + 발사 3단계 + 300초 주행을 가상 시각으로 빨리감기
+    SystemConfig::getInstance().set("Weapon.DefaultLaunchDelay", "3.0");
+    auto virtualClock = std::make_shared<VirtualClock>();
+    ClockProvider::ScopedOverride clockOverride(*virtualClock);
+    const auto tick = std::chrono::milliseconds(100);
+
+    runner.run("Mine mission 300 s (virtual clock, 100 ms ticks)", 5, [&]() {
+        LaunchTubeManager manager(1);
+        manager.initialize();
+
+        WeaponAssignmentRequest request;
+        request.tubeNumber = 1;
+        request.weaponKind = EN_WPN_KIND::WPN_KIND_M_MINE;
+        request.assignmentInfo.tubeNumber = 1;
+        request.assignmentInfo.weaponKind = EN_WPN_KIND::WPN_KIND_M_MINE;
+        manager.assignWeapon(request);
+
+        WeaponControlRequest control;
+        control.tubeNumber = 1;
+        control.targetState = EN_WPN_CTRL_STATE::WPN_CTRL_STATE_ON;
+        manager.requestWeaponStateChange(control);
+        manager.update();   // ON -> RTL (교전계획 유효)
+
+        control.targetState = EN_WPN_CTRL_STATE::WPN_CTRL_STATE_LAUNCH;
+        manager.requestWeaponStateChange(control);
+
+        auto missionEnd = virtualClock->now() + std::chrono::seconds(300);
+        while (virtualClock->now() < missionEnd) {
+            manager.update();
+            virtualClock->advance(tick);
+        }
+        manager.shutdown();
+    });
+
+    SystemConfig::getInstance().set("Weapon.DefaultLaunchDelay", "0");
+}
+
+void benchMineDropPlanSaveLoad(BenchmarkRunner& runner) {
+    auto dataPath = (std::filesystem::temp_directory_path() / "weapon_control_bench_mine").string();
+    std::filesystem::remove_all(dataPath);
+
+    MineDropPlanService service(dataPath);
+    {
+        ScopedCoutSilencer silencer;
+        service.initialize(dataPath);
+    }
+
+    std::vector<ST_M_MINE_PLAN_INFO> plans;
+    for (uint16_t n = 1; n <= 10; ++n) {
+        ST_M_MINE_PLAN_INFO plan;
+        plan.sListID() = 1;
+        plan.usDroppingPlanNumber() = n;
+        plan.stLaunchPos() = makeWaypoint(35.0, 129.0, 0.0f);
+        plan.stDropPos() = makeWaypoint(35.1 + n * 0.01, 129.1, 50.0f);
+        plan.usWaypointCnt() = 4;
+        for (int i = 0; i < 4; ++i) {
+            plan.stWaypoint()[i] = makeWaypoint(35.02 + i * 0.02, 129.02 + i * 0.02, 20.0f);
+        }
+        plans.push_back(plan);
+    }
+
+    runner.run("MineDropPlanService::savePlanList (10 plans)", 2000, [&]() {
+        service.savePlanList(1, plans);
+    });
+
+    runner.run("MineDropPlanService::loadPlanList", 2000, [&]() {
+        service.loadPlanList(1);
+    });
+
+    std::filesystem::remove_all(dataPath);
+}
+
+} // namespace
+
+int main(int argc, char* argv[]) {
+    std::string jsonPath = "bench_results.json";
+    double scale = 1.0;
+
+    for (int i = 1; i < argc; ++i) {
+        std::string arg = argv[i];
+        if (arg == "--json" && i + 1 < argc) {
+            jsonPath = argv[++i];
+        } else if (arg == "--scale" && i + 1 < argc) {
+            scale = std::stod(argv[++i]);
+        }
+    }
+
+    BenchmarkRunner runner(scale);
+    BenchmarkRunner::printHeader();
+
+    benchIsValidTransition(runner);
+    benchRequestStateChange(runner);
+    benchGetAllTubeStatus(runner);
+    benchUpdateTargetInfoFanOut(runner);
+    benchAssignedTubeIteration(runner);
+    benchUpdateByActivity(runner);
+    benchGetMissileEngagementResult(runner);
+    benchEngagementPlanChangeDetection(runner);
+    benchSystemConfigGet(runner);
+    benchMineDropPlanSaveLoad(runner);
+    benchMineMissionVirtualTime(runner);
+
+    if (!runner.writeJson(jsonPath, "core-control-path")) {
+        std::cerr << "Failed to write " << jsonPath << std::endl;
+        return 1;
+    }
+
+    std::cout << "Results written to " << jsonPath << std::endl;
+    return 0;
+}
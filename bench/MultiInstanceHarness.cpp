@@ -0,0 +1,459 @@
+// =============================================================================
+// 다중 인스턴스 시뮬레이션 하네스
+//
+// 한 프로세스에서 독립된 WeaponControlService 인스턴스(플랫폼 1개씩)를 여러 개
+// 생성하고, 스레드 풀에서 가상 시각으로 시나리오를 실행한다. 인스턴스마다
+// 자체 VirtualClock 을 가지며 (ClockProvider::ScopedOverride) 전원 인가/발사
+// 단계 대기는 즉시 진행된다. 인스턴스/발사관당 메모리와 전체 처리량을 출력한다.
+//
+// 사용법: MultiInstanceHarness [옵션]
+//   --instances N        인스턴스 수 (기본 64)
+//   --tubes LIST         인스턴스당 발사관 수, 쉼표로 여러 값 지정 시 차례로 실행 (기본 6)
+//   --threads N          작업 스레드 수 (기본 하드웨어 스레드 수)
+//   --ticks N            인스턴스당 주기 수 (기본 600, 100ms 주기 기준 60초)
+//   --targets N          인스턴스당 표적 수 (기본 16)
+//   --json PATH          결과 JSON 저장
+//
+// AllocationHooks.cpp 와 함께 링크해야 메모리 항목이 집계된다.
+// =============================================================================
+
+#include "BenchSupport.h"
+#include "../Core/Service/WeaponControlService.h"
+#include "../Infrastructure/Configuration/SystemConfig.h"
+#include "../Common/Utils/Clock.h"
+#include <atomic>
+#include <filesystem>
+#include <memory>
+#include <random>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace WeaponControl;
+using namespace WeaponControl::Bench;
+
+namespace {
+
+using Clock = std::chrono::steady_clock;
+
+// -----------------------------------------------------------------------------
+// 설정
+// -----------------------------------------------------------------------------
+
+struct HarnessConfig {
+    uint32_t instances = 64;
+    std::vector<uint16_t> tubeCounts = {6};
+    uint32_t threads = std::max(1u, std::thread::hardware_concurrency());
+    uint32_t ticks = 600;
+    uint32_t targets = 16;
+    std::string jsonPath;
+};
+
+std::vector<uint16_t> parseTubeList(const std::string& value) {
+    std::vector<uint16_t> result;
+    std::stringstream stream(value);
+    std::string item;
+    while (std::getline(stream, item, ',')) {
+        if (!item.empty()) {
+            result.push_back(static_cast<uint16_t>(std::stoi(item)));
+        }
+    }
+    return result;
+}
+
+HarnessConfig parseArguments(int argc, char* argv[]) {
+    HarnessConfig config;
+
+    for (int i = 1; i + 1 < argc; i += 2) {
+        std::string arg = argv[i];
+        std::string value = argv[i + 1];
+
+        if (arg == "--instances") config.instances = static_cast<uint32_t>(std::stoul(value));
+        else if (arg == "--tubes") config.tubeCounts = parseTubeList(value);
+        else if (arg == "--threads") config.threads = std::max(1u, static_cast<uint32_t>(std::stoul(value)));
+        else if (arg == "--ticks") config.ticks = static_cast<uint32_t>(std::stoul(value));
+        else if (arg == "--targets") config.targets = std::max(1u, static_cast<uint32_t>(std::stoul(value)));
+        else if (arg == "--json") config.jsonPath = value;
+        else std::cerr << "Unknown option: " << arg << std::endl;
+    }
+
+    if (config.tubeCounts.empty()) {
+        config.tubeCounts = {6};
+    }
+    return config;
+}
+
+// -----------------------------------------------------------------------------
+// 메시지 생성
+// -----------------------------------------------------------------------------
+
+// 짝수 발사관 ASM, 홀수 발사관 ALM
+WeaponAssignmentRequest makeStrikeAssignment(uint16_t tube, uint32_t targetId) {
+    EN_WPN_KIND kind = (tube % 2 == 0) ? EN_WPN_KIND::WPN_KIND_ASM : EN_WPN_KIND::WPN_KIND_ALM;
+    return makeAssignment(tube, targetId, kind);
+}
+
+std::vector<ST_WEAPON_WAYPOINT> makeWaypoints(std::mt19937& rng) {
+    std::uniform_int_distribution<int> countDist(1, 8);
+    std::uniform_real_distribution<double> offsetDist(-0.05, 0.05);
+
+    std::vector<ST_WEAPON_WAYPOINT> waypoints(countDist(rng));
+    for (size_t i = 0; i < waypoints.size(); ++i) {
+        waypoints[i].dLatitude() = 35.0 + i * 0.02 + offsetDist(rng);
+        waypoints[i].dLongitude() = 129.0 + i * 0.02 + offsetDist(rng);
+        waypoints[i].fDepth() = 10.0f;
+    }
+    return waypoints;
+}
+
+// -----------------------------------------------------------------------------
+// 시뮬레이션 인스턴스 (플랫폼 1개)
+// -----------------------------------------------------------------------------
+
+struct InstanceCounters {
+    uint64_t ticks = 0;
+    uint64_t tubeUpdates = 0;
+    uint64_t commands = 0;
+    uint64_t failures = 0;
+    uint64_t tracks = 0;
+    uint64_t callbacks = 0;
+};
+
+class SimulatedPlatform {
+public:
+    SimulatedPlatform(uint32_t id, uint16_t tubes, uint32_t targets, const std::string& dataPath)
+        : m_id(id)
+        , m_tubes(tubes)
+        , m_targets(targets)
+        , m_clock(true)
+        , m_rng(id * 7919u + 17u)
+        , m_service(std::make_unique<LaunchTubeManager>(tubes),
+                    std::make_unique<TargetTrackingService>(),
+                    std::make_unique<MineDropPlanService>(dataPath))
+    {
+        m_service.setStateChangeCallback([this](uint16_t, EN_WPN_CTRL_STATE, EN_WPN_CTRL_STATE) {
+            ++m_counters.callbacks;
+        });
+        m_service.setEngagementPlanCallback([this](uint16_t, const EngagementPlanResult&) {
+            ++m_counters.callbacks;
+        });
+    }
+
+    Result<void> initialize() {
+        ClockProvider::ScopedOverride clockOverride(m_clock);
+        return m_service.initialize();
+    }
+
+    void assignAll() {
+        ClockProvider::ScopedOverride clockOverride(m_clock);
+        for (uint16_t tube = 1; tube <= m_tubes; ++tube) {
+            command(m_service.assignWeapon(makeStrikeAssignment(tube, (tube - 1) % m_targets + 1)));
+        }
+    }
+
+    // 시나리오 1주기: 표적/항법 갱신, 주기 update, 일정 주기마다 통제/편집/발사/재할당
+    void step(uint32_t tick, std::chrono::milliseconds tickInterval) {
+        ClockProvider::ScopedOverride clockOverride(m_clock);
+
+        for (uint32_t target = 1; target <= m_targets; ++target) {
+            m_service.updateTargetInfo(makeTrack(target, tick * 0.05 + m_id));
+            ++m_counters.tracks;
+        }
+        if (tick % 10 == 0) {
+            NAVINF_SHIP_NAVIGATION_INFO ownShip;
+            m_service.updateOwnShipInfo(ownShip);
+        }
+
+        uint32_t phase = tick % SCENARIO_PERIOD;
+        if (phase == 5) {
+            controlAll(EN_WPN_CTRL_STATE::WPN_CTRL_STATE_ON);
+        } else if (phase == 150) {
+            // 절반 발사 (RTL 이 아니면 실패로 집계)
+            for (uint16_t tube = 1; tube <= m_tubes; tube += 2) {
+                control(tube, EN_WPN_CTRL_STATE::WPN_CTRL_STATE_LAUNCH);
+            }
+        } else if (phase == SCENARIO_PERIOD - 10) {
+            command(m_service.emergencyStop());
+        } else if (phase == SCENARIO_PERIOD - 5) {
+            for (uint16_t tube = 1; tube <= m_tubes; ++tube) {
+                command(m_service.unassignWeapon(tube));
+            }
+        } else if (phase == SCENARIO_PERIOD - 1) {
+            for (uint16_t tube = 1; tube <= m_tubes; ++tube) {
+                command(m_service.assignWeapon(makeStrikeAssignment(tube, (tube + tick) % m_targets + 1)));
+            }
+        } else if (phase % 20 == 7) {
+            WaypointUpdateRequest request;
+            request.tubeNumber = static_cast<uint16_t>(m_rng() % m_tubes + 1);
+            request.waypoints = makeWaypoints(m_rng);
+            command(m_service.updateWaypoints(request));
+        }
+
+        m_service.update();
+        m_clock.advance(tickInterval);
+        ++m_counters.ticks;
+        m_counters.tubeUpdates += m_service.getAssignedTubeCount();
+    }
+
+    void shutdown() {
+        ClockProvider::ScopedOverride clockOverride(m_clock);
+        m_service.shutdown();
+    }
+
+    const InstanceCounters& counters() const { return m_counters; }
+    double simulatedSeconds() const { return std::chrono::duration<double>(m_clock.elapsed()).count(); }
+
+private:
+    static constexpr uint32_t SCENARIO_PERIOD = 300;
+
+    void command(const Result<void>& result) {
+        ++m_counters.commands;
+        if (!result) {
+            ++m_counters.failures;
+        }
+    }
+
+    void control(uint16_t tube, EN_WPN_CTRL_STATE state) {
+        WeaponControlRequest request;
+        request.tubeNumber = tube;
+        request.targetState = state;
+        command(m_service.controlWeapon(request));
+    }
+
+    void controlAll(EN_WPN_CTRL_STATE state) {
+        for (uint16_t tube = 1; tube <= m_tubes; ++tube) {
+            control(tube, state);
+        }
+    }
+
+    uint32_t m_id;
+    uint16_t m_tubes;
+    uint32_t m_targets;
+    VirtualClock m_clock;
+    std::mt19937 m_rng;
+    WeaponControlService m_service;
+    InstanceCounters m_counters;
+};
+
+// -----------------------------------------------------------------------------
+// 실행 및 집계
+// -----------------------------------------------------------------------------
+
+struct RunResult {
+    uint16_t tubes = 0;
+    double buildSec = 0.0;
+    double runSec = 0.0;
+    double simulatedSec = 0.0;
+    double bytesPerInstance = 0.0;      // 생성 + 초기화 직후 (무장 미할당)
+    double bytesPerTube = 0.0;          // 할당으로 증가한 메모리 / 전체 발사관 수
+    double peakRssMb = 0.0;
+    InstanceCounters totals;
+};
+
+int64_t liveBytes() {
+    return allocationCounters().liveBytes.load(std::memory_order_relaxed);
+}
+
+double residentSetMb() {
+#ifdef __linux__
+    std::ifstream statm("/proc/self/statm");
+    long pages = 0;
+    long resident = 0;
+    if (statm >> pages >> resident) {
+        return resident * static_cast<double>(sysconf(_SC_PAGESIZE)) / (1024.0 * 1024.0);
+    }
+#endif
+    return 0.0;
+}
+
+// 작업 스레드 w 가 항목 w, w+T, w+2T ... 를 처리
+template <typename Fn>
+void runOnPool(uint32_t threadCount, size_t itemCount, Fn fn) {
+    std::vector<std::thread> workers;
+    for (uint32_t w = 0; w < threadCount; ++w) {
+        workers.emplace_back([=, &fn]() {
+            for (size_t i = w; i < itemCount; i += threadCount) {
+                fn(i);
+            }
+        });
+    }
+    for (auto& worker : workers) {
+        worker.join();
+    }
+}
+
+RunResult runConfiguration(const HarnessConfig& config, uint16_t tubes, const std::string& dataRoot) {
+    RunResult result;
+    result.tubes = tubes;
+    auto tickInterval = std::chrono::milliseconds(SystemConfig::getInstance().getUpdateInterval());
+
+    std::vector<std::unique_ptr<SimulatedPlatform>> platforms(config.instances);
+
+    int64_t bytesBefore = liveBytes();
+    auto buildStart = Clock::now();
+    for (uint32_t i = 0; i < config.instances; ++i) {
+        auto dataPath = dataRoot + "/platform_" + std::to_string(i);
+        platforms[i] = std::make_unique<SimulatedPlatform>(i, tubes, config.targets, dataPath);
+        auto initResult = platforms[i]->initialize();
+        if (!initResult) {
+            std::cerr << "Instance " << i << " initialization failed: " << initResult.error().message << std::endl;
+        }
+    }
+    int64_t bytesInitialized = liveBytes();
+
+    for (auto& platform : platforms) {
+        platform->assignAll();
+    }
+    int64_t bytesAssigned = liveBytes();
+    result.buildSec = std::chrono::duration<double>(Clock::now() - buildStart).count();
+
+    result.bytesPerInstance = static_cast<double>(bytesInitialized - bytesBefore) / config.instances;
+    result.bytesPerTube = static_cast<double>(bytesAssigned - bytesInitialized) / (static_cast<double>(config.instances) * tubes);
+
+    // 인스턴스를 스레드에 고정하고 주기 단위로 번갈아 진행
+    auto runStart = Clock::now();
+    std::vector<std::thread> workers;
+    uint32_t threadCount = std::min<uint32_t>(config.threads, config.instances);
+    for (uint32_t w = 0; w < threadCount; ++w) {
+        workers.emplace_back([&, w]() {
+            for (uint32_t tick = 0; tick < config.ticks; ++tick) {
+                for (size_t i = w; i < platforms.size(); i += threadCount) {
+                    platforms[i]->step(tick, tickInterval);
+                }
+            }
+        });
+    }
+    for (auto& worker : workers) {
+        worker.join();
+    }
+    result.runSec = std::chrono::duration<double>(Clock::now() - runStart).count();
+    result.peakRssMb = residentSetMb();
+
+    for (auto& platform : platforms) {
+        const auto& counters = platform->counters();
+        result.totals.ticks += counters.ticks;
+        result.totals.tubeUpdates += counters.tubeUpdates;
+        result.totals.commands += counters.commands;
+        result.totals.failures += counters.failures;
+        result.totals.tracks += counters.tracks;
+        result.totals.callbacks += counters.callbacks;
+        result.simulatedSec = std::max(result.simulatedSec, platform->simulatedSeconds());
+    }
+
+    runOnPool(threadCount, platforms.size(), [&](size_t i) {
+        platforms[i]->shutdown();
+    });
+    platforms.clear();
+
+    return result;
+}
+
+// -----------------------------------------------------------------------------
+// 출력
+// -----------------------------------------------------------------------------
+
+void printResults(const HarnessConfig& config, const std::vector<RunResult>& results) {
+    std::cout << "\n" << config.instances << " instances, " << config.threads << " threads, "
+              << config.ticks << " ticks/instance, " << config.targets << " targets/instance" << std::endl;
+    std::cout << std::setw(6) << "tubes" << std::setw(10) << "run s" << std::setw(10) << "sim s"
+              << std::setw(14) << "ticks/s" << std::setw(16) << "tube-upd/s" << std::setw(12) << "cmds/s"
+              << std::setw(10) << "fail" << std::setw(12) << "KB/inst" << std::setw(10) << "KB/tube"
+              << std::setw(10) << "RSS MB" << std::endl;
+
+    for (const auto& r : results) {
+        std::cout << std::fixed << std::setprecision(2)
+                  << std::setw(6) << r.tubes << std::setw(10) << r.runSec << std::setw(10) << r.simulatedSec
+                  << std::setprecision(0)
+                  << std::setw(14) << r.totals.ticks / r.runSec
+                  << std::setw(16) << r.totals.tubeUpdates / r.runSec
+                  << std::setw(12) << r.totals.commands / r.runSec
+                  << std::setw(10) << r.totals.failures
+                  << std::setprecision(1)
+                  << std::setw(12) << r.bytesPerInstance / 1024.0
+                  << std::setw(10) << r.bytesPerTube / 1024.0
+                  << std::setw(10) << r.peakRssMb << std::defaultfloat << std::endl;
+    }
+
+    // 발사관 수를 바꿔 실행한 경우 주기 비용을 인스턴스 고정분과 발사관당 증분으로 분리
+    if (results.size() >= 2) {
+        const auto& a = results.front();
+        const auto& b = results.back();
+        double usPerTickA = a.runSec * 1e6 * config.threads / a.totals.ticks;
+        double usPerTickB = b.runSec * 1e6 * config.threads / b.totals.ticks;
+        if (b.tubes != a.tubes) {
+            double perTube = (usPerTickB - usPerTickA) / (b.tubes - a.tubes);
+            double fixed = usPerTickA - perTube * a.tubes;
+            std::cout << std::fixed << std::setprecision(2)
+                      << "Tick cost model: " << fixed << " us/instance + " << perTube << " us/tube (thread time)"
+                      << std::defaultfloat << std::endl;
+        }
+    }
+}
+
+void writeJson(const std::string& path, const HarnessConfig& config, const std::vector<RunResult>& results) {
+    std::ofstream file(path);
+    if (!file.is_open()) {
+        std::cerr << "Failed to write " << path << std::endl;
+        return;
+    }
+
+    file << "{\n";
+    file << "  \"suite\": \"multi-instance-harness\",\n";
+    file << "  \"schemaVersion\": 1,\n";
+    file << "  \"instances\": " << config.instances << ",\n";
+    file << "  \"threads\": " << config.threads << ",\n";
+    file << "  \"ticksPerInstance\": " << config.ticks << ",\n";
+    file << "  \"targetsPerInstance\": " << config.targets << ",\n";
+    file << "  \"runs\": [\n";
+
+    for (size_t i = 0; i < results.size(); ++i) {
+        const auto& r = results[i];
+        file << "    {\"tubes\": " << r.tubes
+             << ", \"buildSec\": " << r.buildSec
+             << ", \"runSec\": " << r.runSec
+             << ", \"simulatedSec\": " << r.simulatedSec
+             << ", \"ticksPerSec\": " << r.totals.ticks / r.runSec
+             << ", \"tubeUpdatesPerSec\": " << r.totals.tubeUpdates / r.runSec
+             << ", \"commandsPerSec\": " << r.totals.commands / r.runSec
+             << ", \"commandFailures\": " << r.totals.failures
+             << ", \"tracks\": " << r.totals.tracks
+             << ", \"callbacks\": " << r.totals.callbacks
+             << ", \"bytesPerInstance\": " << r.bytesPerInstance
+             << ", \"bytesPerTube\": " << r.bytesPerTube
+             << ", \"rssMb\": " << r.peakRssMb << "}"
+             << (i + 1 < results.size() ? "," : "") << "\n";
+    }
+
+    file << "  ]\n";
+    file << "}\n";
+}
+
+} // namespace
+
+int main(int argc, char* argv[]) {
+    auto config = parseArguments(argc, argv);
+
+    // 전원 인가 지연 제거 (발사 단계는 가상 시각으로 즉시 진행)
+    SystemConfig::getInstance().set("Weapon.DefaultLaunchDelay", "0");
+
+    auto dataRoot = (std::filesystem::temp_directory_path() / "weapon_control_multi_instance").string();
+    std::filesystem::remove_all(dataRoot);
+
+    std::vector<RunResult> results;
+    for (uint16_t tubes : config.tubeCounts) {
+        std::cout << "Running " << config.instances << " instances x " << tubes << " tubes..." << std::endl;
+        ScopedCoutSilencer silencer;
+        results.push_back(runConfiguration(config, tubes, dataRoot));
+    }
+
+    printResults(config, results);
+
+    if (!config.jsonPath.empty()) {
+        writeJson(config.jsonPath, config, results);
+        std::cout << "\nResults written to " << config.jsonPath << std::endl;
+    }
+
+    std::filesystem::remove_all(dataRoot);
+    return 0;
+}
@@ -0,0 +1,323 @@
+// =============================================================================
+// 상시 대기 이중화 벤치마크
+//
+// 1) 게시 비용: 상태 전이 명령(controlWeapon ON/OFF)의 이중화 유무별 비용
+//    (별도 스레드가 대기 프로세스처럼 채널을 계속 소비)
+// 2) 미러링: 주/대기 서비스를 한 프로세스에서 주기 교대로 실행하며 할당/경로점/
+//    전원 인가/발사/표적 갱신 후 대기 측 발사관 상태, 환경 세대, 교전계획
+//    버전이 주 인스턴스와 같은지 확인
+// 3) 승격: 주 인스턴스 주기를 멈추고 가상 시각을 제한 시간 이후로 진행한 뒤
+//    대기 측 update 한 번에 승격되는지, 승격 후 상태(RestoredWeaponState 규칙)
+//    와 승격 시간 확인
+//
+// 사용법: StandbyFailover [옵션]
+//   --tubes N        발사관 수 (기본 24)
+//   --targets M      시스템 표적 수 (기본 64)
+//   --iterations N   게시 비용 측정 반복 수 (기본 200000)
+//   --capacity N     채널 슬롯 수 (기본 2048)
+//
+// 대기 측 상태가 주 인스턴스와 다르거나 제한 시간 안에 승격되지 않으면 종료 코드 1.
+// =============================================================================
+
+#include "BenchSupport.h"
+#include "../Infrastructure/Replication/ReplicationChannel.h"
+#include <atomic>
+#include <string>
+#include <thread>
+#include <unistd.h>
+
+using namespace WeaponControl;
+using namespace WeaponControl::Bench;
+
+namespace {
+
+// -----------------------------------------------------------------------------
+// 설정
+// -----------------------------------------------------------------------------
+
+struct BenchConfig {
+    uint16_t tubes = 24;
+    uint32_t targets = 64;
+    uint64_t iterations = 200000;
+    size_t capacity = 2048;
+};
+
+BenchConfig parseArguments(int argc, char* argv[]) {
+    BenchConfig config;
+    OptionParser()
+        .add("--tubes", config.tubes, 2)
+        .add("--targets", config.targets, 1)
+        .add("--iterations", config.iterations)
+        .add("--capacity", config.capacity, 64)
+        .parse(argc, argv);
+    return config;
+}
+
+ReplicationConfig makeReplicationConfig(const BenchConfig& config, const std::string& channelName, ReplicationRole role) {
+    ReplicationConfig replication;
+    replication.role = role;
+    replication.channelName = channelName;
+    replication.capacity = config.capacity;
+    replication.heartbeatTimeoutMs = 300;
+    return replication;
+}
+
+// -----------------------------------------------------------------------------
+// 게시 비용
+// -----------------------------------------------------------------------------
+
+void measurePublishCost(const BenchConfig& config, const ServiceFixture& fixture, const std::string& channelName) {
+    BenchmarkRunner::printHeader();
+    BenchmarkRunner runner;
+
+    // 상태 전이 명령: ON(POC -> ON) + OFF = 전이 3회
+    double transitionNs[2] = {0.0, 0.0};
+    for (int withReplication = 0; withReplication < 2; ++withReplication) {
+        std::unique_ptr<WeaponControlService> service;
+        {
+            ScopedCoutSilencer silencer;
+            service = fixture.makeService(config.tubes);
+            service->initialize();
+            if (withReplication) {
+                service->startReplication(makeReplicationConfig(config, channelName, ReplicationRole::PRIMARY));
+            }
+            service->assignWeapon(makeAssignment(1, 1));
+        }
+
+        // 대기 프로세스 대신 채널을 계속 비우는 소비 스레드
+        std::atomic<bool> running{true};
+        std::thread consumer;
+        if (withReplication) {
+            consumer = std::thread([&]() {
+                ReplicationChannel channel;
+                if (!channel.attach(makeReplicationConfig(config, channelName, ReplicationRole::STANDBY))) {
+                    return;
+                }
+                while (running.load(std::memory_order_relaxed)) {
+                    if (channel.discardPending() == 0) {
+                        std::this_thread::yield();
+                    }
+                }
+            });
+        }
+
+        WeaponControlRequest on;
+        on.tubeNumber = 1;
+        on.targetState = EN_WPN_CTRL_STATE::WPN_CTRL_STATE_ON;
+        WeaponControlRequest off = on;
+        off.targetState = EN_WPN_CTRL_STATE::WPN_CTRL_STATE_OFF;
+
+        const auto& result = runner.run(withReplication ? "controlWeapon ON+OFF (replicated)" : "controlWeapon ON+OFF (standalone)",
+                                        config.iterations / 10, [&]() {
+            service->controlWeapon(on);
+            service->controlWeapon(off);
+        });
+        transitionNs[withReplication] = result.nsPerOp / 3.0;
+
+        running = false;
+        if (consumer.joinable()) {
+            consumer.join();
+        }
+
+        ScopedCoutSilencer silencer;
+        service->shutdown();
+    }
+
+    std::cout << "  -> replication overhead per state transition: " << std::fixed << std::setprecision(1)
+              << transitionNs[1] - transitionNs[0] << " ns (" << transitionNs[0] << " -> " << transitionNs[1]
+              << " ns)" << std::defaultfloat << std::endl;
+    ReplicationChannel::unlink(channelName);
+}
+
+// -----------------------------------------------------------------------------
+// 미러 비교
+// -----------------------------------------------------------------------------
+
+struct TubeSnapshot {
+    bool hasWeapon = false;
+    EN_WPN_KIND weaponKind = EN_WPN_KIND::WPN_KIND_NA;
+    EN_WPN_CTRL_STATE state = EN_WPN_CTRL_STATE::WPN_CTRL_STATE_OFF;
+    bool launched = false;
+};
+
+std::vector<TubeSnapshot> snapshotTubes(const WeaponControlService& service) {
+    std::vector<TubeSnapshot> snapshot;
+    for (const auto& status : service.getAllTubeStatus()) {
+        snapshot.push_back(TubeSnapshot{status.hasWeapon, status.weaponKind, status.weaponState, status.launched});
+    }
+    return snapshot;
+}
+
+// settle 이면 승격 시 정리 규칙(RestoredWeaponState)을 적용한 기대값과 비교
+size_t compareTubes(const std::vector<TubeSnapshot>& expected, const std::vector<TubeSnapshot>& actual, bool settle) {
+    size_t mismatches = 0;
+    for (size_t i = 0; i < expected.size() && i < actual.size(); ++i) {
+        const auto& want = expected[i];
+        const auto& got = actual[i];
+        EN_WPN_CTRL_STATE expectedState = want.state;
+        if (settle && want.hasWeapon) {
+            EN_WPN_CTRL_STATE restored = RestoredWeaponState(want.state, want.launched);
+            // RTL 은 승격 후에도 그대로 유지 (ON 과 같은 전원 인가 상태)
+            expectedState = want.state == EN_WPN_CTRL_STATE::WPN_CTRL_STATE_RTL ? want.state : restored;
+        }
+
+        if (got.hasWeapon != want.hasWeapon || got.weaponKind != want.weaponKind
+            || got.launched != want.launched || got.state != expectedState) {
+            std::cout << "  mismatch tube " << i + 1 << ": expected " << WeaponKindToString(want.weaponKind)
+                      << " " << StateToString(expectedState) << ", standby " << WeaponKindToString(got.weaponKind)
+                      << " " << StateToString(got.state) << std::endl;
+            ++mismatches;
+        }
+    }
+    return mismatches + (expected.size() != actual.size() ? 1 : 0);
+}
+
+void printStatus(const char* label, const ReplicationStatus& status) {
+    std::cout << "  " << std::left << std::setw(16) << label << std::right
+              << std::setw(9) << ReplicationRoleName(status.role)
+              << std::setw(7) << (status.synchronized ? "yes" : "no")
+              << std::setw(9) << status.backlog
+              << std::setw(9) << status.environmentGeneration
+              << std::setw(9) << status.primaryEnvironmentGeneration
+              << std::setw(10) << status.applyFailures << std::endl;
+}
+
+// 주 인스턴스 주기 + 대기 인스턴스 적용
+void tick(VirtualClock& clock, WeaponControlService& primary, WeaponControlService& standby) {
+    clock.advance(std::chrono::milliseconds(20));
+    primary.update();
+    standby.update();
+}
+
+} // namespace
+
+int main(int argc, char* argv[]) {
+    auto config = parseArguments(argc, argv);
+
+    ServiceFixture fixture("standby");
+    auto& clock = fixture.clock();
+    auto channelName = "/weapon_control_standby_bench_" + std::to_string(getpid());
+    ReplicationChannel::unlink(channelName);
+
+    std::cout << "Standby replication: " << config.tubes << " tubes, " << config.targets << " targets, "
+              << config.capacity << " slots" << std::endl << std::endl;
+    measurePublishCost(config, fixture, channelName);
+
+    std::unique_ptr<WeaponControlService> primary;
+    std::unique_ptr<WeaponControlService> standby;
+    {
+        ScopedCoutSilencer silencer;
+        primary = fixture.makeService(config.tubes);
+        primary->initialize();
+        primary->startReplication(makeReplicationConfig(config, channelName, ReplicationRole::PRIMARY));
+
+        standby = fixture.makeService(config.tubes);
+        standby->initialize();
+        standby->startReplication(makeReplicationConfig(config, channelName, ReplicationRole::STANDBY));
+
+        // 대기 측 재전송 요청 -> 주 인스턴스 전체 재전송 -> 대기 측 적용
+        tick(clock, *primary, *standby);
+        tick(clock, *primary, *standby);
+
+        for (uint32_t target = 1; target <= config.targets; ++target) {
+            primary->updateTargetInfo(makeTrack(target, 0.0));
+        }
+        for (uint16_t tube = 1; tube < config.tubes; ++tube) {
+            primary->assignWeapon(makeAssignment(tube, (tube - 1) % config.targets + 1));
+            if (tube % 4 == 0) {
+                primary->updateWaypoints(makeWaypoints(tube, 6));
+            }
+        }
+        tick(clock, *primary, *standby);
+
+        // 발사관 4개 중 3개 전원 인가, 그 중 일부 발사
+        WeaponControlRequest control;
+        control.targetState = EN_WPN_CTRL_STATE::WPN_CTRL_STATE_ON;
+        for (uint16_t tube = 1; tube < config.tubes; ++tube) {
+            if (tube % 4 != 2) {
+                control.tubeNumber = tube;
+                primary->controlWeapon(control);
+            }
+        }
+        tick(clock, *primary, *standby);
+        control.targetState = EN_WPN_CTRL_STATE::WPN_CTRL_STATE_LAUNCH;
+        for (uint16_t tube = 1; tube < config.tubes; tube += 4) {
+            control.tubeNumber = tube;
+            primary->controlWeapon(control);
+        }
+        for (int i = 0; i < 5; ++i) {
+            for (uint32_t target = 1; target <= config.targets; ++target) {
+                primary->updateTargetInfo(makeTrack(target, 0.1 * (i + 1)));
+            }
+            tick(clock, *primary, *standby);
+        }
+    }
+
+    std::cout << std::endl << "Mirror after " << primary->getReplicationStatus().environmentGeneration
+              << " environment updates:" << std::endl;
+    std::cout << "  " << std::left << std::setw(16) << "instance" << std::right
+              << std::setw(9) << "role" << std::setw(7) << "sync" << std::setw(9) << "backlog"
+              << std::setw(9) << "envGen" << std::setw(9) << "primary" << std::setw(10) << "failures" << std::endl;
+
+    auto primaryStatus = primary->getReplicationStatus();
+    auto standbyStatus = standby->getReplicationStatus();
+    printStatus("primary", primaryStatus);
+    printStatus("standby", standbyStatus);
+
+    auto primaryTubes = snapshotTubes(*primary);
+    size_t mirrorMismatches = compareTubes(primaryTubes, snapshotTubes(*standby), false);
+    bool generationsMatch = standbyStatus.environmentGeneration == primaryStatus.environmentGeneration;
+    bool planVersionsMatch = standbyStatus.planVersions == primaryStatus.planVersions;
+    bool mirrored = standbyStatus.synchronized && mirrorMismatches == 0 && generationsMatch && planVersionsMatch
+                 && standbyStatus.applyFailures == 0;
+
+    // 주 인스턴스 주기 정지 (비정상 정지 모사) 후 제한 시간 경과
+    clock.advance(std::chrono::milliseconds(400));
+    {
+        ScopedCoutSilencer silencer;
+        standby->update();
+    }
+    standbyStatus = standby->getReplicationStatus();
+
+    // 승격 인스턴스는 교전계획을 다시 계산하므로 RTL 이 ON 을 거쳐 복귀할 때까지 몇 주기 진행
+    {
+        ScopedCoutSilencer silencer;
+        for (int i = 0; i < 3; ++i) {
+            clock.advance(std::chrono::milliseconds(20));
+            standby->update();
+        }
+    }
+    size_t promotedMismatches = compareTubes(primaryTubes, snapshotTubes(*standby), true);
+    bool promoted = standbyStatus.promoted && standbyStatus.role == ReplicationRole::NONE;
+
+    std::cout << std::endl << "Failover: " << (promoted ? "promoted" : "not promoted") << " in "
+              << std::fixed << std::setprecision(3) << standbyStatus.promotionMilliseconds << " ms"
+              << std::defaultfloat << ", " << promotedMismatches << " tube mismatches" << std::endl;
+
+    // 승격 후 명령 수락 확인
+    WeaponControlRequest off;
+    off.tubeNumber = 3;
+    off.targetState = EN_WPN_CTRL_STATE::WPN_CTRL_STATE_OFF;
+    bool acceptsCommands = false;
+    {
+        ScopedCoutSilencer silencer;
+        acceptsCommands = standby->controlWeapon(off).isSuccess();
+        standby->shutdown();
+        primary->shutdown();
+    }
+
+    ReplicationChannel::unlink(channelName);
+
+    std::cout << std::endl;
+    if (!mirrored || !promoted || promotedMismatches != 0 || !acceptsCommands) {
+        std::cout << "FAIL: mirror " << (mirrored ? "ok" : "diverged") << " (" << mirrorMismatches
+                  << " tube mismatches, generations " << (generationsMatch ? "match" : "differ")
+                  << ", plan versions " << (planVersionsMatch ? "match" : "differ") << "), failover "
+                  << (promoted ? "ok" : "missing") << ", " << promotedMismatches << " mismatches after promotion"
+                  << (acceptsCommands ? "" : ", commands rejected after promotion") << std::endl;
+        return 1;
+    }
+
+    std::cout << "PASS: standby mirrors primary and promotes within one update" << std::endl;
+    return 0;
+}
@@ -0,0 +1,335 @@
+// =============================================================================
+// 상태/교전계획 변경분 게시 벤치마크
+//
+// 대표 시나리오: 발사관 N 개 모두 유도탄 할당, 4개 중 3개 전원 인가, 일부 발사
+// (비행 중), 표적 항적은 발사관별로 1Hz 를 엇갈려 갱신, 주기 20ms, 보고 100ms.
+// 보고마다 getSystemSnapshot 을 StatusDeltaPublisher 로 게시하고
+//
+// 1) 대역폭: 매 보고 전체 프레임(키프레임) 대비 변경분 게시 바이트/초와 절감률
+// 2) 재구성: 모든 프레임을 적용한 수신 측 상태가 매 보고 스냅샷과 같은지
+// 3) 늦은 참여: 중간에 붙은 수신 측이 다음 키프레임에서 동기화되는지
+// 4) 유실: 변경분 한 프레임을 버린 수신 측이 다음 프레임에서 유실을 감지하고
+//    키프레임 요청 후 재동기화되는지
+//
+// 사용법: StatusDeltaPublication [옵션]
+//   --tubes N        발사관 수 (기본 24)
+//   --duration S     시나리오 가상 시간(초, 기본 60)
+//   --keyframe K     키프레임 간격(보고 횟수, 기본 50)
+//   --iterations N   게시 비용 측정 반복 수 (기본 20000)
+//
+// 재구성 상태가 스냅샷과 다르거나 늦은 참여/유실 수신 측이 재동기화되지 않으면 종료 코드 1.
+// =============================================================================
+
+#include "BenchSupport.h"
+#include "../Infrastructure/Publication/StatusDeltaPublisher.h"
+#include <cstring>
+#include <string>
+
+using namespace WeaponControl;
+using namespace WeaponControl::Bench;
+
+namespace {
+
+// -----------------------------------------------------------------------------
+// 설정
+// -----------------------------------------------------------------------------
+
+struct BenchConfig {
+    uint16_t tubes = 24;
+    double durationSeconds = 60.0;
+    uint32_t keyframeInterval = 50;
+    uint64_t iterations = 20000;
+};
+
+BenchConfig parseArguments(int argc, char* argv[]) {
+    BenchConfig config;
+    OptionParser()
+        .add("--tubes", config.tubes, 4)
+        .add("--duration", config.durationSeconds, 10.0)
+        .add("--keyframe", config.keyframeInterval, 2)
+        .add("--iterations", config.iterations)
+        .parse(argc, argv);
+    return config;
+}
+
+// -----------------------------------------------------------------------------
+// 시나리오
+// -----------------------------------------------------------------------------
+
+constexpr int TICK_MS = 20;
+constexpr int REPORT_MS = 100;
+
+// -----------------------------------------------------------------------------
+// 수신 측 재구성 비교 (프레임에 담는 필드만)
+// -----------------------------------------------------------------------------
+
+template<typename T>
+bool sameValue(const T& a, const T& b) {
+    return std::memcmp(&a, &b, sizeof(T)) == 0;
+}
+
+template<typename Point>
+bool samePoint(const Point& a, const Point& b) {
+    return sameValue(a.dLatitude(), b.dLatitude()) && sameValue(a.dLongitude(), b.dLongitude())
+        && sameValue(a.fDepth(), b.fDepth());
+}
+
+template<typename Point>
+bool samePoints(const std::vector<Point>& a, const std::vector<Point>& b) {
+    if (a.size() != b.size()) {
+        return false;
+    }
+    for (size_t i = 0; i < a.size(); ++i) {
+        if (!samePoint(a[i], b[i])) {
+            return false;
+        }
+    }
+    return true;
+}
+
+bool matchesSnapshot(const StatusDeltaReceiver& receiver, const SystemSnapshot& snapshot) {
+    const auto& tubes = receiver.tubes();
+    const auto& results = receiver.results();
+    if (tubes.size() != snapshot.tubes.size() || results.size() != snapshot.engagementResults.size()) {
+        return false;
+    }
+
+    for (size_t i = 0; i < tubes.size(); ++i) {
+        const auto& got = tubes[i];
+        const auto& want = snapshot.tubes[i];
+        if (got.tubeNumber != want.tubeNumber || got.hasWeapon != want.hasWeapon || got.weaponKind != want.weaponKind
+            || got.weaponState != want.weaponState || got.launched != want.launched
+            || got.engagementPlanValid != want.engagementPlanValid) {
+            return false;
+        }
+
+        const auto& plan = results[i];
+        const auto& expected = snapshot.engagementResults[i];
+        if (plan.weaponKind != expected.weaponKind || plan.isValid != expected.isValid
+            || !sameValue(plan.totalTime_sec, expected.totalTime_sec)
+            || !sameValue(plan.timeToTarget_sec, expected.timeToTarget_sec)
+            || plan.nextWaypointIndex != expected.nextWaypointIndex
+            || !sameValue(plan.timeToNextWaypoint_sec, expected.timeToNextWaypoint_sec)
+            || !samePoint(plan.currentPosition, expected.currentPosition)
+            || !samePoint(plan.launchPosition, expected.launchPosition)
+            || !samePoint(plan.targetPosition, expected.targetPosition)
+            || !samePoints(plan.trajectory, expected.trajectory)
+            || !samePoints(plan.waypoints, expected.waypoints)) {
+            return false;
+        }
+    }
+    return true;
+}
+
+struct ReceiverStats {
+    uint64_t applied = 0;
+    uint64_t rejected = 0;
+    uint64_t mismatches = 0;
+    int64_t syncedAtReport = -1;
+};
+
+} // namespace
+
+int main(int argc, char* argv[]) {
+    auto config = parseArguments(argc, argv);
+
+    ServiceFixture fixture("delta");
+    auto& clock = fixture.clock();
+    auto servicePtr = fixture.makeService(config.tubes);
+    auto& service = *servicePtr;
+
+    {
+        ScopedCoutSilencer silencer;
+        service.initialize();
+        for (uint16_t tube = 1; tube <= config.tubes; ++tube) {
+            service.assignWeapon(makeAssignment(tube, tube));
+            service.updateTargetInfo(makeTrack(tube, 0.0));
+            if (tube % 4 == 0) {
+                service.updateWaypoints(makeWaypoints(tube, 6));
+            }
+        }
+        service.update();
+
+        // 4개 중 3개 전원 인가, 그 중 일부 발사 (비행 중)
+        WeaponControlRequest control;
+        control.targetState = EN_WPN_CTRL_STATE::WPN_CTRL_STATE_ON;
+        for (uint16_t tube = 1; tube <= config.tubes; ++tube) {
+            if (tube % 4 != 2) {
+                control.tubeNumber = tube;
+                service.controlWeapon(control);
+            }
+        }
+        clock.advance(std::chrono::milliseconds(TICK_MS));
+        service.update();
+        control.targetState = EN_WPN_CTRL_STATE::WPN_CTRL_STATE_LAUNCH;
+        for (uint16_t tube = 1; tube <= config.tubes; tube += 6) {
+            control.tubeNumber = tube;
+            service.controlWeapon(control);
+        }
+        clock.advance(std::chrono::milliseconds(TICK_MS));
+        service.update();
+    }
+
+    StatusDeltaConfig deltaConfig;
+    deltaConfig.keyframeInterval = config.keyframeInterval;
+    StatusDeltaPublisher publisher(deltaConfig);
+
+    std::cout << "Status delta publication: " << config.tubes << " tubes, " << REPORT_MS << " ms reports, keyframe every "
+              << config.keyframeInterval << " reports, " << config.durationSeconds << " s" << std::endl << std::endl;
+
+    // -------------------------------------------------------------------------
+    // 시나리오 실행
+    // -------------------------------------------------------------------------
+    StatusDeltaReceiver receiver;       // 처음부터 모든 프레임 수신
+    StatusDeltaReceiver lateReceiver;   // 중간 참여
+    StatusDeltaReceiver lossyReceiver;  // 변경분 한 프레임 유실
+
+    ReceiverStats full;
+    ReceiverStats late;
+    ReceiverStats lossy;
+
+    uint64_t reports = static_cast<uint64_t>(config.durationSeconds * 1000.0 / REPORT_MS);
+    uint64_t lateJoinReport = config.keyframeInterval + config.keyframeInterval / 3;
+    uint64_t dropReport = 3 * config.keyframeInterval + config.keyframeInterval / 2;
+    bool dropped = false;
+    bool lossDetected = false;
+    uint64_t resyncedAtReport = 0;
+    uint64_t emptyReports = 0;
+
+    for (uint64_t report = 0; report < reports; ++report) {
+        {
+            ScopedCoutSilencer silencer;
+            for (int t = 0; t < REPORT_MS / TICK_MS; ++t) {
+                clock.advance(std::chrono::milliseconds(TICK_MS));
+                service.update();
+            }
+
+            // 항적 1Hz, 발사관별로 보고 주기 10 개에 나누어 갱신
+            double phase = 0.1 * static_cast<double>(report / 10);
+            for (uint16_t tube = 1; tube <= config.tubes; ++tube) {
+                if (tube % 10 == report % 10) {
+                    service.updateTargetInfo(makeTrack(tube, phase));
+                }
+            }
+        }
+
+        auto snapshot = service.getSystemSnapshot();
+        auto frame = publisher.publish(snapshot->epoch, snapshot->tubes, snapshot->engagementResults);
+        bool lossyCurrent = true;       // 이번 프레임을 버린 보고는 비교하지 않음
+        if (frame.empty()) {
+            ++emptyReports;
+        } else {
+            if (receiver.apply(frame.data, frame.size)) {
+                ++full.applied;
+            } else {
+                ++full.rejected;
+            }
+
+            if (report >= lateJoinReport) {
+                if (lateReceiver.apply(frame.data, frame.size)) {
+                    ++late.applied;
+                    if (late.syncedAtReport < 0) {
+                        late.syncedAtReport = static_cast<int64_t>(report);
+                    }
+                } else {
+                    ++late.rejected;
+                }
+            }
+
+            if (report >= dropReport && !dropped && !frame.keyframe) {
+                dropped = true;
+                lossyCurrent = false;
+            } else if (lossyReceiver.apply(frame.data, frame.size)) {
+                ++lossy.applied;
+                if (lossDetected && resyncedAtReport == 0) {
+                    resyncedAtReport = report;
+                }
+            } else {
+                // 유실 감지 -> 게시 측에 키프레임 요청
+                ++lossy.rejected;
+                lossDetected = true;
+                publisher.requestKeyframe();
+            }
+        }
+
+        full.mismatches += matchesSnapshot(receiver, *snapshot) ? 0 : 1;
+        if (lateReceiver.isSynchronized()) {
+            late.mismatches += matchesSnapshot(lateReceiver, *snapshot) ? 0 : 1;
+        }
+        if (lossyCurrent && lossyReceiver.isSynchronized()) {
+            lossy.mismatches += matchesSnapshot(lossyReceiver, *snapshot) ? 0 : 1;
+        }
+    }
+
+    double seconds = static_cast<double>(reports) * REPORT_MS / 1000.0;
+    double fullRate = publisher.fullBytes() / seconds;
+    double deltaRate = publisher.bytes() / seconds;
+    double savings = fullRate > 0.0 ? 100.0 * (1.0 - deltaRate / fullRate) : 0.0;
+
+    std::cout << "Bandwidth over " << reports << " reports (" << publisher.frames() << " frames, "
+              << publisher.keyframes() << " keyframes, " << emptyReports << " unchanged):" << std::endl;
+    std::cout << std::fixed << std::setprecision(0);
+    std::cout << "  " << std::left << std::setw(28) << "full frame every report" << std::right << std::setw(12)
+              << fullRate << " B/s" << std::endl;
+    std::cout << "  " << std::left << std::setw(28) << "delta + keyframes" << std::right << std::setw(12)
+              << deltaRate << " B/s" << std::endl;
+    std::cout << std::setprecision(1) << "  -> " << savings << "% less published data" << std::defaultfloat << std::endl;
+
+    std::cout << std::endl << "Receivers:" << std::endl;
+    std::cout << "  " << std::left << std::setw(14) << "receiver" << std::right << std::setw(10) << "applied"
+              << std::setw(10) << "rejected" << std::setw(12) << "mismatches" << std::setw(10) << "synced" << std::endl;
+    auto printReceiver = [](const char* label, const ReceiverStats& stats, const StatusDeltaReceiver& r) {
+        std::cout << "  " << std::left << std::setw(14) << label << std::right << std::setw(10) << stats.applied
+                  << std::setw(10) << stats.rejected << std::setw(12) << stats.mismatches
+                  << std::setw(10) << (r.isSynchronized() ? "yes" : "no") << std::endl;
+    };
+    printReceiver("all frames", full, receiver);
+    printReceiver("late joiner", late, lateReceiver);
+    printReceiver("lossy", lossy, lossyReceiver);
+    std::cout << "  late joiner: joined at report " << lateJoinReport << ", synchronized at report "
+              << late.syncedAtReport << std::endl;
+    std::cout << "  lossy: dropped a delta at report " << dropReport << ", "
+              << (lossDetected ? "detected" : "not detected") << ", resynchronized at report " << resyncedAtReport
+              << std::endl << std::endl;
+
+    // -------------------------------------------------------------------------
+    // 게시 비용 (최근 스냅샷 고정, 변경 없음 / 매번 키프레임)
+    // -------------------------------------------------------------------------
+    BenchmarkRunner::printHeader();
+    BenchmarkRunner runner;
+    uint64_t sink = 0;
+    {
+        auto snapshot = service.getSystemSnapshot();
+        runner.run("publish (no change)", config.iterations, [&]() {
+            sink += publisher.publish(snapshot->epoch, snapshot->tubes, snapshot->engagementResults).size;
+        });
+        runner.run("publish (keyframe)", config.iterations / 10, [&]() {
+            publisher.requestKeyframe();
+            sink += publisher.publish(snapshot->epoch, snapshot->tubes, snapshot->engagementResults).size;
+        });
+    }
+
+    {
+        ScopedCoutSilencer silencer;
+        service.shutdown();
+    }
+    (void)sink;
+
+    // 늦은 참여는 참여 후 첫 키프레임(최대 K 보고)에서, 유실은 요청한 키프레임(다음 변경 보고)에서 동기화
+    bool lateOk = late.syncedAtReport >= 0
+               && static_cast<uint64_t>(late.syncedAtReport) < lateJoinReport + config.keyframeInterval;
+    bool lossOk = dropped && lossDetected && resyncedAtReport > dropReport
+               && resyncedAtReport < dropReport + config.keyframeInterval;
+    bool reconstructed = full.rejected == 0 && full.mismatches == 0 && late.mismatches == 0 && lossy.mismatches == 0;
+
+    std::cout << std::endl;
+    if (!reconstructed || !lateOk || !lossOk || savings <= 0.0) {
+        std::cout << "FAIL: " << full.mismatches + late.mismatches + lossy.mismatches << " reconstruction mismatches, "
+                  << full.rejected << " frames rejected, late join " << (lateOk ? "ok" : "not synchronized")
+                  << ", loss " << (lossOk ? "ok" : "not recovered") << std::endl;
+        return 1;
+    }
+
+    std::cout << "PASS: receivers reconstruct every snapshot from deltas" << std::endl;
+    return 0;
+}
@@ -0,0 +1,275 @@
+// =============================================================================
+// 정상 상태 할당 회귀 검사
+//
+// 표준 시나리오(N 발사관 할당/전원 인가/절반 발사, 표적/항법 스트림, 주기
+// update, 주기적 교전계획 재계산, 상태 조회)를 가상 시각으로 진행하며
+// 예열 이후 구간의 힙 할당을 입력 종류별로 집계한다. 미할당 발사관(N+1)과
+// 범위 밖 발사관으로 보낸 controlWeapon/updateWaypoints 거부 응답도 함께
+// 집계한다. 정상 상태에서 하나라도 할당하면 종료 코드 1 을 반환한다
+// (LaunchTube, LaunchTubeManager, EngagementManagerBase, 서비스의 임시
+// 문자열/벡터 회귀 방지).
+//
+// 사용법: SteadyStateAllocations [옵션]
+//   --tubes N            발사관 수 (기본 8)
+//   --targets M          시스템 표적 수 (기본 16)
+//   --warmup-ticks N     집계 전 예열 주기 수 (기본 50)
+//   --ticks N            집계 주기 수 (기본 600, 100ms 주기 기준 60초)
+//   --fail-on-alloc 0|1  할당 발생 시 실패 처리 (기본 1)
+// =============================================================================
+
+#include "BenchSupport.h"
+#include <array>
+#include <string>
+
+using namespace WeaponControl;
+using namespace WeaponControl::Bench;
+
+namespace {
+
+// -----------------------------------------------------------------------------
+// 설정
+// -----------------------------------------------------------------------------
+
+struct ScenarioConfig {
+    uint16_t tubes = 8;
+    uint32_t targets = 16;
+    uint32_t warmupTicks = 50;
+    uint32_t ticks = 600;
+    bool failOnAlloc = true;
+};
+
+ScenarioConfig parseArguments(int argc, char* argv[]) {
+    ScenarioConfig config;
+    OptionParser()
+        .add("--tubes", config.tubes)
+        .add("--targets", config.targets)
+        .add("--warmup-ticks", config.warmupTicks)
+        .add("--ticks", config.ticks)
+        .add("--fail-on-alloc", config.failOnAlloc)
+        .parse(argc, argv);
+    return config;
+}
+
+// -----------------------------------------------------------------------------
+// 입력 종류별 집계
+// -----------------------------------------------------------------------------
+
+enum class Stream : size_t {
+    TICK = 0,
+    TRACK,
+    NAV,
+    PLAN_RECOMPUTE,
+    STATUS_QUERY,
+    REJECTED_COMMAND,
+    COUNT
+};
+
+constexpr size_t STREAM_COUNT = static_cast<size_t>(Stream::COUNT);
+
+const char* streamName(Stream stream) {
+    switch (stream) {
+        case Stream::TICK: return "update tick";
+        case Stream::TRACK: return "target track";
+        case Stream::NAV: return "own ship nav";
+        case Stream::PLAN_RECOMPUTE: return "plan recompute";
+        case Stream::STATUS_QUERY: return "status query";
+        case Stream::REJECTED_COMMAND: return "rejected command";
+        default: return "unknown";
+    }
+}
+
+struct StreamAllocations {
+    uint64_t operations = 0;
+    uint64_t allocations = 0;
+    uint64_t bytes = 0;
+};
+
+class AllocationTally {
+public:
+    template <typename Fn>
+    void measure(Stream stream, Fn&& fn) {
+        auto before = AllocationSample::now();
+        fn();
+        auto after = AllocationSample::now();
+
+        auto& entry = m_streams[static_cast<size_t>(stream)];
+        ++entry.operations;
+        entry.allocations += after.allocations - before.allocations;
+        entry.bytes += after.bytes - before.bytes;
+    }
+
+    uint64_t totalAllocations() const {
+        uint64_t total = 0;
+        for (const auto& entry : m_streams) {
+            total += entry.allocations;
+        }
+        return total;
+    }
+
+    void print() const {
+        std::cout << "  " << std::left << std::setw(18) << "stream" << std::right
+                  << std::setw(12) << "operations" << std::setw(14) << "allocations"
+                  << std::setw(12) << "bytes" << std::setw(12) << "allocs/op" << std::endl;
+        for (size_t i = 0; i < STREAM_COUNT; ++i) {
+            const auto& entry = m_streams[i];
+            double perOp = entry.operations ? static_cast<double>(entry.allocations) / entry.operations : 0.0;
+            std::cout << "  " << std::left << std::setw(18) << streamName(static_cast<Stream>(i)) << std::right
+                      << std::setw(12) << entry.operations << std::setw(14) << entry.allocations
+                      << std::setw(12) << entry.bytes << std::setw(12) << std::fixed << std::setprecision(3)
+                      << perOp << std::defaultfloat << std::endl;
+        }
+    }
+
+private:
+    std::array<StreamAllocations, STREAM_COUNT> m_streams;
+};
+
+} // namespace
+
+int main(int argc, char* argv[]) {
+    auto config = parseArguments(argc, argv);
+
+    ServiceFixture fixture("steady_state");
+    auto& clock = fixture.clock();
+    const auto tickInterval = std::chrono::milliseconds(100);
+
+    // 마지막 발사관은 할당하지 않음 (거부 응답 경로용)
+    auto servicePtr = fixture.makeService(config.tubes + 1);
+    auto& service = *servicePtr;
+
+    uint64_t callbacks = 0;
+    service.setStateChangeCallback([&](uint16_t, EN_WPN_CTRL_STATE, EN_WPN_CTRL_STATE) { ++callbacks; });
+    service.setLaunchStatusCallback([&](uint16_t, bool) { ++callbacks; });
+    service.setEngagementPlanCallback([&](uint16_t, const EngagementPlanResult&) { ++callbacks; });
+
+    std::vector<LaunchTubeStatus> statuses;
+    statuses.reserve(config.tubes + 1);
+    size_t querySink = 0;
+
+    // 미할당 발사관과 범위 밖 발사관으로 보내는 명령 (모두 거부되어야 함)
+    const uint16_t unassignedTube = config.tubes + 1;
+    const uint16_t outOfRangeTube = config.tubes + 100;
+    std::array<WeaponControlRequest, 2> rejectedControls;
+    std::array<WaypointUpdateRequest, 2> rejectedWaypoints;
+    for (size_t i = 0; i < rejectedControls.size(); ++i) {
+        uint16_t tube = i == 0 ? unassignedTube : outOfRangeTube;
+        rejectedControls[i].tubeNumber = tube;
+        rejectedControls[i].targetState = EN_WPN_CTRL_STATE::WPN_CTRL_STATE_ON;
+        rejectedWaypoints[i] = makeWaypoints(tube, 3);
+    }
+    uint64_t acceptedRejections = 0;
+
+    AllocationTally warmupTally;
+    AllocationTally steadyTally;
+
+    // 1주기: 표적 스트림, 10주기마다 항법/교전계획 재계산, 상태 조회, update
+    auto step = [&](uint32_t tick, AllocationTally& tally) {
+        double phase = tick * 0.05;
+        for (uint32_t target = 1; target <= config.targets; ++target) {
+            auto track = makeTrack(target, phase);
+            tally.measure(Stream::TRACK, [&]() { service.updateTargetInfo(track); });
+        }
+
+        if (tick % 10 == 0) {
+            NAVINF_SHIP_NAVIGATION_INFO ownShip;
+            tally.measure(Stream::NAV, [&]() { service.updateOwnShipInfo(ownShip); });
+            tally.measure(Stream::PLAN_RECOMPUTE, [&]() { service.calculateAllEngagementPlans(); });
+
+            for (size_t i = 0; i < rejectedControls.size(); ++i) {
+                tally.measure(Stream::REJECTED_COMMAND, [&]() {
+                    acceptedRejections += service.controlWeapon(rejectedControls[i]).isSuccess() ? 1 : 0;
+                });
+                tally.measure(Stream::REJECTED_COMMAND, [&]() {
+                    acceptedRejections += service.updateWaypoints(rejectedWaypoints[i]).isSuccess() ? 1 : 0;
+                });
+            }
+        }
+
+        tally.measure(Stream::STATUS_QUERY, [&]() {
+            service.getAllTubeStatus(statuses);
+            for (uint16_t tube = 1; tube <= config.tubes; ++tube) {
+                querySink += service.getTubeStatus(tube).engagementPlanValid ? 1 : 0;
+            }
+            querySink += service.getAssignedTubeCount() + service.getReadyTubeCount();
+            auto snapshot = service.getSystemSnapshot();
+            querySink += snapshot ? snapshot->tubes.size() : 0;
+        });
+
+        tally.measure(Stream::TICK, [&]() { service.update(); });
+        clock.advance(tickInterval);
+    };
+
+    {
+        ScopedCoutSilencer silencer;
+
+        auto initResult = service.initialize();
+        if (!initResult) {
+            std::cerr << "Service initialization failed: " << initResult.error().message << std::endl;
+            return 1;
+        }
+
+        for (uint32_t target = 1; target <= config.targets; ++target) {
+            service.updateTargetInfo(makeTrack(target, 0.0));
+        }
+        for (uint16_t tube = 1; tube <= config.tubes; ++tube) {
+            service.assignWeapon(makeAssignment(tube, (tube - 1) % config.targets + 1));
+        }
+
+        WeaponControlRequest control;
+        control.targetState = EN_WPN_CTRL_STATE::WPN_CTRL_STATE_ON;
+        for (uint16_t tube = 1; tube <= config.tubes; ++tube) {
+            control.tubeNumber = tube;
+            service.controlWeapon(control);
+        }
+        service.update();   // ON -> RTL (교전계획 유효)
+
+        // 홀수 발사관 발사 (발사 후 추적 경로 포함)
+        control.targetState = EN_WPN_CTRL_STATE::WPN_CTRL_STATE_LAUNCH;
+        for (uint16_t tube = 1; tube <= config.tubes; tube += 2) {
+            control.tubeNumber = tube;
+            service.controlWeapon(control);
+        }
+
+        for (uint32_t tick = 0; tick < config.warmupTicks; ++tick) {
+            step(tick, warmupTally);
+        }
+    }
+
+    std::cout << "Steady-state allocation check: " << config.tubes + 1 << " tubes ("
+              << service.getAssignedTubeCount() << " assigned, " << (config.tubes + 1) / 2 << " launched), "
+              << config.targets << " targets, " << config.ticks << " ticks after "
+              << config.warmupTicks << " warm-up ticks" << std::endl;
+
+    {
+        ScopedCoutSilencer silencer;
+        for (uint32_t tick = config.warmupTicks; tick < config.warmupTicks + config.ticks; ++tick) {
+            step(tick, steadyTally);
+        }
+    }
+
+    std::cout << "Warm-up allocations: " << warmupTally.totalAllocations() << std::endl;
+    std::cout << "Steady state:" << std::endl;
+    steadyTally.print();
+    std::cout << "(" << callbacks << " callbacks, query checksum " << querySink << ")" << std::endl;
+
+    {
+        ScopedCoutSilencer silencer;
+        service.shutdown();
+    }
+
+    if (acceptedRejections != 0) {
+        std::cout << "FAIL: " << acceptedRejections << " commands to unassigned/out-of-range tubes accepted"
+                  << std::endl;
+        return 1;
+    }
+
+    uint64_t steadyAllocations = steadyTally.totalAllocations();
+    if (steadyAllocations != 0) {
+        std::cout << (config.failOnAlloc ? "FAIL" : "WARN") << ": " << steadyAllocations
+                  << " heap allocations in steady state" << std::endl;
+        return config.failOnAlloc ? 1 : 0;
+    }
+
+    std::cout << "PASS: no heap allocations in steady state" << std::endl;
+    return 0;
+}
@@ -0,0 +1,393 @@
+// =============================================================================
+// 시스템 스냅샷 읽기 벤치마크
+//
+// 1) 읽기 비용: 발사관별 조회(getAllTubeStatus + getAllEngagementResults)와
+//    getSystemSnapshot 핸들 획득/해제 및 전체 순회 비용
+// 2) 일관성: 주기 스레드(update), 명령 스레드(비상 정지 후 발사관 1..N 순서로
+//    전원 인가 반복), 항적 스레드(발사관 1..N 순서로 표적 항적 갱신 반복, 회차를
+//    경도에 기록), 읽기 스레드 R 개를 동시에 실행한다. 명령 순서상 전원 인가된
+//    발사관은 항상 번호 앞쪽부터 연속(prefix)이어야 하고, 교전계획의 항적 회차도
+//    번호 앞쪽부터 새 회차(차이 1 이하)이며 각 계획의 궤적 끝이 표적 위치와 같아야
+//    하므로, 이를 어긴 관측을 발사관 간 불일치로 센다. 스냅샷은 불일치 0, 게시 순번
+//    단조 증가, 핸들을 잡은 동안 내용 불변이어야 하며 발사관별 조회의 불일치 수는
+//    비교용으로만 출력한다.
+// 3) 실제 지연 전이: 실제 시각으로 전원 인가 점검(POC) 지연이 있는 controlWeapon(ON)
+//    과, 그 도중의 비상 정지/전체 교전계획 재계산을 주기 스레드와 동시에 실행하여
+//    명령이 전이를 기다리는 동안에도 update() 한 번의 시간이 지연의 절반 미만인지
+//
+// 사용법: SystemSnapshotReaders [옵션]
+//   --tubes N        발사관 수 (기본 24)
+//   --readers R      스냅샷 읽기 스레드 수 (기본 4)
+//   --duration S     동시 실행 시간(초, 기본 2)
+//   --iterations N   읽기 비용 측정 반복 수 (기본 200000)
+//   --launch-delay S 실제 지연 전이의 전원 인가 점검 시간(초, 기본 0.5)
+//
+// 스냅샷 불일치, 핸들을 잡은 동안의 변경, 게시 순번 역행이 하나라도 있거나 실제 지연
+// 전이 중 update() 가 지연의 절반 이상 걸리면 종료 코드 1.
+// =============================================================================
+
+#include "BenchSupport.h"
+#include <atomic>
+#include <cmath>
+#include <string>
+#include <thread>
+
+using namespace WeaponControl;
+using namespace WeaponControl::Bench;
+
+namespace {
+
+// -----------------------------------------------------------------------------
+// 설정
+// -----------------------------------------------------------------------------
+
+struct BenchConfig {
+    uint16_t tubes = 24;
+    uint32_t readers = 4;
+    double durationSeconds = 2.0;
+    uint64_t iterations = 200000;
+    double launchDelaySeconds = 0.5;
+};
+
+BenchConfig parseArguments(int argc, char* argv[]) {
+    BenchConfig config;
+    OptionParser()
+        .add("--tubes", config.tubes, 2)
+        .add("--readers", config.readers, 1)
+        .add("--duration", config.durationSeconds)
+        .add("--iterations", config.iterations)
+        .add("--launch-delay", config.launchDelaySeconds, 0.1)
+        .parse(argc, argv);
+    return config;
+}
+
+// -----------------------------------------------------------------------------
+// 시나리오
+// -----------------------------------------------------------------------------
+
+bool isPowered(const LaunchTubeStatus& status) {
+    return status.hasWeapon && status.weaponState != EN_WPN_CTRL_STATE::WPN_CTRL_STATE_OFF;
+}
+
+// 전원 인가 발사관이 번호 앞쪽부터 연속인지
+bool isPoweredPrefix(const std::vector<LaunchTubeStatus>& tubes) {
+    bool seenOff = false;
+    for (const auto& status : tubes) {
+        if (!isPowered(status)) {
+            seenOff = true;
+        } else if (seenOff) {
+            return false;
+        }
+    }
+    return true;
+}
+
+// 항적 회차는 경도 오프셋으로 기록한다
+constexpr double ROUND_STEP_DEG = 1e-6;
+
+TRKMGR_SYSTEMTARGET_INFO makeRoundTrack(uint32_t targetId, uint64_t round) {
+    auto track = makeTrack(targetId, 0.0);
+    track.stGeodeticPosition().dLongitude() = 129.0 + static_cast<double>(round) * ROUND_STEP_DEG;
+    return track;
+}
+
+int64_t trackRound(const ST_3D_GEODETIC_POSITION& position) {
+    return std::llround((position.dLongitude() - 129.0) / ROUND_STEP_DEG);
+}
+
+// 교전계획의 항적 회차가 번호 앞쪽부터 새 회차(차이 1 이하)이고 궤적 끝이 표적 위치와 같은지
+bool isPlanRoundPrefix(const std::vector<EngagementPlanResult>& results) {
+    int64_t first = -1;
+    int64_t previous = 0;
+    for (const auto& result : results) {
+        if (!result.isValid || result.trajectory.empty()) {
+            continue;
+        }
+        if (result.trajectory.back().dLongitude() != result.targetPosition.dLongitude()) {
+            return false;
+        }
+
+        int64_t round = trackRound(result.targetPosition);
+        if (first < 0) {
+            first = round;
+        } else if (round > previous || first - round > 1) {
+            return false;
+        }
+        previous = round;
+    }
+    return true;
+}
+
+bool isConsistent(const SystemSnapshot& snapshot) {
+    return isPoweredPrefix(snapshot.tubes) && isPlanRoundPrefix(snapshot.engagementResults);
+}
+
+// -----------------------------------------------------------------------------
+// 실제 지연 전이 중 주기 시간
+// -----------------------------------------------------------------------------
+
+struct TransitionTickResult {
+    bool controlSucceeded = false;
+    double controlMs = 0.0;         // controlWeapon(ON) 소요 시간 (실제 지연 이상이어야 함)
+    double maxTickMs = 0.0;         // 그동안 update() 한 번의 최대 시간
+    uint64_t ticks = 0;
+};
+
+// 이 함수의 스레드들은 시각 재정의가 없으므로 실제 시각으로 대기한다
+TransitionTickResult measureTickDuringTransition(const ServiceFixture& fixture, double launchDelaySeconds) {
+    using Milliseconds = std::chrono::duration<double, std::milli>;
+
+    auto& config = SystemConfig::getInstance();
+    config.set("Weapon.DefaultLaunchDelay", std::to_string(launchDelaySeconds));
+    auto service = fixture.makeService(2, "transition_mine");
+    {
+        ScopedCoutSilencer silencer;
+        service->initialize();
+        assignMissiles(*service, 2);
+        service->update();
+    }
+    config.set("Weapon.DefaultLaunchDelay", "0");
+
+    TransitionTickResult result;
+    std::atomic<bool> running{true};
+    {
+        ScopedCoutSilencer silencer;
+
+        std::thread ticker([&]() {
+            while (running.load(std::memory_order_relaxed)) {
+                auto start = std::chrono::steady_clock::now();
+                service->update();
+                result.maxTickMs = std::max(result.maxTickMs, Milliseconds(std::chrono::steady_clock::now() - start).count());
+                ++result.ticks;
+                std::this_thread::sleep_for(std::chrono::milliseconds(10));
+            }
+        });
+
+        std::thread commander([&]() {
+            WeaponControlRequest on;
+            on.tubeNumber = 1;
+            on.targetState = EN_WPN_CTRL_STATE::WPN_CTRL_STATE_ON;
+            auto start = std::chrono::steady_clock::now();
+            result.controlSucceeded = service->controlWeapon(on).isSuccess();
+            result.controlMs = Milliseconds(std::chrono::steady_clock::now() - start).count();
+        });
+
+        // 전이 도중의 비상 정지(같은 무장의 전이 종료 대기)와 재계산 명령
+        std::thread stopper([&]() {
+            std::this_thread::sleep_for(std::chrono::duration<double>(launchDelaySeconds / 4));
+            service->calculateAllEngagementPlans();
+            service->emergencyStop();
+        });
+
+        commander.join();
+        stopper.join();
+        running = false;
+        ticker.join();
+
+        service->shutdown();
+    }
+    return result;
+}
+
+struct ReaderStats {
+    uint64_t reads = 0;
+    uint64_t inconsistent = 0;      // 발사관 간 불일치 (전원 인가/항적 회차 prefix 위반)
+    uint64_t epochRegressions = 0;
+    uint64_t mutated = 0;           // 핸들을 잡은 동안 내용 변경
+    uint64_t empty = 0;
+};
+
+} // namespace
+
+int main(int argc, char* argv[]) {
+    auto config = parseArguments(argc, argv);
+
+    ServiceFixture fixture("snapshot");
+    auto& clock = fixture.clock();
+    auto servicePtr = fixture.makeService(config.tubes);
+    auto& service = *servicePtr;
+
+    {
+        ScopedCoutSilencer silencer;
+        service.initialize();
+        assignMissiles(service, config.tubes);
+        for (uint16_t tube = 1; tube <= config.tubes; ++tube) {
+            service.updateTargetInfo(makeRoundTrack(tube, 0));
+        }
+        service.update();
+    }
+
+    std::cout << "System snapshot: " << config.tubes << " tubes, " << config.readers << " reader threads"
+              << std::endl << std::endl;
+
+    // -------------------------------------------------------------------------
+    // 읽기 비용
+    // -------------------------------------------------------------------------
+    BenchmarkRunner::printHeader();
+    BenchmarkRunner runner;
+    uint64_t sink = 0;
+    std::vector<LaunchTubeStatus> statuses;
+
+    runner.run("getAllTubeStatus + getAllEngagementResults", config.iterations / 10, [&]() {
+        service.getAllTubeStatus(statuses);
+        auto results = service.getAllEngagementResults();
+        sink += statuses.size() + results.size();
+    });
+    runner.run("getSystemSnapshot (acquire/release)", config.iterations, [&]() {
+        auto snapshot = service.getSystemSnapshot();
+        sink += snapshot->epoch;
+    });
+    runner.run("getSystemSnapshot + scan all tubes", config.iterations, [&]() {
+        auto snapshot = service.getSystemSnapshot();
+        for (const auto& status : snapshot->tubes) {
+            sink += isPowered(status) ? 1 : 0;
+        }
+        for (const auto& result : snapshot->engagementResults) {
+            sink += result.trajectory.size();
+        }
+    });
+
+    // -------------------------------------------------------------------------
+    // 동시 실행 일관성
+    // -------------------------------------------------------------------------
+    std::atomic<bool> running{true};
+    std::vector<ReaderStats> readerStats(config.readers);
+    ReaderStats legacyStats;
+    uint64_t ticks = 0;
+    uint64_t commandCycles = 0;
+    uint64_t trackRounds = 0;
+
+    {
+        ScopedCoutSilencer silencer;
+
+        std::thread ticker([&]() {
+            while (running.load(std::memory_order_relaxed)) {
+                service.update();
+                clock.advance(std::chrono::milliseconds(10));
+                ++ticks;
+            }
+        });
+
+        std::thread commander([&]() {
+            WeaponControlRequest on;
+            on.targetState = EN_WPN_CTRL_STATE::WPN_CTRL_STATE_ON;
+            while (running.load(std::memory_order_relaxed)) {
+                service.emergencyStop();
+                for (uint16_t tube = 1; tube <= config.tubes; ++tube) {
+                    on.tubeNumber = tube;
+                    service.controlWeapon(on);
+                }
+                ++commandCycles;
+            }
+        });
+
+        // 환경 입력도 교전계획을 재계산하므로 명령과 같이 수집과 겹치면 안 된다
+        std::thread trackWriter([&]() {
+            while (running.load(std::memory_order_relaxed)) {
+                ++trackRounds;
+                for (uint16_t tube = 1; tube <= config.tubes; ++tube) {
+                    service.updateTargetInfo(makeRoundTrack(tube, trackRounds));
+                }
+            }
+        });
+
+        std::vector<std::thread> readers;
+        for (uint32_t r = 0; r < config.readers; ++r) {
+            readers.emplace_back([&, r]() {
+                auto& stats = readerStats[r];
+                uint64_t lastEpoch = 0;
+                while (running.load(std::memory_order_relaxed)) {
+                    auto snapshot = service.getSystemSnapshot();
+                    if (!snapshot) {
+                        ++stats.empty;
+                        continue;
+                    }
+
+                    uint64_t epoch = snapshot->epoch;
+                    bool consistent = isConsistent(*snapshot);
+                    std::this_thread::yield();
+                    if (snapshot->epoch != epoch || isConsistent(*snapshot) != consistent) {
+                        ++stats.mutated;
+                    }
+
+                    stats.inconsistent += consistent ? 0 : 1;
+                    stats.epochRegressions += epoch < lastEpoch ? 1 : 0;
+                    lastEpoch = epoch;
+                    ++stats.reads;
+                }
+            });
+        }
+
+        // 비교용: 발사관별 조회 (발사관마다 다른 시점)
+        std::thread legacyReader([&]() {
+            std::vector<LaunchTubeStatus> tubes;
+            while (running.load(std::memory_order_relaxed)) {
+                service.getAllTubeStatus(tubes);
+                legacyStats.inconsistent += isPoweredPrefix(tubes) ? 0 : 1;
+                ++legacyStats.reads;
+            }
+        });
+
+        std::this_thread::sleep_for(std::chrono::duration<double>(config.durationSeconds));
+        running = false;
+
+        ticker.join();
+        commander.join();
+        trackWriter.join();
+        for (auto& reader : readers) {
+            reader.join();
+        }
+        legacyReader.join();
+
+        service.shutdown();
+    }
+
+    ReaderStats total;
+    for (const auto& stats : readerStats) {
+        total.reads += stats.reads;
+        total.inconsistent += stats.inconsistent;
+        total.epochRegressions += stats.epochRegressions;
+        total.mutated += stats.mutated;
+        total.empty += stats.empty;
+    }
+
+    std::cout << std::endl << "Concurrent run (" << config.durationSeconds << " s, " << ticks << " ticks, "
+              << commandCycles << " command cycles, " << trackRounds << " track rounds):" << std::endl;
+    std::cout << "  " << std::left << std::setw(22) << "reader" << std::right << std::setw(12) << "reads"
+              << std::setw(14) << "inconsistent" << std::setw(10) << "mutated" << std::setw(12) << "regressed" << std::endl;
+    std::cout << "  " << std::left << std::setw(22) << "getSystemSnapshot" << std::right << std::setw(12) << total.reads
+              << std::setw(14) << total.inconsistent << std::setw(10) << total.mutated
+              << std::setw(12) << total.epochRegressions << std::endl;
+    std::cout << "  " << std::left << std::setw(22) << "getAllTubeStatus" << std::right << std::setw(12) << legacyStats.reads
+              << std::setw(14) << legacyStats.inconsistent << std::setw(10) << "-" << std::setw(12) << "-" << std::endl;
+
+    (void)sink;
+
+    // -------------------------------------------------------------------------
+    // 실제 지연 전이 중 주기 시간
+    // -------------------------------------------------------------------------
+    auto transition = measureTickDuringTransition(fixture, config.launchDelaySeconds);
+    double delayMs = config.launchDelaySeconds * 1000.0;
+    bool transitionOk = transition.controlSucceeded && transition.controlMs >= delayMs * 0.9
+        && transition.maxTickMs < delayMs / 2;
+
+    std::cout << std::endl << "Real-delay transition (" << std::fixed << std::setprecision(0) << delayMs
+              << " ms power-on check, concurrent recalculation and emergency stop):" << std::endl;
+    std::cout << "  controlWeapon(ON) " << transition.controlMs << " ms ("
+              << (transition.controlSucceeded ? "succeeded" : "failed") << "), max update() "
+              << std::setprecision(2) << transition.maxTickMs << " ms over " << transition.ticks << " ticks"
+              << std::defaultfloat << std::endl;
+
+    std::cout << std::endl;
+    if (total.reads == 0 || total.inconsistent != 0 || total.mutated != 0 || total.epochRegressions != 0 || !transitionOk) {
+        std::cout << "FAIL: " << total.inconsistent << " inconsistent snapshots, " << total.mutated
+                  << " mutated while held, " << total.epochRegressions << " epoch regressions, update() "
+                  << (transitionOk ? "bounded" : "blocked or transition not delayed") << " during real-delay transition"
+                  << std::endl;
+        return 1;
+    }
+
+    std::cout << "PASS: " << total.reads << " snapshot reads consistent across tubes, update() bounded during "
+              << "real-delay transition" << std::endl;
+    return 0;
+}
@@ -0,0 +1,113 @@
+// =============================================================================
+// 이벤트 로그 재생 도구
+//
+// 사용법: EventReplay <log> [옵션]
+//   --speed max|N        재생 속도 (max: 최대 속도(기본), 1: 실시간, N: N배속)
+//   --config PATH        기록 당시의 SystemConfig 파일
+//   --dump               재생하지 않고 이벤트 목록만 출력
+//   --verbose            서비스 로그 출력
+//
+// 종료 코드: 0 = 기록과 일치, 2 = 불일치, 1 = 오류
+// =============================================================================
+
+#include "../Core/Service/EventReplayer.h"
+#include "../Infrastructure/Configuration/SystemConfig.h"
+#include <iomanip>
+#include <iostream>
+#include <streambuf>
+#include <string>
+
+using namespace WeaponControl;
+
+namespace {
+
+class NullBuffer : public std::streambuf {
+protected:
+    int overflow(int c) override { return traits_type::not_eof(c); }
+    std::streamsize xsputn(const char*, std::streamsize n) override { return n; }
+};
+
+void dumpRecords(const std::vector<EventRecord>& records) {
+    int64_t originNs = records.empty() ? 0 : records.front().timestampNs;
+    for (const auto& record : records) {
+        std::cout << std::setw(8) << record.sequence << "  "
+                  << std::fixed << std::setprecision(6) << std::setw(12)
+                  << (record.timestampNs - originNs) / 1e9 << "s  "
+                  << std::left << std::setw(22) << EventTypeName(record.type) << std::right
+                  << record.payload.size() << " B" << std::defaultfloat << std::endl;
+    }
+}
+
+} // namespace
+
+int main(int argc, char* argv[]) {
+    if (argc < 2) {
+        std::cerr << "Usage: EventReplay <log> [--speed max|N] [--config PATH] [--dump] [--verbose]" << std::endl;
+        return 1;
+    }
+
+    std::string logPath = argv[1];
+    ReplayOptions options;
+    bool dumpOnly = false;
+    bool verbose = false;
+
+    for (int i = 2; i < argc; ++i) {
+        std::string arg = argv[i];
+        if (arg == "--speed" && i + 1 < argc) {
+            std::string value = argv[++i];
+            options.speed = (value == "max") ? 0.0 : std::stod(value);
+        } else if (arg == "--config" && i + 1 < argc) {
+            auto result = SystemConfig::getInstance().loadFromFile(argv[++i]);
+            if (!result) {
+                std::cerr << result.error().message << std::endl;
+                return 1;
+            }
+        } else if (arg == "--dump") {
+            dumpOnly = true;
+        } else if (arg == "--verbose") {
+            verbose = true;
+        } else {
+            std::cerr << "Unknown option: " << arg << std::endl;
+            return 1;
+        }
+    }
+
+    auto records = EventLogReader::readAll(logPath);
+    if (!records) {
+        std::cerr << records.error().message << std::endl;
+        return 1;
+    }
+
+    if (dumpOnly) {
+        dumpRecords(records.value());
+        return 0;
+    }
+
+    NullBuffer nullBuffer;
+    std::streambuf* previous = verbose ? nullptr : std::cout.rdbuf(&nullBuffer);
+
+    EventReplayer replayer(options);
+    auto result = replayer.replay(records.value());
+
+    if (previous) {
+        std::cout.rdbuf(previous);
+    }
+
+    if (!result) {
+        std::cerr << result.error().message << std::endl;
+        return 1;
+    }
+
+    const auto& report = result.value();
+    std::cout << "Replayed " << report.inputEvents << " input events (" << report.skippedEvents << " skipped), "
+              << report.simulatedSeconds << " s simulated in " << report.wallSeconds << " s" << std::endl;
+    std::cout << "Callbacks: expected " << report.expectedOutputs << ", produced " << report.producedOutputs
+              << ", mismatched " << report.mismatchedOutputs << std::endl;
+
+    for (const auto& divergence : report.divergences) {
+        std::cout << "  " << divergence << std::endl;
+    }
+
+    std::cout << (report.identical() ? "IDENTICAL" : "DIVERGED") << std::endl;
+    return report.identical() ? 0 : 2;
+}